@@ -99,6 +99,10 @@ class HashTableImpl {
   //  @return the index of the found bucket
   unsigned int lookUpBucketFor(const key_type& pKey);
 
+  /// lookUpBucketFor - search the index of bucket whose key is pKey, where
+  //  pFullHash is the hash value of pKey computed by the caller
+  unsigned int lookUpBucketFor(const key_type& pKey, unsigned int pFullHash);
+
   /// findKey - finds an element with key pKey
   //  return the index of the element, or -1 when the element does not exist.
   int findKey(const key_type& pKey) const;
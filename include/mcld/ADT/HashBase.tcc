@@ -112,12 +112,20 @@ void HashTableImpl<HashEntryTy, HashFunctionTy>::clear() {
 template <typename HashEntryTy, typename HashFunctionTy>
 unsigned int HashTableImpl<HashEntryTy, HashFunctionTy>::lookUpBucketFor(
     const typename HashTableImpl<HashEntryTy, HashFunctionTy>::key_type& pKey) {
+  return lookUpBucketFor(pKey, m_Hasher(pKey));
+}
+
+/// lookUpBucketFor - look up the bucket whose key is pKey with the given hash
+template <typename HashEntryTy, typename HashFunctionTy>
+unsigned int HashTableImpl<HashEntryTy, HashFunctionTy>::lookUpBucketFor(
+    const typename HashTableImpl<HashEntryTy, HashFunctionTy>::key_type& pKey,
+    unsigned int pFullHash) {
   if (m_NumOfBuckets == 0) {
     // NumOfBuckets is changed after init(pInitSize)
     init(NumOfInitBuckets);
   }
 
-  unsigned int full_hash = m_Hasher(pKey);
+  unsigned int full_hash = pFullHash;
   unsigned int index = full_hash % m_NumOfBuckets;
 
   const unsigned int probe = 1;
@@ -70,6 +70,10 @@ class HashTable : public HashTableImpl<HashEntryTy, HashFunctionTy> {
   //  If the element already exists, return the element, and set pExist true.
   entry_type* insert(const key_type& pKey, bool& pExist);
 
+  /// insert - insert a new element whose hash value pHash has been computed
+  //  by the caller, e.g., while the input was being read.
+  entry_type* insert(const key_type& pKey, unsigned int pHash, bool& pExist);
+
   /// erase - remove the element with the same key
   size_type erase(const key_type& pKey);
 
@@ -64,7 +64,21 @@ HashTable<HashEntryTy, HashFunctionTy, EntryFactoryTy>::insert(
                              HashFunctionTy,
                              EntryFactoryTy>::key_type& pKey,
     bool& pExist) {
-  unsigned int index = BaseTy::lookUpBucketFor(pKey);
+  return insert(pKey, BaseTy::m_Hasher(pKey), pExist);
+}
+
+/// insert - insert a new element with the hash value pHash of pKey
+template <typename HashEntryTy,
+          typename HashFunctionTy,
+          typename EntryFactoryTy>
+typename HashTable<HashEntryTy, HashFunctionTy, EntryFactoryTy>::entry_type*
+HashTable<HashEntryTy, HashFunctionTy, EntryFactoryTy>::insert(
+    const typename HashTable<HashEntryTy,
+                             HashFunctionTy,
+                             EntryFactoryTy>::key_type& pKey,
+    unsigned int pHash,
+    bool& pExist) {
+  unsigned int index = BaseTy::lookUpBucketFor(pKey, pHash);
   bucket_type& bucket = BaseTy::m_Buckets[index];
   entry_type* entry = bucket.Entry;
   if (bucket_type::getEmptyBucket() != entry &&
@@ -44,7 +44,9 @@ class Fragment : public llvm::ilist_node<Fragment> {
 
   uint64_t getOffset() const;
 
-  void setOffset(uint64_t pOffset) { m_Offset = pOffset; }
+  /// setOffset - set the offset, which may change the size of an alignment,
+  /// so the offset index of the parent is dropped
+  void setOffset(uint64_t pOffset);
 
   bool hasOffset() const;
 
@@ -38,10 +38,19 @@ class FragmentRef {
   ///                  be larger than the section size.
   /// @return if the offset is legal, return the fragment reference. Otherwise,
   /// return NULL.
+  /// If pFrag is the front of its section and the offset is far from it, the
+  /// fragment is found by the offset index of the section data.
   static FragmentRef* Create(Fragment& pFrag, uint64_t pOffset);
 
   static FragmentRef* Create(LDSection& pSection, uint64_t pOffset);
 
+  /// Find - find the place at pOffset from pFrag like Create, and assign it
+  /// to pResult without creating a fragment reference.
+  /// @return false if the offset is not legal
+  static bool Find(Fragment& pFrag, uint64_t pOffset, FragmentRef& pResult);
+
+  static bool Find(LDSection& pSection, uint64_t pOffset, FragmentRef& pResult);
+
   /// Clear - clear all generated FragmentRef in the system.
   static void Clear();
 
@@ -74,6 +83,7 @@ class FragmentRef {
  private:
   friend FragmentRef& NullFragmentRef();
   friend class Chunk<FragmentRef, MCLD_SECTIONS_PER_INPUT>;
+  friend class RelocData;
   friend class Relocation;
 
   FragmentRef();
@@ -18,9 +18,10 @@
 
 namespace mcld {
 
-class ResolveInfo;
-class Relocator;
+class LDSection;
 class LinkerConfig;
+class Relocator;
+class ResolveInfo;
 
 class Relocation : public llvm::ilist_node<Relocation> {
   friend class RelocationFactory;
@@ -62,9 +63,20 @@ class Relocation : public llvm::ilist_node<Relocation> {
                             FragmentRef& pFragRef,
                             Address pAddend = 0);
 
+  /// Create - produce a relocation entry that applies to pOffset of
+  /// pSection, without creating a FragmentRef for the place
+  static Relocation* Create(Type pType,
+                            LDSection& pSection,
+                            uint64_t pOffset,
+                            Address pAddend = 0);
+
   /// Destroy - destroy a relocation entry
   static void Destroy(Relocation*& pRelocation);
 
+  /// ReadTarget - read the target data at pFragRef, as a relocation created
+  /// there holds
+  static DWord ReadTarget(const FragmentRef& pFragRef);
+
   /// type - relocation type
   Type type() const { return m_Type; }
 
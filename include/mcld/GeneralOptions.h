@@ -48,6 +48,16 @@ class GeneralOptions {
     Safe
   };
 
+  enum class BuildIDStyle {
+    Unknown,
+    None,
+    Fast,
+    MD5,
+    SHA1,
+    UUID,
+    Hex
+  };
+
   typedef std::vector<std::string> RpathList;
   typedef RpathList::iterator rpath_iterator;
   typedef RpathList::const_iterator const_rpath_iterator;
@@ -282,6 +292,75 @@ class GeneralOptions {
     m_bPrintICFSections = pPrintICFSections;
   }
 
+  BuildIDStyle getBuildIDStyle() const { return m_BuildIDStyle; }
+
+  void setBuildIDStyle(BuildIDStyle pStyle) { m_BuildIDStyle = pStyle; }
+
+  bool hasBuildID() const {
+    return m_BuildIDStyle != BuildIDStyle::Unknown &&
+           m_BuildIDStyle != BuildIDStyle::None;
+  }
+
+  /// getBuildIDValue - the raw bytes given by --build-id=0x<hex>
+  const std::string& getBuildIDValue() const { return m_BuildIDValue; }
+
+  void setBuildIDValue(const std::string& pValue) { m_BuildIDValue = pValue; }
+
+  /// streamRelocations - apply relocations while emitting the output and
+  /// write each result straight into the output buffer.
+  bool streamRelocations() const { return m_bStreamRelocations; }
+
+  void setStreamRelocations(bool pEnable = true) {
+    m_bStreamRelocations = pEnable;
+  }
+
+  /// tailMergeStrings - fold the mergeable strings that are suffixes of other
+  /// strings into them.
+  bool tailMergeStrings() const { return m_bTailMergeStrings; }
+
+  void setTailMergeStrings(bool pEnable = true) {
+    m_bTailMergeStrings = pEnable;
+  }
+
+  /// streamOutputThreshold - the outputs of this size or larger are staged
+  /// in a temporary file and written to the file with pwrite, instead of
+  /// being mapped.
+  uint64_t streamOutputThreshold() const { return m_StreamOutputThreshold; }
+
+  void setStreamOutputThreshold(uint64_t pSize) {
+    m_StreamOutputThreshold = pSize;
+  }
+
+  /// numThreads - the number of threads the linker may use. One means all
+  /// work is done on the calling thread.
+  unsigned numThreads() const { return m_NumThreads; }
+
+  void setNumThreads(unsigned pNum) { m_NumThreads = pNum; }
+
+  /// isPatchIdenticalLayout - keep the link state next to the output. The
+  /// next link patches the changed bytes of the output instead of a relink
+  /// if the layout of the output stays identical. This is not an incremental
+  /// link: any change of a section size, a symbol or a relocation needs a
+  /// full link.
+  bool isPatchIdenticalLayout() const { return m_bPatchIdenticalLayout; }
+
+  void setPatchIdenticalLayout(bool pEnable = true) {
+    m_bPatchIdenticalLayout = pEnable;
+  }
+
+  /// getPatchKey - the command line of a --patch-identical-layout link. The
+  /// link state is reused only by the links with the same key.
+  const std::string& getPatchKey() const { return m_PatchKey; }
+
+  void setPatchKey(const std::string& pKey) { m_PatchKey = pKey; }
+
+  /// isFastExit - end the process right after the output is written,
+  /// without destroying the link. Only the drivers that exit after one link
+  /// honor it.
+  bool isFastExit() const { return m_bFastExit; }
+
+  void setFastExit(bool pEnable = true) { m_bFastExit = pEnable; }
+
   // -----  link-in rpath  ----- //
   const RpathList& getRpathList() const { return m_RpathList; }
   RpathList& getRpathList() { return m_RpathList; }
@@ -386,14 +465,23 @@ class GeneralOptions {
   bool m_bPrintGCSections : 1;    // --print-gc-sections
   bool m_bGenUnwindInfo : 1;      // --ld-generated-unwind-info
   bool m_bPrintICFSections : 1;   // --print-icf-sections
+  bool m_bStreamRelocations : 1;  // --stream-relocations
+  bool m_bTailMergeStrings : 1;   // --tail-merge-strings
+  bool m_bPatchIdenticalLayout : 1;  // --patch-identical-layout
+  bool m_bFastExit : 1;           // --fast-exit
   ICF m_ICF;
   size_t m_ICFIterations;
+  unsigned m_NumThreads;  // --threads=N
+  uint64_t m_StreamOutputThreshold;  // --stream-output-threshold=N
   uint32_t m_GPSize;  // -G, --gpsize
   StripSymbolMode m_StripSymbols;
   RpathList m_RpathList;
   ScriptList m_ScriptList;
   UndefSymList m_UndefSymList;  // -u [symbol], --undefined [symbol]
   HashStyle m_HashStyle;
+  BuildIDStyle m_BuildIDStyle;  // --build-id[=style]
+  std::string m_BuildIDValue;   // --build-id=0x<hex>
+  std::string m_PatchKey;
   std::string m_Filter;
   AuxiliaryList m_AuxiliaryList;
   ExcludeLIBS m_ExcludeLIBS;
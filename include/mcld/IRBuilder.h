@@ -33,6 +33,12 @@ class InputTree;
 class LinkerConfig;
 class Module;
 
+/// GetELFSectionKind - the kind of an input ELF section by its type, name and
+/// flags
+LDFileFormat::Kind GetELFSectionKind(uint32_t pType,
+                                     const char* pName,
+                                     uint32_t pFlag);
+
 /** \class IRBuilder
  *  \brief IRBuilder provides an uniform API for creating sections and
  *  inserting them into a input file.
@@ -381,7 +387,22 @@ class IRBuilder {
   /// @return The added symbol. If the insertion fails due to the resoluction,
   /// return NULL.
   LDSymbol* AddSymbol(Input& pInput,
-                      const std::string& pName,
+                      const llvm::StringRef& pName,
+                      ResolveInfo::Type pType,
+                      ResolveInfo::Desc pDesc,
+                      ResolveInfo::Binding pBind,
+                      ResolveInfo::SizeType pSize,
+                      LDSymbol::ValueType pValue = 0x0,
+                      LDSection* pSection = NULL,
+                      ResolveInfo::Visibility pVis = ResolveInfo::Default);
+
+  /// AddSymbol - To add a symbol whose hash value pHash has been computed by
+  /// NamePool::Hash(), e.g., while the input was being read. pName is not
+  /// copied unless the symbol goes to the output, so it may point into the
+  /// string table of the input.
+  LDSymbol* AddSymbol(Input& pInput,
+                      const llvm::StringRef& pName,
+                      uint32_t pHash,
                       ResolveInfo::Type pType,
                       ResolveInfo::Desc pDesc,
                       ResolveInfo::Binding pBind,
@@ -456,7 +477,8 @@ class IRBuilder {
   bool shouldForceLocal(const ResolveInfo& pInfo, const LinkerConfig& pConfig);
 
  private:
-  LDSymbol* addSymbolFromObject(const std::string& pName,
+  LDSymbol* addSymbolFromObject(const llvm::StringRef& pName,
+                                uint32_t pHash,
                                 ResolveInfo::Type pType,
                                 ResolveInfo::Desc pDesc,
                                 ResolveInfo::Binding pBinding,
@@ -466,7 +488,8 @@ class IRBuilder {
                                 ResolveInfo::Visibility pVisibility);
 
   LDSymbol* addSymbolFromDynObj(Input& pInput,
-                                const std::string& pName,
+                                const llvm::StringRef& pName,
+                                uint32_t pHash,
                                 ResolveInfo::Type pType,
                                 ResolveInfo::Desc pDesc,
                                 ResolveInfo::Binding pBinding,
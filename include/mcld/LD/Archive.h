@@ -15,6 +15,8 @@
 #include "mcld/ADT/StringHash.h"
 #include "mcld/Support/GCFactory.h"
 
+#include <llvm/ADT/StringMap.h>
+
 #include <string>
 #include <vector>
 
@@ -186,6 +188,10 @@ class Archive {
                  uint32_t pFileOffset,
                  enum Symbol::Status pStatus = Archive::Symbol::Unknown);
 
+  /// findSymbol - find the first symtab entry of the given name
+  /// @param pSymIdx - the index of the symtab entry if found
+  bool findSymbol(const llvm::StringRef& pName, size_t& pSymIdx) const;
+
   /// getSymbolName - get the symbol name with the given index
   const std::string& getSymbolName(size_t pSymIdx) const;
 
@@ -198,6 +204,14 @@ class Archive {
   /// setSymbolStatus - set the status of a symbol
   void setSymbolStatus(size_t pSymIdx, enum Symbol::Status pStatus);
 
+  /// getUndefCursor - get the number of the undefined symbols in the
+  /// NamePool that have been looked up in this archive
+  size_t getUndefCursor() const;
+
+  /// setUndefCursor - set the number of the undefined symbols in the
+  /// NamePool that have been looked up in this archive
+  void setUndefCursor(size_t pCursor);
+
   /// getStrTable - get the extended name table
   std::string& getStrTable();
 
@@ -229,7 +243,9 @@ class Archive {
   ArchiveMemberMapType m_ArchiveMemberMap;
   SymbolFactory m_SymbolFactory;
   SymTabType m_SymTab;
+  llvm::StringMap<size_t> m_SymIndex;
   size_t m_SymTabSize;
+  size_t m_UndefCursor;
   std::string m_StrTab;
   InputBuilder& m_Builder;
 };
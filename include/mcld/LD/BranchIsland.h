@@ -74,6 +74,11 @@ class BranchIsland {
   const_reloc_iterator reloc_end() const { return m_Relocations.end(); }
 
   /// observers
+  /// getParent - the section data the island is in
+  SectionData* getParent() { return m_Entry.getParent(); }
+
+  const SectionData* getParent() const { return m_Entry.getParent(); }
+
   uint64_t offset() const;
 
   size_t size() const;
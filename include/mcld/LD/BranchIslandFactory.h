@@ -14,14 +14,23 @@
 
 #include <llvm/Support/DataTypes.h>
 
+#include <map>
+#include <utility>
+#include <vector>
+
 namespace mcld {
 
 class Fragment;
-class Module;
+class SectionData;
 
 /** \class BranchIslandFactory
- *  \brief
+ *  \brief BranchIslandFactory produces the branch islands and finds the
+ *  islands a branch can reach.
  *
+ *  Every section is grouped on its own, and a branch only uses the islands
+ *  in its own section. The islands of a section are produced in the order
+ *  of their offsets, and stay in that order when stubs are inserted, so
+ *  getIslands() finds them by binary search.
  */
 class BranchIslandFactory : public GCFactory<BranchIsland, 0> {
  public:
@@ -36,20 +45,29 @@ class BranchIslandFactory : public GCFactory<BranchIsland, 0> {
 
   ~BranchIslandFactory();
 
-  /// group - group fragments and create islands when needed
+  /// group - group fragments and create islands when needed. Each island is
+  /// placed as far as the branches before it can reach, so the section gets
+  /// the fewest islands.
   /// @param pSectionData - the SectionData holds fragments need to be grouped
-  void group(Module& pModule);
+  void group(SectionData& pSectionData);
 
   /// produce - produce a island for the given fragment
   /// @param pFragment - the fragment needs a branch island
   BranchIsland* produce(Fragment& pFragment);
 
-  /// getIsland - find fwd and bwd islands for the fragment
+  /// getIsland - find fwd and bwd islands for the fragment in O(log n)
   /// @param pFragment - the fragment needs a branch island
   /// @return - return the pair of <fwd island, bwd island>
   std::pair<BranchIsland*, BranchIsland*> getIslands(const Fragment& pFragment);
 
  private:
+  typedef std::vector<BranchIsland*> IslandList;
+
+  typedef std::map<const SectionData*, IslandList> IslandMap;
+
+ private:
+  /// m_Islands - the islands of each section in the order of their offsets
+  IslandMap m_Islands;
   int64_t m_MaxFwdBranchRange;
   int64_t m_MaxBwdBranchRange;
   size_t m_MaxIslandSize;
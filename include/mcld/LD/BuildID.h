@@ -0,0 +1,64 @@
+//===- BuildID.h ----------------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MCLD_LD_BUILDID_H_
+#define MCLD_LD_BUILDID_H_
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace mcld {
+
+class FileOutputBuffer;
+class LDSection;
+class LinkerConfig;
+
+/** \class BuildID
+ *  \brief BuildID represents .note.gnu.build-id section.
+ *
+ *  .note.gnu.build-id section format
+ *  uint32_t : namesz (4)
+ *  uint32_t : descsz (size of the build ID)
+ *  uint32_t : type (NT_GNU_BUILD_ID)
+ *  char[4]  : "GNU\0"
+ *  uint8_t[descsz] : the build ID
+ *
+ *  The digest styles (fast, md5 and sha1) hash the output in fixed-size
+ *  chunks on the worker threads, and then hash the chunk digests again.
+ */
+class BuildID {
+ public:
+  BuildID(LDSection& pSection, const LinkerConfig& pConfig);
+
+  ~BuildID();
+
+  /// sizeOutput - size the note according to the --build-id style
+  void sizeOutput();
+
+  /// emitOutput - write out the note. The digest is computed over the whole
+  /// output with the build ID still zero, so this must be the last write to
+  /// pOutput.
+  void emitOutput(FileOutputBuffer& pOutput);
+
+ private:
+  /// getDescSize - the size of the build ID in bytes
+  size_t getDescSize() const;
+
+  /// computeID - compute the build ID of pSize bytes at pData into pResult
+  void computeID(const uint8_t* pData, size_t pSize, uint8_t* pResult) const;
+
+ private:
+  /// .note.gnu.build-id section
+  LDSection& m_Section;
+
+  const LinkerConfig& m_Config;
+};
+
+}  // namespace mcld
+
+#endif  // MCLD_LD_BUILDID_H_
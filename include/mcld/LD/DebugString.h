@@ -11,7 +11,7 @@
 
 #include "mcld/LD/MergedStringTable.h"
 
-#include <vector>
+#include <unordered_map>
 
 namespace mcld {
 
@@ -34,16 +34,16 @@ class DebugString {
   void merge(LDSection& pSection);
 
   /// computeOffsetSize - set up the output offset of each strings and the
-  /// section size
+  /// section size on up to pThreads threads
   /// @return string table size
-  size_t computeOffsetSize();
+  size_t computeOffsetSize(unsigned pThreads = 1);
 
   /// applyOffset - apply the relocation which refer to debug string. This
   /// should be called after finalizeStringsOffset()
   void applyOffset(Relocation& pReloc, TargetLDBackend& pBackend);
 
   /// emit - emit the section .debug_str
-  void emit(MemoryRegion& pRegion);
+  void emit(MemoryRegion& pRegion, unsigned pThreads = 1);
 
   void setOutputSection(LDSection& pSection)
   { m_pSection = &pSection; }
@@ -57,6 +57,9 @@ class DebugString {
   LDSection* m_pSection;
 
   MergedStringTable m_StringTable;
+
+  /// m_InputMap - map the input .debug_str to its index in m_StringTable
+  std::unordered_map<const LDSection*, size_t> m_InputMap;
 };
 
 }  // namespace mcld
@@ -197,6 +197,10 @@ class ELFFileFormat : public LDFileFormat {
 
   bool hasStackNote() const { return (f_pStackNote != NULL); }
 
+  bool hasNoteGNUBuildID() const {
+    return (f_pNoteGNUBuildID != NULL) && (f_pNoteGNUBuildID->size() != 0);
+  }
+
   bool hasDataRelRoLocal() const {
     return (f_pDataRelRoLocal != NULL) && (f_pDataRelRoLocal->size() != 0);
   }
@@ -599,6 +603,16 @@ class ELFFileFormat : public LDFileFormat {
     return *f_pJCR;
   }
 
+  LDSection& getNoteGNUBuildID() {
+    assert(f_pNoteGNUBuildID != NULL);
+    return *f_pNoteGNUBuildID;
+  }
+
+  const LDSection& getNoteGNUBuildID() const {
+    assert(f_pNoteGNUBuildID != NULL);
+    return *f_pNoteGNUBuildID;
+  }
+
   LDSection& getNoteABITag() {
     assert(f_pNoteABITag != NULL);
     return *f_pNoteABITag;
@@ -724,6 +738,7 @@ class ELFFileFormat : public LDFileFormat {
   LDSection* f_pStackNote;       // .note.GNU-stack
   LDSection* f_pDataRelRoLocal;  // .data.rel.ro.local
   LDSection* f_pGNUHashTab;      // .gnu.hash
+  LDSection* f_pNoteGNUBuildID;  // .note.gnu.build-id
 };
 
 }  // namespace mcld
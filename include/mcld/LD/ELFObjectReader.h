@@ -12,6 +12,10 @@
 #include "mcld/ADT/Flags.h"
 #include "mcld/LD/ObjectReader.h"
 
+#include <map>
+#include <memory>
+#include <mutex>
+
 namespace mcld {
 
 class EhFrameReader;
@@ -44,6 +48,10 @@ class ELFObjectReader : public ObjectReader {
   bool isMyFormat(Input& pFile, bool& pContinue) const;
 
   // -----  readers  ----- //
+  /// prepare - decode the section header table and the symbol table of the
+  /// input. It is safe to call on different inputs concurrently.
+  bool prepare(Input& pFile);
+
   bool readHeader(Input& pFile);
 
   virtual bool readSections(Input& pFile);
@@ -55,6 +63,17 @@ class ELFObjectReader : public ObjectReader {
   /// This function should be called after symbol resolution.
   virtual bool readRelocations(Input& pFile);
 
+ private:
+  struct PreparedInput;
+
+  typedef std::map<const Input*, std::unique_ptr<PreparedInput> > PreparedMap;
+
+  /// findPrepared - return the data prepared for the input, or NULL
+  PreparedInput* findPrepared(const Input& pFile);
+
+  /// dropPrepared - release the data prepared for the input
+  void dropPrepared(const Input& pFile);
+
  private:
   ELFReaderIF* m_pELFReader;
   EhFrameReader* m_pEhFrameReader;
@@ -62,6 +81,8 @@ class ELFObjectReader : public ObjectReader {
   ReadFlag m_ReadFlag;
   GNULDBackend& m_Backend;
   const LinkerConfig& m_Config;
+  PreparedMap m_PreparedInputs;
+  std::mutex m_PreparedMutex;
 };
 
 }  // namespace mcld
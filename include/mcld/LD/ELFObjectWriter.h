@@ -16,6 +16,7 @@
 namespace mcld {
 
 class EhFrame;
+class Fragment;
 class GNULDBackend;
 class LDSection;
 class LinkerConfig;
@@ -36,12 +37,29 @@ class ELFObjectWriter : public ObjectWriter {
 
   std::error_code writeObject(Module& pModule, FileOutputBuffer& pOutput);
 
+  std::error_code writeInputContents(Module& pModule,
+                                     FileOutputBuffer& pOutput);
+
+  std::error_code writeLinkerContents(Module& pModule,
+                                      FileOutputBuffer& pOutput);
+
+  bool isInputContent(const LDSection& pSection) const;
+
   size_t getOutputSize(const Module& pModule) const;
 
  private:
+  /// writeSection - write one section. pThreads is the number of threads
+  /// its fragments may be copied on.
   void writeSection(Module& pModule,
                     FileOutputBuffer& pOutput,
-                    LDSection* section);
+                    LDSection* section,
+                    unsigned pThreads = 1);
+
+  /// writeSections - write the sections for which isInputContent() returns
+  /// pInputContent. The input contents are written on worker threads.
+  void writeSections(Module& pModule,
+                     FileOutputBuffer& pOutput,
+                     bool pInputContent);
 
   const GNULDBackend& target() const { return m_Backend; }
   GNULDBackend& target() { return m_Backend; }
@@ -70,11 +88,14 @@ class ELFObjectWriter : public ObjectWriter {
                     const Module& pModule,
                     FileOutputBuffer& pOutput);
 
-  void emitSectionData(const LDSection& pSection, MemoryRegion& pRegion) const;
+  void emitSectionData(const LDSection& pSection,
+                       MemoryRegion& pRegion,
+                       unsigned pThreads = 1) const;
 
   void emitEhFrame(Module& pModule,
                    EhFrame& pFrame,
-                   MemoryRegion& pRegion) const;
+                   MemoryRegion& pRegion,
+                   unsigned pThreads = 1) const;
 
   void emitRelocation(const LinkerConfig& pConfig,
                       const LDSection& pSection,
@@ -109,7 +130,12 @@ class ELFObjectWriter : public ObjectWriter {
     return 0;
   }
 
-  void emitSectionData(const SectionData& pSD, MemoryRegion& pRegion) const;
+  void emitSectionData(const SectionData& pSD,
+                       MemoryRegion& pRegion,
+                       unsigned pThreads = 1) const;
+
+  /// emitFragment - copy the contents of a fragment to pDest
+  void emitFragment(const Fragment& pFrag, uint8_t* pDest) const;
 
  private:
   GNULDBackend& m_Backend;
@@ -10,6 +10,8 @@
 #define MCLD_LD_ELFREADERIF_H_
 
 #include "mcld/LinkerConfig.h"
+#include "mcld/LD/LDSymbol.h"
+#include "mcld/LD/ResolveInfo.h"
 #include "mcld/Support/MsgHandling.h"
 #include "mcld/Target/GNULDBackend.h"
 
@@ -17,6 +19,8 @@
 #include <llvm/Support/ELF.h>
 #include <llvm/Support/Host.h>
 
+#include <vector>
+
 namespace mcld {
 
 class IRBuilder;
@@ -28,6 +32,36 @@ class SectionData;
  *  \brief ELFReaderIF provides common interface for all kind of ELF readers.
  */
 class ELFReaderIF {
+ public:
+  /// SectionHeaderEntry - a decoded ELF section header
+  struct SectionHeaderEntry {
+    const char* name;
+    uint32_t type;
+    uint64_t flags;
+    uint64_t offset;
+    uint64_t size;
+    uint32_t link;
+    uint32_t info;
+    uint64_t addralign;
+    uint64_t entsize;
+  };
+
+  /// SymbolEntry - a decoded ELF symbol. The name points into the string
+  /// table of the input, and hash is its NamePool::Hash(); they are
+  /// meaningless for section symbols, whose names come from their sections.
+  struct SymbolEntry {
+    llvm::StringRef name;
+    uint32_t hash;
+    uint64_t value;
+    uint64_t size;
+    uint8_t info;
+    uint8_t other;
+    uint16_t shndx;
+  };
+
+  typedef std::vector<SectionHeaderEntry> SectionHeaderList;
+  typedef std::vector<SymbolEntry> SymbolList;
+
  public:
   explicit ELFReaderIF(GNULDBackend& pBackend) : m_Backend(pBackend) {}
 
@@ -53,17 +87,37 @@ class ELFReaderIF {
   GNULDBackend& target() { return m_Backend; }
 
   /// readSectionHeaders - read ELF section header table and create LDSections
-  virtual bool readSectionHeaders(Input& pInput,
-                                  const void* pELFHeader) const = 0;
+  bool readSectionHeaders(Input& pInput, const void* pELFHeader) const;
+
+  /// decodeSectionHeaders - decode ELF section header table into
+  /// host-endian entries. This only reads the input file and does not touch
+  /// the Module, so it may run concurrently on different inputs.
+  virtual bool decodeSectionHeaders(Input& pInput,
+                                    const void* pELFHeader,
+                                    SectionHeaderList& pHeaders) const = 0;
+
+  /// createSections - create LDSections from the decoded section headers
+  bool createSections(Input& pInput, const SectionHeaderList& pHeaders) const;
 
   /// readRegularSection - read a regular section and create fragments.
   virtual bool readRegularSection(Input& pInput, SectionData& pSD) const = 0;
 
   /// readSymbols - read ELF symbols and create LDSymbol
-  virtual bool readSymbols(Input& pInput,
-                           IRBuilder& pBuilder,
-                           llvm::StringRef pRegion,
-                           const char* StrTab) const = 0;
+  bool readSymbols(Input& pInput,
+                   IRBuilder& pBuilder,
+                   llvm::StringRef pRegion,
+                   const char* pStrTab) const;
+
+  /// decodeSymbols - decode ELF symbol table into host-endian entries. Like
+  /// decodeSectionHeaders(), it may run concurrently on different inputs.
+  virtual void decodeSymbols(llvm::StringRef pRegion,
+                             const char* pStrTab,
+                             SymbolList& pSymbols) const = 0;
+
+  /// addSymbols - create LDSymbols from the decoded symbols and resolve them
+  bool addSymbols(Input& pInput,
+                  IRBuilder& pBuilder,
+                  const SymbolList& pSymbols) const;
 
   /// readSignature - read a symbol from the given Input and index in symtab
   /// This is used to get the signature of a group section.
@@ -94,6 +148,27 @@ class ELFReaderIF {
 
   typedef std::vector<LinkInfo> LinkInfoList;
 
+  /// AliasInfo - a symbol of a dynamic object which may alias a weak symbol.
+  struct AliasInfo {
+    LDSymbol* pt_alias;  /// potential alias
+    uint64_t ld_value;
+    ResolveInfo::Binding ld_binding;
+  };
+
+  /// comparison function to sort symbols for analyzing weak alias.
+  /// sort symbols by symbol value and then weak before strong.
+  static bool less(AliasInfo p1, AliasInfo p2) {
+    if (p1.ld_value != p2.ld_value)
+      return (p1.ld_value < p2.ld_value);
+    if (p1.ld_binding != p2.ld_binding) {
+      if (ResolveInfo::Weak == p1.ld_binding)
+        return true;
+      else if (ResolveInfo::Weak == p2.ld_binding)
+        return false;
+    }
+    return p1.pt_alias->str() < p2.pt_alias->str();
+  }
+
  protected:
   ResolveInfo::Type getSymType(uint8_t pInfo, uint16_t pShndx) const;
 
@@ -67,11 +67,6 @@ class GNUArchiveReader : public ArchiveReader {
   /// readStringTable - read the strtab for long file name of the archive
   bool readStringTable(Archive& pArchive);
 
-  /// shouldIncludeSymbol - given a sym name from armap and check if we should
-  /// include the corresponding archive member, and then return the decision
-  enum Archive::Symbol::Status shouldIncludeSymbol(
-      const llvm::StringRef& pSymName) const;
-
   /// includeMember - include the object member in the given file offset, and
   /// return the size of the object
   /// @param pConfig - LinkerConfig
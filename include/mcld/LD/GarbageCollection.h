@@ -9,8 +9,12 @@
 #ifndef MCLD_LD_GARBAGECOLLECTION_H_
 #define MCLD_LD_GARBAGECOLLECTION_H_
 
+#include <atomic>
 #include <map>
 #include <set>
+#include <stdint.h>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace mcld {
@@ -18,10 +22,18 @@ namespace mcld {
 class LDSection;
 class LinkerConfig;
 class Module;
+class ResolveInfo;
 class TargetLDBackend;
 
 /** \class GarbageCollection
  *  \brief Implementation of garbage collection for --gc-section.
+ *
+ *  The input sections are numbered and the references between them are kept
+ *  as a flat graph in compressed sparse row form, which is built per input
+ *  in parallel. The mark phase walks the graph on the --threads workers with
+ *  an atomic bitset and work-stealing worklists. The sections are stripped
+ *  in the input order, so the output of --print-gc-sections does not depend
+ *  on the number of threads.
  */
 class GarbageCollection {
  public:
@@ -49,6 +61,12 @@ class GarbageCollection {
    private:
     typedef std::map<const LDSection*, SectionListTy> ReachedSectionsTy;
 
+   public:
+    typedef ReachedSectionsTy::const_iterator const_iterator;
+
+    const_iterator begin() const { return m_ReachedSections.begin(); }
+    const_iterator end() const { return m_ReachedSections.end(); }
+
    private:
     /// m_ReachedSections - map a section to the reachable sections list
     ReachedSectionsTy m_ReachedSections;
@@ -64,18 +82,50 @@ class GarbageCollection {
   bool run();
 
  private:
+  typedef std::vector<std::pair<uint32_t, uint32_t> > EdgeListTy;
+
+ private:
+  void numberSections();
   void setUpReachedSections();
+  void collectReferences(size_t pInput, EdgeListTy& pEdges) const;
+
+  /// addReference - add the reference from the section pFrom to the section
+  /// that defines pSym, if the reference concerns gc
+  void addReference(int64_t pFrom,
+                    const ResolveInfo* pSym,
+                    EdgeListTy& pEdges) const;
   void findReferencedSections(SectionVecTy& pEntry);
   void getEntrySections(SectionVecTy& pEntry);
   void stripSections();
 
+  /// getIndex - get the index of the input section, return -1 if pSection
+  /// is not an input section of the objects
+  int64_t getIndex(const LDSection& pSection) const;
+
+  /// mark - mark the section as referenced
+  /// @return false if the section has been marked
+  bool mark(uint32_t pIdx);
+
+  bool isMarked(uint32_t pIdx) const;
+
  private:
   /// m_SectionReachedListMap - map the section to the list of sections which it
-  /// can reach directly
+  /// can reach directly. It holds the references set up by the target.
   SectionReachedListMap m_SectionReachedListMap;
 
-  /// m_ReferencedSections - a list of sections which can be reached from entry
-  SectionListTy m_ReferencedSections;
+  /// m_Sections - the input sections. The sections of an input are numbered
+  /// consecutively from m_InputBase of the input
+  SectionVecTy m_Sections;
+  std::vector<uint32_t> m_InputBase;
+  std::unordered_map<const LDSection*, uint32_t> m_SectionIndex;
+
+  /// m_Reached - the sections reached by m_Sections[i] directly are
+  /// m_Reached[m_ReachedBegin[i]] to m_Reached[m_ReachedBegin[i + 1] - 1]
+  std::vector<uint32_t> m_ReachedBegin;
+  std::vector<uint32_t> m_Reached;
+
+  /// m_Referenced - the bitset of sections which can be reached from entry
+  std::vector<std::atomic<uint64_t> > m_Referenced;
 
   const LinkerConfig& m_Config;
   const TargetLDBackend& m_Backend;
@@ -10,7 +10,9 @@
 #define MCLD_LD_IDENTICALCODEFOLDING_H_
 
 #include <llvm/ADT/MapVector.h>
+#include <llvm/ADT/StringRef.h>
 
+#include <stdint.h>
 #include <string>
 #include <vector>
 
@@ -21,12 +23,22 @@ class LDSection;
 class LinkerConfig;
 class Module;
 class Relocation;
+class ResolveInfo;
 class TargetLDBackend;
 
 /** \class IdenticalCodeFolding
  *  \brief Implementation of identical code folding for --icf=[none|all|safe]
  *  @ref Safe ICF: Pointer Safe and Unwinding Aware Identical Code Folding in
  *       Gold, http://research.google.com/pubs/pub36912.html
+ *
+ *  The constant part of each candidate, i.e., its contents and the
+ *  relocations to the symbols which are not candidates, is hashed once in
+ *  parallel and the candidates are grouped into constant classes. Then every
+ *  iteration groups the candidates by their constant class and the kept
+ *  sections of the candidates they refer to, until nothing is folded any
+ *  more or --icf-iterations is reached. Every iteration reads the kept
+ *  sections of the previous one, so the result does not depend on the
+ *  number of threads.
  */
 class IdenticalCodeFolding {
  public:
@@ -36,22 +48,59 @@ class IdenticalCodeFolding {
  private:
   class FoldingCandidate {
    public:
-    FoldingCandidate() : sect(NULL), reloc_sect(NULL), obj(NULL) {}
+    /** \class ConstantReloc
+     *  \brief the constant part of a relocation of the candidate
+     */
+    struct ConstantReloc {
+      enum Kind {
+        Symbol,    // refers to a symbol which is not a candidate
+        Self,      // refers to the candidate itself
+        Variable   // refers to another candidate
+      };
+
+      Kind kind;
+      uint32_t type;
+      uint64_t symValue;
+      uint64_t addend;
+      uint64_t place;
+
+      /// the referred symbol and, for a local symbol, its input
+      const ResolveInfo* sym;
+      const Input* obj;
+
+      bool operator==(const ConstantReloc& pOther) const;
+    };
+
+   public:
+    FoldingCandidate() : sect(NULL), reloc_sect(NULL), obj(NULL), hash(0) {}
     FoldingCandidate(LDSection* pCode, LDSection* pReloc, Input* pInput)
-        : sect(pCode), reloc_sect(pReloc), obj(pInput) {}
+        : sect(pCode), reloc_sect(pReloc), obj(pInput), hash(0) {}
 
     void initConstantContent(
         const TargetLDBackend& pBackend,
         const IdenticalCodeFolding::KeptSections& pKeptSections);
-    std::string getContentWithVariables(
-        const TargetLDBackend& pBackend,
-        const IdenticalCodeFolding::KeptSections& pKeptSections);
+
+    /// isConstantEqual - check if the constant parts are identical
+    bool isConstantEqual(const FoldingCandidate& pOther) const;
 
     LDSection* sect;
     LDSection* reloc_sect;
     Input* obj;
-    std::string content;
-    std::vector<Relocation*> variable_relocs;
+
+    /// the contents of the candidate. It refers to the input region, unless
+    /// the candidate has several region fragments which are joined into
+    /// m_Joined.
+    llvm::StringRef content;
+    std::vector<ConstantReloc> relocs;
+
+    /// the indices of the candidates referred by the Variable relocations
+    std::vector<size_t> variables;
+
+    /// the hash of the constant part
+    uint64_t hash;
+
+   private:
+    std::string m_Joined;
   };
 
   typedef std::vector<FoldingCandidate> FoldingCandidates;
@@ -66,6 +115,9 @@ class IdenticalCodeFolding {
  private:
   void findCandidates(FoldingCandidates& pCandidateList);
 
+  /// matchCandidates - fold the candidates whose constant class and
+  /// referred kept sections are identical
+  /// @return true if nothing has been changed
   bool matchCandidates(FoldingCandidates& pCandidateList);
 
  private:
@@ -73,6 +125,13 @@ class IdenticalCodeFolding {
   const TargetLDBackend& m_Backend;
   Module& m_Module;
   KeptSections m_KeptSections;
+
+  /// m_ConstantClass - the index of the first candidate whose constant part
+  /// is identical to the candidate
+  std::vector<size_t> m_ConstantClass;
+
+  /// m_Kept - the index of the kept candidate of each candidate
+  std::vector<size_t> m_Kept;
 };
 
 }  // namespace mcld
@@ -0,0 +1,121 @@
+//===- InputCache.h -------------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MCLD_LD_INPUTCACHE_H_
+#define MCLD_LD_INPUTCACHE_H_
+
+#include "mcld/LD/ELFReaderIf.h"
+
+#include <llvm/ADT/StringMap.h>
+
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mcld {
+
+class Input;
+class MemoryArea;
+
+namespace sys {
+namespace fs {
+class Path;
+}  // namespace fs
+}  // namespace sys
+
+/** \class InputCache
+ *  \brief InputCache keeps the input files and their parsed tables between
+ *  the links of a long-lived linker process, e.g., ld.mcld --server.
+ *
+ *  An entry is keyed by the path of a file, and stays valid as long as the
+ *  file has the same device, inode, modification time, status change time
+ *  and size. It holds the content of the file, the archive symbol map of an
+ *  archive and the decoded .dynsym of a shared object. The readers fill an
+ *  entry on the first link that reads the file, and the following links
+ *  reuse it. Since an entry is exactly what the readers would parse from the
+ *  file, a link produces the same output with or without the cache.
+ *
+ *  The cache is disabled unless Enable() is called, and it is not
+ *  thread-safe: the links that use it must run one after another.
+ */
+class InputCache {
+ public:
+  struct ArchiveSymbol {
+    std::string name;
+    uint32_t offset;
+  };
+
+  typedef std::vector<ArchiveSymbol> ArchiveSymbolList;
+
+  struct Entry {
+    Entry();
+
+    ~Entry();
+
+    /// the identity of the file when it was cached
+    uint64_t device;
+    uint64_t inode;
+    uint64_t mtime;
+    uint64_t ctime;
+    uint64_t size;
+
+    MemoryArea* area;
+
+    /// the archive symbol map (armap) and its size
+    bool hasArchiveSymbols;
+    size_t archiveSymTabSize;
+    ArchiveSymbolList archiveSymbols;
+
+    /// the decoded .dynsym of a shared object
+    bool hasDynSymbols;
+    ELFReaderIF::SymbolList dynSymbols;
+  };
+
+ public:
+  /// Get - get the cache of this process. Return NULL if it is disabled.
+  static InputCache* Get();
+
+  /// Enable - enable the cache of this process.
+  static void Enable();
+
+  /// getMemoryArea - get the content of the file pPath. Return NULL if the
+  /// file cannot be read, and leave the error to the caller.
+  MemoryArea* getMemoryArea(const sys::fs::Path& pPath);
+
+  /// lookup - get the entry of pInput. Return NULL if pInput is not a whole
+  /// file read through getMemoryArea(), e.g., an archive member.
+  Entry* lookup(const Input& pInput);
+
+  /// isCached - whether pArea is owned by the cache
+  bool isCached(const MemoryArea* pArea) const;
+
+  size_t size() const { return m_Entries.size(); }
+
+  /// clear - drop all entries. The links that use them must have finished.
+  void clear();
+
+ private:
+  InputCache();
+
+  ~InputCache();
+
+  void erase(Entry* pEntry);
+
+ private:
+  typedef llvm::StringMap<Entry*> EntryMapTy;
+  typedef std::unordered_map<const MemoryArea*, Entry*> AreaMapTy;
+
+ private:
+  EntryMapTy m_Entries;
+  AreaMapTy m_AreaMap;
+};
+
+}  // namespace mcld
+
+#endif  // MCLD_LD_INPUTCACHE_H_
@@ -9,18 +9,17 @@
 #ifndef MCLD_LD_LDCONTEXT_H_
 #define MCLD_LD_LDCONTEXT_H_
 
+#include "mcld/ADT/StringHash.h"
 #include "mcld/LD/LDFileFormat.h"
 
+#include <llvm/ADT/StringRef.h>
 #include <llvm/Support/DataTypes.h>
 
 #include <cassert>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
-namespace llvm {
-class StringRef;
-}  // namespace llvm
-
 namespace mcld {
 
 class LDSymbol;
@@ -81,12 +80,18 @@ class LDContext {
   const_sect_iterator relocSectEnd() const { return m_RelocSections.end(); }
   sect_iterator relocSectEnd() { return m_RelocSections.end(); }
 
+ private:
+  typedef std::unordered_map<llvm::StringRef,
+                             size_t,
+                             hash::StringHash<hash::DJB> > SectionIndex;
+
  private:
   SectionTable m_SectionTable;
   SymbolTable m_SymTab;
   SectionTable m_RelocSections;
 
-  // FIXME : maintain a map<section name, section index>
+  /// the index of the first section of each name
+  SectionIndex m_SectionIndex;
 };
 
 }  // namespace mcld
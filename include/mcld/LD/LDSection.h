@@ -104,6 +104,11 @@ class LDSection {
 
   size_t index() const { return m_Index; }
 
+  /// entSize - the size of each entry for sections holding a table of
+  /// fixed-size entries, e.g., the mergeable constants and strings.
+  ///   In ELF, it is sh_entsize.
+  uint64_t entSize() const { return m_EntSize; }
+
   /// getLink - return the Link. When a section A needs the other section B
   /// during linking or loading, we say B is A's Link section.
   /// In ELF, InfoLink section control the ElfNN_Shdr::sh_link and sh_info.
@@ -129,6 +134,8 @@ class LDSection {
 
   void setType(uint32_t type) { m_Type = type; }
 
+  void setEntSize(uint64_t pEntSize) { m_EntSize = pEntSize; }
+
   // -----  SectionData  ----- //
   const SectionData* getSectionData() const { return m_Data.sect_data; }
   SectionData* getSectionData() { return m_Data.sect_data; }
@@ -189,6 +196,7 @@ class LDSection {
   uint64_t m_Offset;
   uint64_t m_Addr;
   uint32_t m_Align;
+  uint64_t m_EntSize;
 
   size_t m_Info;
   LDSection* m_pLink;
@@ -110,6 +110,22 @@ class LDSymbol {
 
   bool hasFragRef() const;
 
+  /// hasDynHashes - whether the hash values of the name in .gnu.hash and
+  /// .hash have been computed
+  bool hasDynHashes() const { return m_SysVHash != NoHash; }
+
+  /// gnuHash - the hash value of the name in .gnu.hash
+  uint32_t gnuHash() const {
+    assert(hasDynHashes());
+    return m_GNUHash;
+  }
+
+  /// sysvHash - the hash value of the name in .hash
+  uint32_t sysvHash() const {
+    assert(hasDynHashes());
+    return m_SysVHash;
+  }
+
   // -----  modifiers  ----- //
   void setSize(SizeType pSize) {
     assert(m_pResolveInfo != NULL);
@@ -122,6 +138,16 @@ class LDSymbol {
 
   void setResolveInfo(const ResolveInfo& pInfo);
 
+  void setDynHashes(uint32_t pGNUHash, uint32_t pSysVHash) {
+    m_GNUHash = pGNUHash;
+    m_SysVHash = pSysVHash;
+  }
+
+ private:
+  /// The ELF hash never sets the high four bits, so this is not a hash value
+  /// of .hash.
+  static const uint32_t NoHash = 0xFFFFFFFF;
+
  private:
   friend class Chunk<LDSymbol, MCLD_SYMBOLS_PER_INPUT>;
   template <class T>
@@ -136,6 +162,8 @@ class LDSymbol {
   ResolveInfo* m_pResolveInfo;
   FragmentRef* m_pFragRef;
   ValueType m_Value;
+  uint32_t m_GNUHash;
+  uint32_t m_SysVHash;
 };
 
 }  // namespace mcld
@@ -0,0 +1,144 @@
+//===- LinkState.h --------------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MCLD_LD_LINKSTATE_H_
+#define MCLD_LD_LINKSTATE_H_
+
+#include <llvm/ADT/StringRef.h>
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace mcld {
+
+class FileOutputBuffer;
+class LinkerConfig;
+class Module;
+class Relocator;
+
+/** \class LinkState
+ *  \brief LinkState is the link-state file that --patch-identical-layout
+ *  keeps next to the output, i.e., <output>.mcld-state.
+ *
+ *  The file records the command line, the identity of the output and of
+ *  every input file, and where each section of the relocatable objects is
+ *  placed in the output. A section is patchable if the output has it as one
+ *  verbatim copy except some fixup ranges, i.e., the fields of its
+ *  relocations and the bytes that the link has rewritten.
+ *
+ *  On the next link with the same command line, an object whose section
+ *  headers, symbol table, relocations and other sections are unchanged, and
+ *  whose patchable sections have the same bytes in their fixup ranges, links
+ *  to the same output except the other bytes of its patchable sections. A
+ *  copy of the output is then patched and replaces the output instead of a
+ *  relink. Any other change needs a full link, which writes a new state
+ *  file.
+ *
+ *  This is byte patching of an identical layout, not an incremental link:
+ *  the output has no slack for a section to grow, and no symbol is resolved
+ *  and no relocation is applied again.
+ */
+class LinkState {
+ public:
+  /// Stamp - the identity of a file. The modification time alone may be too
+  /// coarse to tell two writes apart and can be set back, while any write or
+  /// replacement of the file changes its status change time or its inode.
+  struct Stamp {
+    uint64_t size;
+    uint64_t mtime;
+    uint64_t inode;
+    uint64_t ctime;
+
+    bool operator==(const Stamp& pOther) const {
+      return size == pOther.size && mtime == pOther.mtime &&
+             inode == pOther.inode && ctime == pOther.ctime;
+    }
+  };
+
+  /// Range - a range of bytes in a section
+  struct Range {
+    uint64_t offset;
+    uint64_t size;
+  };
+
+  typedef std::vector<Range> RangeList;
+
+  /// Placement - the placement of a patchable section in the output
+  struct Placement {
+    unsigned index;
+    /// whether the output has the section
+    bool placed;
+    /// the file offset of the section in the output
+    uint64_t offset;
+    /// the hash of the bytes of the section in its fixup ranges
+    uint64_t fixupHash;
+    RangeList fixups;
+  };
+
+  typedef std::vector<Placement> PlacementList;
+
+  struct File {
+    std::string path;
+    Stamp stamp;
+    uint64_t hash;
+    /// whether the file is a relocatable object that can be patched
+    bool isObject;
+    /// the hash of all but the patchable sections of the object
+    uint64_t structHash;
+    PlacementList sections;
+  };
+
+  typedef std::vector<File> FileList;
+
+ public:
+  LinkState();
+
+  /// Path - the path of the state file of the output pOutput
+  static std::string Path(llvm::StringRef pOutput);
+
+  /// IsSupported - whether a link of pConfig can be patched.
+  /// The outputs that depend on the contents of all sections, e.g., the ones
+  /// with --build-id or --icf, are always linked in full.
+  static bool IsSupported(const LinkerConfig& pConfig);
+
+  /// Remove - remove the state file of pOutput, if any
+  static void Remove(llvm::StringRef pOutput);
+
+  /// Patch - bring the output pOutput of the previous link up to date if
+  /// the changes of the inputs can be patched.
+  /// @return true if the output is up to date.
+  static bool Patch(const LinkerConfig& pConfig, llvm::StringRef pOutput);
+
+  /// record - record the state of the link of pModule, whose output has been
+  /// emitted to pOutput
+  bool record(const Module& pModule,
+              const LinkerConfig& pConfig,
+              const Relocator& pRelocator,
+              FileOutputBuffer& pOutput);
+
+  /// write - write the state file of the output pOutput, which has been
+  /// closed.
+  bool write(llvm::StringRef pOutput);
+
+  const FileList& files() const { return m_Files; }
+
+ private:
+  bool read(const std::string& pPath);
+
+  bool patch(const LinkerConfig& pConfig, llvm::StringRef pOutput);
+
+ private:
+  uint64_t m_Key;
+  Stamp m_Output;
+  FileList m_Files;
+};
+
+}  // namespace mcld
+
+#endif  // MCLD_LD_LINKSTATE_H_
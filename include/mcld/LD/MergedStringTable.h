@@ -11,52 +11,119 @@
 
 #include "mcld/Support/MemoryRegion.h"
 
-#include <llvm/ADT/StringMap.h>
 #include <llvm/ADT/StringRef.h>
 
+#include <cstddef>
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
 namespace mcld {
 
 /** \class MergedStringTable
  *  \brief MergedStringTable represents the mergeable string table. The sections
  *  with flag SHF_MERGED and SHF_STRING are mergeable. Every string in
  *  MergedStringTable is unique.
+ *
+ *  The strings of each input are split and hashed in parallel, and inserted
+ *  into NumShards hash-partitioned shards, each of which is filled by one
+ *  thread. The offsets are assigned shard by shard, and every input keeps
+ *  the output offsets of its strings, so the output offset of an input
+ *  string is looked up by its input offset instead of by its content. The
+ *  result does not depend on the number of threads.
  */
 class MergedStringTable {
  public:
-  typedef llvm::StringMap<size_t> StringMapTy;
+  enum { NumShards = 32 };
 
  public:
-  MergedStringTable() {}
+  MergedStringTable() : m_Size(0) {}
 
-  /// insertString - insert a string to the string table
-  /// @return false if the string already exists in the map.
-  bool insertString(llvm::StringRef pString);
+  /// addStrings - add the null-terminated strings of an input section. The
+  /// strings are not copied, pStrings should live until emit.
+  /// @return the index of the input in this table
+  size_t addStrings(llvm::StringRef pStrings);
 
-  /// finalizeOffset - finalize the output offset of strings. After this
-  /// function been called, any string should not be added to this table
+  /// finalizeOffset - finalize the output offset of strings on up to
+  /// pThreads threads. After this function been called, any string should
+  /// not be added to this table
   /// @return the section size
-  uint64_t finalizeOffset();
+  uint64_t finalizeOffset(unsigned pThreads = 1);
 
   /// emit - emit the string table
-  void emit(MemoryRegion& pRegion);
+  void emit(MemoryRegion& pRegion, unsigned pThreads = 1) const;
 
   /// ----- observers -----///
-  /// getOutputOffset - get the output offset of the string. This should be
-  /// called after finalizeOffset.
-  size_t getOutputOffset(llvm::StringRef pStr);
+  /// getOutputOffset - get the output offset of the string at pOffset in
+  /// the input pInput. pOffset may point into the middle of a string. This
+  /// should be called after finalizeOffset.
+  uint64_t getOutputOffset(size_t pInput, uint64_t pOffset) const;
+
+  size_t numOfInputs() const { return m_Inputs.size(); }
+
+ private:
+  /** \class Input
+   *  \brief the strings of an input section
+   */
+  struct Input {
+    llvm::StringRef strings;
+
+    /// the input offset, the hash and the output offset of each string. The
+    /// hashes are released after the offsets are finalized.
+    std::vector<uint64_t> offsets;
+    std::vector<uint64_t> hashes;
+    std::vector<uint64_t> outOffsets;
+
+    /// the indices of the strings that fall into each shard
+    std::vector<std::vector<uint32_t> > shardStrings;
+
+    llvm::StringRef getString(size_t pIdx) const;
+  };
+
+  struct Key {
+    llvm::StringRef str;
+    uint64_t hash;
+
+    bool operator==(const Key& pOther) const {
+      return hash == pOther.hash && str == pOther.str;
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& pKey) const { return pKey.hash; }
+  };
+
+  /** \class Shard
+   *  \brief the unique strings whose hash falls into the shard
+   */
+  struct Shard {
+    /// map the string to its offset in the shard
+    std::unordered_map<Key, uint64_t, KeyHash> map;
+
+    /// the unique strings in offset order
+    std::vector<llvm::StringRef> strings;
+
+    uint64_t size;
+    uint64_t base;
+
+    Shard() : size(0), base(0) {}
+  };
 
  private:
-  typedef StringMapTy::iterator string_map_iterator;
-  typedef StringMapTy::const_iterator const_string_map_iterator;
+  /// split - split the strings of the input and hash them
+  static void split(Input& pInput);
+
+  /// insert - insert the strings of all inputs that fall into the shard.
+  /// Strings are visited in input order, so the offsets do not depend on
+  /// the number of threads.
+  void insert(size_t pShard);
 
  private:
-  /// m_StringMap - the string pool of this section. It maps the string to the
-  /// output offset. The key of this map is the string, and the value is output
-  /// offset
-  StringMapTy m_StringMap;
+  std::vector<Input> m_Inputs;
+  std::vector<Shard> m_Shards;
+  uint64_t m_Size;
 };
 
 }  // namespace mcld
 
 #endif  // MCLD_LD_MERGEDSTRINGTABLE_H_
-
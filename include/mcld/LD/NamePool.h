@@ -20,6 +20,7 @@
 #include <llvm/ADT/StringRef.h>
 
 #include <utility>
+#include <vector>
 
 namespace mcld {
 
@@ -38,6 +39,8 @@ class NamePool {
   typedef FreeInfoSet::iterator freeinfo_iterator;
   typedef FreeInfoSet::const_iterator const_freeinfo_iterator;
 
+  typedef std::vector<const ResolveInfo*> UndefList;
+
   typedef size_t size_type;
 
  public:
@@ -74,6 +77,21 @@ class NamePool {
                     ResolveInfo* pOldInfo,
                     Resolver::Result& pResult);
 
+  /// insertSymbol - insert a symbol whose hash value pHash has been computed
+  /// by Hash(), e.g., while the input was being read. The name is copied
+  /// only if the symbol is new to the pool.
+  void insertSymbol(const llvm::StringRef& pName,
+                    uint32_t pHash,
+                    bool pIsDyn,
+                    ResolveInfo::Type pType,
+                    ResolveInfo::Desc pDesc,
+                    ResolveInfo::Binding pBinding,
+                    ResolveInfo::SizeType pSize,
+                    LDSymbol::ValueType pValue,
+                    ResolveInfo::Visibility pVisibility,
+                    ResolveInfo* pOldInfo,
+                    Resolver::Result& pResult);
+
   /// findSymbol - find the resolved output LDSymbol
   const LDSymbol* findSymbol(const llvm::StringRef& pName) const;
   LDSymbol* findSymbol(const llvm::StringRef& pName);
@@ -87,6 +105,11 @@ class NamePool {
   /// @return the StringRef points to the hash table
   llvm::StringRef insertString(const llvm::StringRef& pString);
 
+  /// Hash - the hash value of the symbol name pName in the pool
+  static uint32_t Hash(const llvm::StringRef& pName) {
+    return Table::hasher()(pName);
+  }
+
   // -----  observers  ----- //
   size_type size() const { return m_Table.numOfEntries(); }
 
@@ -113,6 +136,11 @@ class NamePool {
 
   const_freeinfo_iterator freeinfo_end() const { return m_FreeInfoSet.end(); }
 
+  /// getUndefList - the symbols which became undefined and not weak, in the
+  /// order they became so. The list only grows, and the symbols may have
+  /// been defined since, so the readers keep their position in it.
+  const UndefList& getUndefList() const { return m_UndefList; }
+
   // -----  capacity  ----- //
   void reserve(size_type pN);
 
@@ -122,6 +150,7 @@ class NamePool {
   Resolver* m_pResolver;
   Table m_Table;
   FreeInfoSet m_FreeInfoSet;
+  UndefList m_UndefList;
 
  private:
   DISALLOW_COPY_AND_ASSIGN(NamePool);
@@ -33,6 +33,11 @@ class ObjectReader : public LDReader {
  public:
   virtual ~ObjectReader() { f_GroupSignatureMap.clear(); }
 
+  /// prepare - do the part of reading the input that does not touch the
+  /// Module ahead of time. Different inputs may be prepared concurrently;
+  /// readHeader() and readSymbols() then pick up the prepared data.
+  virtual bool prepare(Input& pFile) { return true; }
+
   virtual bool readHeader(Input& pFile) = 0;
 
   virtual bool readSymbols(Input& pFile) = 0;
@@ -13,6 +13,7 @@
 namespace mcld {
 
 class FileOutputBuffer;
+class LDSection;
 class Module;
 
 /** \class ObjectWriter
@@ -28,6 +29,20 @@ class ObjectWriter {
   virtual std::error_code writeObject(Module& pModule,
                                       FileOutputBuffer& pOutput) = 0;
 
+  /// writeInputContents - write only the sections whose contents are copied
+  /// from the input files, e.g., .text, .data and the debug sections.
+  virtual std::error_code writeInputContents(Module& pModule,
+                                             FileOutputBuffer& pOutput) = 0;
+
+  /// writeLinkerContents - write everything writeInputContents() leaves out:
+  /// the sections built by the linker, the name pools and the headers. The
+  /// two together write the same file as writeObject().
+  virtual std::error_code writeLinkerContents(Module& pModule,
+                                              FileOutputBuffer& pOutput) = 0;
+
+  /// isInputContent - check if the section is written by writeInputContents()
+  virtual bool isInputContent(const LDSection& pSection) const = 0;
+
   virtual size_t getOutputSize(const Module& pModule) const = 0;
 };
 
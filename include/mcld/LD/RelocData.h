@@ -20,11 +20,15 @@
 #include <llvm/ADT/ilist_node.h>
 #include <llvm/Support/DataTypes.h>
 
+#include <cassert>
 #include <list>
+#include <vector>
 
 namespace mcld {
 
+class Fragment;
 class LDSection;
+class ResolveInfo;
 
 /** \class RelocData
  *  \brief RelocData stores Relocation.
@@ -32,6 +36,18 @@ class LDSection;
  *  Since Relocations are created by GCFactory, we use GCFactoryListTraits for
  *the
  *  RelocationList here to avoid iplist to delete Relocations.
+ *
+ *  The relocations read from an input are first kept packed, i.e., their
+ *  types, symbols, offsets and addends are in contiguous columns, and the
+ *  passes that only read them iterate the columns by index.
+ *
+ *  Before the fragments of the target section move to the output section,
+ *  the packed relocations are either materialized, i.e., a Relocation is
+ *  created for every entry in order, or bound to their places, if the
+ *  backend neither changes nor keeps them. The bound relocations stay
+ *  packed; they are scanned and applied through a scratch Relocation filled
+ *  by load(), and store() keeps the applied result. The relocation list can
+ *  only be used after materialize().
  */
 class RelocData {
  private:
@@ -63,39 +79,104 @@ class RelocData {
   const LDSection& getSection() const { return *m_pSection; }
   LDSection& getSection() { return *m_pSection; }
 
-  const RelocationListType& getRelocationList() const { return m_Relocations; }
-  RelocationListType& getRelocationList() { return m_Relocations; }
+  const RelocationListType& getRelocationList() const {
+    assert(!hasPacked() && "materialize the packed relocations first");
+    return m_Relocations;
+  }
+  RelocationListType& getRelocationList() {
+    assert(!hasPacked() && "materialize the packed relocations first");
+    return m_Relocations;
+  }
 
-  size_t size() const { return m_Relocations.size(); }
+  size_t size() const { return m_Relocations.size() + m_Types.size(); }
 
-  bool empty() const { return m_Relocations.empty(); }
+  bool empty() const { return m_Relocations.empty() && m_Types.empty(); }
 
   RelocData& append(Relocation& pRelocation);
   Relocation& remove(Relocation& pRelocation);
 
-  const_reference front() const { return m_Relocations.front(); }
-  reference front() { return m_Relocations.front(); }
-  const_reference back() const { return m_Relocations.back(); }
-  reference back() { return m_Relocations.back(); }
+  const_reference front() const { return getRelocationList().front(); }
+  reference front() { return getRelocationList().front(); }
+  const_reference back() const { return getRelocationList().back(); }
+  reference back() { return getRelocationList().back(); }
 
-  const_iterator begin() const { return m_Relocations.begin(); }
-  iterator begin() { return m_Relocations.begin(); }
-  const_iterator end() const { return m_Relocations.end(); }
-  iterator end() { return m_Relocations.end(); }
-  const_reverse_iterator rbegin() const { return m_Relocations.rbegin(); }
-  reverse_iterator rbegin() { return m_Relocations.rbegin(); }
-  const_reverse_iterator rend() const { return m_Relocations.rend(); }
-  reverse_iterator rend() { return m_Relocations.rend(); }
+  const_iterator begin() const { return getRelocationList().begin(); }
+  iterator begin() { return getRelocationList().begin(); }
+  const_iterator end() const { return getRelocationList().end(); }
+  iterator end() { return getRelocationList().end(); }
+  const_reverse_iterator rbegin() const { return getRelocationList().rbegin(); }
+  reverse_iterator rbegin() { return getRelocationList().rbegin(); }
+  const_reverse_iterator rend() const { return getRelocationList().rend(); }
+  reverse_iterator rend() { return getRelocationList().rend(); }
 
   template <class Comparator>
   void sort(Comparator pComparator) {
-    mcld::sort(m_Relocations, pComparator);
+    mcld::sort(getRelocationList(), pComparator);
+  }
+
+  // -----  packed relocations  ----- //
+  /// reserve - reserve the columns for pSize packed relocations
+  void reserve(size_t pSize);
+
+  /// addPacked - add a relocation read from the input. pOffset is the offset
+  /// of the place in the target section.
+  void addPacked(Relocation::Type pType,
+                 ResolveInfo* pSymInfo,
+                 uint32_t pOffset,
+                 Relocation::Address pAddend);
+
+  bool hasPacked() const { return !m_Types.empty(); }
+
+  size_t numOfPacked() const { return m_Types.size(); }
+
+  Relocation::Type getType(size_t pIdx) const { return m_Types[pIdx]; }
+
+  ResolveInfo* getSymInfo(size_t pIdx) const { return m_SymInfos[pIdx]; }
+
+  uint32_t getOffset(size_t pIdx) const { return m_Offsets[pIdx]; }
+
+  Relocation::Address getAddend(size_t pIdx) const { return m_Addends[pIdx]; }
+
+  void setAddend(size_t pIdx, Relocation::Address pAddend) {
+    m_Addends[pIdx] = pAddend;
   }
 
+  /// materialize - create the Relocations of the packed relocations in
+  /// order, and drop the columns. It must not run in a parallel loop.
+  void materialize();
+
+  // -----  bound relocations  ----- //
+  /// bind - find the places of the packed relocations in the target section
+  /// and read their target data. It must run before the fragments of the
+  /// target section move, and not in a parallel loop.
+  void bind();
+
+  bool isBound() const { return !m_Frags.empty(); }
+
+  /// getFrag - the fragment of the place of a bound relocation, or NULL if
+  /// the offset is out of the target section. getOffset() is then the
+  /// offset of the place in the fragment.
+  Fragment* getFrag(size_t pIdx) const { return m_Frags[pIdx]; }
+
+  /// load - fill pReloc with the bound relocation pIdx
+  void load(size_t pIdx, Relocation& pReloc) const;
+
+  /// store - keep the target data of pReloc, which load(pIdx) filled. The
+  /// other fields of a bound relocation must not change.
+  void store(size_t pIdx, const Relocation& pReloc);
+
  private:
   RelocationListType m_Relocations;
   LDSection* m_pSection;
 
+  std::vector<Relocation::Type> m_Types;
+  std::vector<ResolveInfo*> m_SymInfos;
+  std::vector<uint32_t> m_Offsets;
+  std::vector<Relocation::Address> m_Addends;
+
+  std::vector<Fragment*> m_Frags;
+  std::vector<Relocation::DWord> m_Targets;
+
  private:
   DISALLOW_COPY_AND_ASSIGN(RelocData);
 };
@@ -42,6 +42,9 @@ class RelocationFactory
   /// @param pAddend - the addend of the relocation entry
   Relocation* produce(Type pType, FragmentRef& pFragRef, Address pAddend = 0);
 
+  /// readTarget - read the target data at pFragRef, as produce() does
+  DWord readTarget(const FragmentRef& pFragRef) const;
+
   /// produceEmptyEntry - produce an empty relocation which
   /// occupied memory space but all contents set to zero.
   Relocation* produceEmptyEntry();
@@ -15,6 +15,7 @@ namespace mcld {
 
 class Input;
 class IRBuilder;
+class LDSection;
 class Module;
 class TargetLDBackend;
 
@@ -54,6 +55,10 @@ class Relocator {
                               LDSection& pSection,
                               Input& pInput) = 0;
 
+  /// issueApplyResult - Issue the diagnostic for the result of applying a
+  /// relocation, if there is anything to complain about.
+  void issueApplyResult(Relocation& pReloc, Result pResult);
+
   /// issueUndefRefError - Provides a basic version for undefined reference
   /// dump.
   /// It will handle the filename and function name automatically.
@@ -80,6 +85,26 @@ class Relocator {
   /// @return - return true for finalization success
   virtual bool finalizeApply(Input& pInput) { return true; }
 
+  /// mayApplyConcurrently - check if the given reloc can be applied on a
+  /// worker thread at the same time as other relocations. This holds only if
+  /// applying it touches nothing but the relocation itself, e.g., no GOT
+  /// entry and no dynamic relocation. Such relocations may be applied before
+  /// initializeApply() of their input, so a target that keeps apply state per
+  /// input should be conservative and return false.
+  virtual bool mayApplyConcurrently(const Relocation& pReloc) const {
+    return false;
+  }
+
+  /// mayKeepPacked - check if the relocations applied to pSection may stay
+  /// packed, i.e., scanning and applying them neither changes their types,
+  /// symbols and addends nor keeps them, e.g., in a map or a stub. Such
+  /// relocations are scanned and applied through a scratch Relocation.
+  /// Note: Each target relocator should be conservative and return false
+  /// unless it knows so.
+  virtual bool mayKeepPacked(const LDSection& pSection) const {
+    return false;
+  }
+
   /// partialScanRelocation - When doing partial linking, backend can do any
   /// modification to relocation to fix the relocation offset after section
   /// merge
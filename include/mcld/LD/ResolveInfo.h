@@ -36,6 +36,7 @@ class LinkerConfig;
 class ResolveInfo {
   friend class FragmentLinker;
   friend class IRBuilder;
+  friend class NamePool;
 
  public:
   typedef uint64_t SizeType;
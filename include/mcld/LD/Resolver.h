@@ -48,7 +48,8 @@ class Resolver {
   /// shouldOverride - Can resolver override the symbol pOld by the symbol pNew?
   /// @return the action should be taken.
   /// @param pOld the symbol which may be overridden.
-  /// @param pNew the symbol which is used to replace pOld
+  /// @param pNew the symbol which is used to replace pOld. It has the name
+  ///             of pOld, but it may not keep a copy of the name.
   virtual bool resolve(ResolveInfo& __restrict__ pOld,
                        const ResolveInfo& __restrict__ pNew,
                        bool& pOverride,
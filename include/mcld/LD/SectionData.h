@@ -18,12 +18,21 @@
 #include <llvm/ADT/ilist_node.h>
 #include <llvm/Support/DataTypes.h>
 
+#include <utility>
+#include <vector>
+
 namespace mcld {
 
 class LDSection;
 
 /** \class SectionData
  *  \brief SectionData provides a container for all Fragments.
+ *
+ *  SectionData keeps an index of the fragments by their offsets from the
+ *  front, so that a reference to an offset in the section is resolved by
+ *  binary search. The index is built at the first lookup, and dropped when
+ *  the fragments may change, i.e., when the fragment list is accessed for
+ *  writing or a fragment is given a new offset.
  */
 class SectionData {
  private:
@@ -55,7 +64,13 @@ class SectionData {
   LDSection& getSection() { return *m_pSection; }
 
   const FragmentListType& getFragmentList() const { return m_Fragments; }
-  FragmentListType& getFragmentList() { return m_Fragments; }
+
+  /// getFragmentList - the caller may change the fragments, so the offset
+  /// index is dropped
+  FragmentListType& getFragmentList() {
+    invalidateOffsetIndex();
+    return m_Fragments;
+  }
 
   size_t size() const { return m_Fragments.size(); }
 
@@ -75,9 +90,34 @@ class SectionData {
   const_reverse_iterator rend() const { return m_Fragments.rend(); }
   reverse_iterator rend() { return m_Fragments.rend(); }
 
+  /// findFragment - find the fragment at pOffset from the front by the offset
+  /// index. As FragmentRef::Create does, an offset at the end of a fragment
+  /// refers to the start of the next one.
+  /// @param pFrag       - [out] the fragment, or NULL if pOffset is out of the
+  ///                      section
+  /// @param pFragOffset - [out] the offset in pFrag
+  /// @return false if the index can not be built, i.e., an alignment is not
+  ///         laid out yet
+  bool findFragment(uint64_t pOffset, Fragment*& pFrag, uint64_t& pFragOffset);
+
+  /// invalidateOffsetIndex - drop the offset index
+  void invalidateOffsetIndex() {
+    if (!m_OffsetIndex.empty())
+      OffsetIndex().swap(m_OffsetIndex);
+  }
+
+ private:
+  /// the end offset of each fragment from the front, and the fragment
+  typedef std::vector<std::pair<uint64_t, Fragment*> > OffsetIndex;
+
+ private:
+  /// buildOffsetIndex - return false if the size of a fragment is unknown
+  bool buildOffsetIndex();
+
  private:
   FragmentListType m_Fragments;
   LDSection* m_pSection;
+  OffsetIndex m_OffsetIndex;
 
  private:
   DISALLOW_COPY_AND_ASSIGN(SectionData);
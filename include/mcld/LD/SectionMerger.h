@@ -0,0 +1,173 @@
+//===- SectionMerger.h ----------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MCLD_LD_SECTIONMERGER_H_
+#define MCLD_LD_SECTIONMERGER_H_
+
+#include <llvm/ADT/StringRef.h>
+
+#include <cstddef>
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+namespace mcld {
+
+class Fragment;
+class LDSection;
+class LDSymbol;
+class LinkerConfig;
+class Module;
+class RegionFragment;
+class RelocData;
+class Relocation;
+class ResolveInfo;
+
+/** \class SectionMerger
+ *  \brief SectionMerger folds the duplicate strings and constants of the
+ *  mergeable (SHF_MERGE) input sections, e.g., .rodata.str1.1 and
+ *  .rodata.cst8.
+ *
+ *  Every mergeable input section is split into pieces, one per string or
+ *  per sh_entsize bytes of constant, and each piece becomes a fragment of
+ *  its own. After the input sections are merged into the output sections,
+ *  the first piece of each content is kept and the duplicates are removed
+ *  from the output. The symbols defined in the mergeable sections are moved
+ *  to the kept pieces. A relocation that refers to a piece through the
+ *  section symbol and an explicit addend (RELA) gets its addend rewritten
+ *  after layout. With an implicit addend (REL) the addend cannot be
+ *  decoded in a target independent way, so such an input section keeps all
+ *  of its pieces, though the other sections may still share them.
+ *
+ *  The pieces are hashed per input section and deduplicated per hash shard,
+ *  both on the --threads workers. The result does not depend on the number
+ *  of threads.
+ */
+class SectionMerger {
+ public:
+  SectionMerger(const LinkerConfig& pConfig, Module& pModule);
+
+  ~SectionMerger();
+
+  /// split - split the mergeable input sections into pieces. This should be
+  /// called before the input sections are merged into the output sections.
+  void split();
+
+  /// merge - remove the duplicate pieces from the output sections and move
+  /// the symbols to the kept pieces. This should be called after the input
+  /// sections are merged into the output sections.
+  void merge();
+
+  /// rewriteRelocations - rewrite the addends of the relocations that refer
+  /// to a piece through a section symbol. This should be called after
+  /// layout and before applying the relocations.
+  void rewriteRelocations();
+
+ private:
+  /** \class Piece
+   *  \brief Piece is a string or a constant of a mergeable input section.
+   */
+  struct Piece {
+    /// the fragment of this piece
+    RegionFragment* frag;
+
+    /// the offset of this piece in its input section
+    uint64_t offset;
+
+    uint64_t hash;
+
+    /// the kept piece that holds the content of this piece, and the offset
+    /// of the content in it (non-zero only for tail merged strings)
+    Piece* leader;
+    uint64_t leaderOffset;
+  };
+
+  /** \class MergeableSection
+   *  \brief MergeableSection is a mergeable input section and its pieces.
+   */
+  struct MergeableSection {
+    LDSection* section;
+
+    /// the fragment read from the input, replaced by the pieces
+    Fragment* whole;
+
+    std::vector<Piece> pieces;
+
+    /// the index of the group of the output section and piece kind
+    unsigned group;
+
+    /// pinned sections keep all their pieces
+    bool pinned;
+  };
+
+  /** \class SectionSymbolReloc
+   *  \brief A relocation refers to a piece through the section symbol.
+   *  A bound relocation has no Relocation, and is the entry index of data.
+   */
+  struct SectionSymbolReloc {
+    Relocation* reloc;
+    RelocData* data;
+    size_t index;
+    Piece* piece;
+    int64_t offset;  // the offset of the referred location in the piece
+  };
+
+  typedef std::unordered_map<const Fragment*, MergeableSection*> WholeMapTy;
+
+ private:
+  /// isMergeable - check if pSection can be split into pieces
+  bool isMergeable(const LDSection& pSection) const;
+
+  /// splitSection - split pSection into pieces
+  bool splitSection(MergeableSection& pSection) const;
+
+  /// findPiece - find the piece that contains pOffset
+  Piece& findPiece(MergeableSection& pSection, int64_t pOffset) const;
+
+  /// collectRelocations - find the relocations through the section symbols
+  /// of mergeable sections, and pin the sections referred by REL.
+  void collectRelocations();
+
+  /// collectRelocation - record pRecord if the symbol pInfo of its
+  /// relocation refers to a mergeable section
+  void collectRelocation(SectionSymbolReloc pRecord,
+                         const ResolveInfo* pInfo,
+                         int64_t pAddend,
+                         bool pIsRela);
+
+  /// dedupe - pick the leader of every piece
+  void dedupe();
+
+  /// tailMerge - fold the strings that are suffixes of other strings
+  void tailMerge();
+
+  /// removeDuplicates - remove the pieces that are not leaders from the
+  /// output sections and compute the offsets of the rest
+  void removeDuplicates();
+
+  /// moveSymbol - move the symbol to the kept piece
+  void moveSymbol(LDSymbol& pSymbol);
+
+ private:
+  const LinkerConfig& m_Config;
+  Module& m_Module;
+
+  std::vector<MergeableSection*> m_Sections;
+
+  /// m_WholeMap - map the fragment read from the input to its section
+  WholeMapTy m_WholeMap;
+
+  std::vector<SectionSymbolReloc> m_Relocs;
+
+  /// m_Removed - the fragments removed from the output
+  std::vector<Fragment*> m_Removed;
+};
+
+}  // namespace mcld
+
+#endif  // MCLD_LD_SECTIONMERGER_H_
@@ -0,0 +1,102 @@
+//===- StringTableBuilder.h -----------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MCLD_LD_STRINGTABLEBUILDER_H_
+#define MCLD_LD_STRINGTABLEBUILDER_H_
+
+#include "mcld/ADT/StringHash.h"
+#include "mcld/Support/MemoryRegion.h"
+
+#include <llvm/ADT/StringRef.h>
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace mcld {
+
+/** \class StringTableBuilder
+ *  \brief StringTableBuilder builds the ELF string tables of names, i.e.,
+ *  .strtab, .dynstr and .shstrtab.
+ *
+ *  Every name is stored once, and a name that is a suffix of another one,
+ *  e.g., "init" of ".init", is stored as the tail of the longer one. To find
+ *  the suffixes, the names are sorted by their reversed characters with a
+ *  multikey quicksort, in which the names ending with different two
+ *  characters are sorted on different threads. The result does not depend
+ *  on the number of threads.
+ *
+ *  The strings that come after the offsets are finalized, e.g., the names
+ *  of the stubs created by relaxation, are appended to the end of the table
+ *  without merging.
+ */
+class StringTableBuilder {
+ public:
+  StringTableBuilder();
+
+  /// add - add the string pString. The string is not copied, it should live
+  /// until emit.
+  void add(llvm::StringRef pString);
+
+  /// finalizeOffset - merge the strings and assign their offsets on up to
+  /// pThreads threads.
+  /// @return the size of the table
+  size_t finalizeOffset(unsigned pThreads = 1);
+
+  /// append - append a copy of pString to a finalized table, unless the
+  /// table has it already.
+  /// @return the offset of pString
+  size_t append(llvm::StringRef pString);
+
+  /// emit - emit the string table on up to pThreads threads
+  void emit(MemoryRegion& pRegion, unsigned pThreads = 1) const;
+
+  /// clear - remove all strings
+  void clear();
+
+  // -----  observers  ----- //
+  /// hasString - whether the finalized table has pString
+  bool hasString(llvm::StringRef pString) const;
+
+  /// getOffset - the offset of pString in the finalized table. The empty
+  /// string is at offset 0.
+  size_t getOffset(llvm::StringRef pString) const;
+
+  bool isFinalized() const { return m_bFinalized; }
+
+  /// size - the size of the table, including the appended strings
+  size_t size() const { return m_Size; }
+
+ private:
+  typedef std::unordered_map<llvm::StringRef,
+                             size_t,
+                             hash::StringHash<hash::DJB> > OffsetMap;
+
+  typedef std::vector<std::pair<llvm::StringRef, size_t> > StringList;
+
+ private:
+  /// the added strings, which are sorted by finalizeOffset
+  std::vector<llvm::StringRef> m_Strings;
+
+  /// the strings that are emitted and their offsets
+  StringList m_Emitted;
+
+  /// the copies of the appended strings
+  std::deque<std::string> m_Appended;
+
+  OffsetMap m_Offsets;
+  size_t m_Size;
+  bool m_bFinalized;
+};
+
+}  // namespace mcld
+
+#endif  // MCLD_LD_STRINGTABLEBUILDER_H_
@@ -9,7 +9,11 @@
 #ifndef MCLD_LINKER_H_
 #define MCLD_LINKER_H_
 
+#include "mcld/Support/LinkerContext.h"
+
+#include <memory>
 #include <string>
+#include <thread>
 
 namespace mcld {
 
@@ -25,6 +29,9 @@ class TargetLDBackend;
 
 /** \class Linker
 *  \brief Linker is a modular linker.
+*
+*  Every Linker owns a LinkerContext, which holds the IR objects of its link.
+*  Several Linkers can run on different threads at the same time.
 */
 class Linker {
  public:
@@ -45,6 +52,11 @@ class Linker {
   bool layout();
 
   /// link - A convenient way to resolve and to layout the output mcld::Module.
+  ///
+  /// With --patch-identical-layout, the output of the previous link named by
+  /// the module is patched instead if its layout stays identical. The
+  /// module is then left empty, and only emit(pModule, pPath) to the same
+  /// output succeeds.
   bool link(Module& pModule, IRBuilder& pBuilder);
 
   /// emit - To emit output mcld::Module to a FileOutputBuffer.
@@ -57,8 +69,15 @@ class Linker {
   /// emit - To emit output mcld::Module in the pFileDescriptor.
   bool emit(const Module& pModule, int pFileDescriptor);
 
+  /// reset - destroy the target backend and release all objects allocated
+  /// by this link.
   bool reset();
 
+  /// context - the arena of this link. Clients that build the IR by their
+  /// own between the calls to Linker should make it current by a
+  /// LinkerContext::Scope.
+  LinkerContext& context() { return m_Context; }
+
  private:
   bool initTarget();
 
@@ -68,6 +87,26 @@ class Linker {
 
   bool initEmulator(LinkerScript& pScript);
 
+  /// createOutputBuffer - create the output buffer of pModule in pFile
+  bool createOutputBuffer(const Module& pModule,
+                          FileHandle& pFile,
+                          std::unique_ptr<FileOutputBuffer>& pOutput);
+
+  /// commitOutputBuffer - write a streamed output buffer to its file
+  bool commitOutputBuffer(FileOutputBuffer& pOutput);
+
+  /// discardOutput - drop the output of a failed link written in place
+  void discardOutput(std::unique_ptr<FileOutputBuffer>& pOutput,
+                     FileHandle& pFile);
+
+  /// closeOutput - unmap and close the output of emit, on another thread if
+  /// the link may use more than one
+  void closeOutput(std::unique_ptr<FileOutputBuffer>& pOutput,
+                   std::unique_ptr<FileHandle>& pFile);
+
+  /// waitForOutput - wait until the output of the last emit is closed
+  void waitForOutput();
+
  private:
   LinkerConfig* m_pConfig;
   IRBuilder* m_pIRBuilder;
@@ -75,6 +114,14 @@ class Linker {
   const Target* m_pTarget;
   TargetLDBackend* m_pBackend;
   ObjectLinker* m_pObjLinker;
+
+  LinkerContext m_Context;
+
+  /// the thread that closes the output of the last emit
+  std::thread m_OutputCloser;
+
+  /// whether link() has patched the output of the previous link
+  bool m_bPatched;
 };
 
 }  // namespace mcld
@@ -14,12 +14,16 @@
 #define MCLD_MODULE_H_
 
 #include "mcld/InputTree.h"
+#include "mcld/ADT/StringHash.h"
 #include "mcld/LD/NamePool.h"
 #include "mcld/LD/SectionSymbolSet.h"
 #include "mcld/MC/SymbolCategory.h"
 
-#include <vector>
+#include <llvm/ADT/StringRef.h>
+
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace mcld {
 
@@ -44,8 +48,10 @@ class Module {
   typedef InputTree::iterator input_iterator;
   typedef InputTree::const_iterator const_input_iterator;
 
+  // the section table is changed only through addSection() and
+  // clearSections(), which keep its name index
   typedef std::vector<LDSection*> SectionTable;
-  typedef SectionTable::iterator iterator;
+  typedef SectionTable::const_iterator iterator;
   typedef SectionTable::const_iterator const_iterator;
 
   typedef SymbolCategory SymbolTable;
@@ -104,7 +110,6 @@ class Module {
 
   // -----  sections  ----- //
   const SectionTable& getSectionTable() const { return m_SectionTable; }
-  SectionTable& getSectionTable() { return m_SectionTable; }
 
   iterator begin() { return m_SectionTable.begin(); }
   const_iterator begin() const { return m_SectionTable.begin(); }
@@ -117,9 +122,17 @@ class Module {
   size_t size() const { return m_SectionTable.size(); }
   bool empty() const { return m_SectionTable.empty(); }
 
+  /// getSection - get the first output section named pName, or NULL. The
+  /// sections are looked up by a name index.
   LDSection* getSection(const std::string& pName);
   const LDSection* getSection(const std::string& pName) const;
 
+  /// addSection - append pSection to the section table and index its name
+  void addSection(LDSection& pSection);
+
+  /// clearSections - remove all sections from the section table
+  void clearSections();
+
   /// @}
   /// @name Symbol Accessors
   /// @{
@@ -161,6 +174,13 @@ class Module {
   void addAlias(const ResolveInfo& pAlias);
   AliasList* getAliasList(const ResolveInfo& pSym);
 
+ private:
+  typedef std::unordered_map<llvm::StringRef,
+                             LDSection*,
+                             hash::StringHash<hash::DJB> > SectionIndex;
+
+  LDSection* findSection(const std::string& pName) const;
+
  private:
   std::string m_Name;
   LinkerScript& m_Script;
@@ -168,6 +188,8 @@ class Module {
   LibraryList m_LibraryList;
   InputTree m_MainTree;
   SectionTable m_SectionTable;
+  /// the first section of each name
+  SectionIndex m_SectionIndex;
   SymbolTable m_SymbolTable;
   NamePool m_NamePool;
   SectionSymbolSet m_SectSymbolSet;
@@ -10,6 +10,8 @@
 #define MCLD_OBJECT_OBJECTLINKER_H_
 #include <llvm/Support/DataTypes.h>
 
+#include <vector>
+
 namespace mcld {
 
 class ArchiveReader;
@@ -21,6 +23,8 @@ class ExecWriter;
 class FileOutputBuffer;
 class GroupReader;
 class IRBuilder;
+class Input;
+class LDSection;
 class LinkerConfig;
 class Module;
 class ObjectReader;
@@ -28,6 +32,7 @@ class ObjectWriter;
 class Relocation;
 class ResolveInfo;
 class ScriptReader;
+class SectionMerger;
 class TargetLDBackend;
 
 /** \class ObjectLinker
@@ -146,6 +151,34 @@ class ObjectLinker {
   ObjectWriter* getWriter() { return m_pWriter; }
 
  private:
+  /// prepareObjects - decode the relocatable objects in the input tree
+  /// concurrently before normalize() reads them in command-line order.
+  void prepareObjects();
+
+  /// scanRelocation - scan a relocation applied by pSection of pInput
+  void scanRelocation(Relocation& pReloc, LDSection& pSection, Input& pInput);
+
+  /// streamsRelocations - relocations are applied by emitOutput() and their
+  /// results are written straight into the output (--stream-relocations)
+  bool streamsRelocations() const;
+
+  /// applyRelocations - apply the relocations of all inputs and those
+  /// created by the backend. If pOutput is given, the results of the input
+  /// relocations are also written into it.
+  void applyRelocations(FileOutputBuffer* pOutput);
+
+  /// streamRelocationResults - write the results of the given relocations
+  /// of one input. Results against sections that are not written yet are
+  /// kept for postProcessing().
+  void streamRelocationResults(const std::vector<Relocation*>& pRelocs,
+                               uint8_t* pOutput);
+
+  /// streamRelocationResult - write the result of pReloc, or keep it for
+  /// postProcessing(). A bound relocation is kept by a copy, since pReloc is
+  /// only the scratch it was loaded into.
+  void streamRelocationResult(Relocation& pReloc, uint8_t* pOutput,
+                              bool pBound);
+
   /// normalSyncRelocationResult - sync relocation result when producing shared
   /// objects or executables
   void normalSyncRelocationResult(FileOutputBuffer& pOutput);
@@ -177,6 +210,13 @@ class ObjectLinker {
   BinaryReader* m_pBinaryReader;
   ScriptReader* m_pScriptReader;
   ObjectWriter* m_pWriter;
+
+  /// m_pSectionMerger - folds the duplicates in the mergeable sections
+  SectionMerger* m_pSectionMerger;
+
+  /// m_PendingRelocs - streamed relocations whose results are written in
+  /// postProcessing()
+  std::vector<Relocation*> m_PendingRelocs;
 };
 
 }  // namespace mcld
@@ -15,6 +15,7 @@
 
 #include <llvm/Support/DataTypes.h>
 
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -22,6 +23,7 @@ namespace mcld {
 
 class Fragment;
 class LDSection;
+class SectionMatcher;
 
 /** \class SectionMap
  *  \brief descirbe how to map input sections into output sections
@@ -155,6 +157,8 @@ class SectionMap {
   typedef OutputDescList::reverse_iterator reverse_iterator;
 
  public:
+  SectionMap();
+
   ~SectionMap();
 
   const_mapping find(const std::string& pInputFile,
@@ -195,14 +199,23 @@ class SectionMap {
   void fixupDotSymbols();
 
  private:
-  bool matched(const Input& pInput,
-               const std::string& pInputFile,
-               const std::string& pInputSection) const;
+  /// getMatcher - get the compiled matcher, build one if the map has changed.
+  /// The caller should hold m_MatcherMutex.
+  SectionMatcher& getMatcher() const;
 
-  bool matched(const WildcardPattern& pPattern, const std::string& pName) const;
+  /// invalidateMatcher - drop the compiled matcher when the map changes
+  void invalidateMatcher();
 
  private:
   OutputDescList m_OutputDescList;
+
+  /// m_pMatcher - the compiled input section descriptions and the cached
+  /// results of find(). It is built lazily on the first find().
+  mutable SectionMatcher* m_pMatcher;
+
+  /// m_MatcherMutex - find() may be called on several threads, and every
+  /// call updates the matcher and its cache
+  mutable std::mutex m_MatcherMutex;
 };
 
 }  // namespace mcld
@@ -0,0 +1,183 @@
+//===- SectionMatcher.h ---------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MCLD_OBJECT_SECTIONMATCHER_H_
+#define MCLD_OBJECT_SECTIONMATCHER_H_
+
+#include "mcld/Object/SectionMap.h"
+
+#include <llvm/ADT/StringMap.h>
+#include <llvm/ADT/StringRef.h>
+
+#include <bitset>
+#include <cstddef>
+#include <map>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace mcld {
+
+class WildcardPattern;
+
+/** \class SectionMatcher
+ *  \brief SectionMatcher is the compiled form of the input section
+ *  descriptions of a SectionMap.
+ *
+ *  The input section descriptions are numbered in the order SectionMap
+ *  searches them. Their section name patterns are indexed by kind: the exact
+ *  names in a hash table, the prefix patterns in a trie, and the other globs
+ *  in a lazily built DFA. A lookup collects the descriptions whose section
+ *  patterns match, and returns the first one whose file patterns match. The
+ *  file patterns are checked once per input file, and the result is cached
+ *  per pair of input file and section name.
+ */
+class SectionMatcher {
+ public:
+  explicit SectionMatcher(const SectionMap& pSectionMap);
+
+  /// find - find the first input section description that matches
+  /// @param pOutIdx - the index of its output section description
+  /// @param pInIdx  - its index in the output section description
+  /// @return false if no description matches
+  bool find(const std::string& pInputFile,
+            const std::string& pInputSection,
+            size_t& pOutIdx,
+            size_t& pInIdx);
+
+  /// matched - match the name against the wildcard pattern like fnmatch(3)
+  static bool matched(const WildcardPattern& pPattern,
+                      const std::string& pName);
+
+ public:
+  // -----  the indexes of the section name patterns  ----- //
+  typedef std::vector<uint32_t> RuleList;
+
+  /** \class Glob
+   *  \brief a glob compiled into a sequence of character sets and stars
+   */
+  struct Glob {
+    struct Token {
+      bool star;
+      std::bitset<256> chars;
+    };
+    std::vector<Token> tokens;
+
+    /// compile - compile the glob in the syntax of fnmatch(3) with no flags
+    /// @return false if the glob uses the syntax not supported here
+    bool compile(const llvm::StringRef& pGlob);
+  };
+
+  /** \class GlobDFA
+   *  \brief the DFA that runs all the globs at once. The states are built
+   *  on demand from the sets of the positions in the globs.
+   */
+  class GlobDFA {
+   public:
+    /// the number of states kept before the DFA is rebuilt from scratch
+    static const size_t MaxStates = 4096;
+
+   public:
+    GlobDFA();
+
+    void add(const Glob& pGlob, uint32_t pRule);
+
+    bool empty() const { return m_Rules.empty(); }
+
+    size_t numOfStates() const { return m_States.size(); }
+
+    /// match - add the rules whose globs match pName to pRules
+    void match(const llvm::StringRef& pName, RuleList& pRules);
+
+   private:
+    typedef std::vector<uint32_t> PositionSet;
+
+    struct State {
+      PositionSet positions;
+      RuleList accepts;
+      std::vector<int32_t> next;
+    };
+
+   private:
+    void closure(PositionSet& pSet) const;
+    uint32_t getState(PositionSet& pSet);
+    uint32_t step(uint32_t pState, unsigned char pChar);
+    void reset();
+
+   private:
+    /// the globs are stored one after another. m_Tokens[i] is the token at
+    /// position i, and the position after the last token of a glob accepts
+    std::vector<Glob::Token> m_Tokens;
+    std::vector<bool> m_IsEnd;
+    std::vector<uint32_t> m_Rules;  // the rule of each end position
+    std::vector<uint32_t> m_Starts;
+
+    std::vector<State> m_States;
+    std::map<PositionSet, uint32_t> m_StateMap;
+  };
+
+  /** \class PrefixTrie
+   *  \brief the trie of the prefix patterns
+   */
+  class PrefixTrie {
+   public:
+    PrefixTrie();
+
+    void add(const llvm::StringRef& pPrefix, uint32_t pRule);
+
+    /// match - add the rules whose prefixes start pName to pRules
+    void match(const llvm::StringRef& pName, RuleList& pRules) const;
+
+   private:
+    struct Node {
+      std::vector<std::pair<char, uint32_t> > children;
+      RuleList rules;
+    };
+
+   private:
+    int64_t getChild(uint32_t pNode, char pChar) const;
+
+   private:
+    std::vector<Node> m_Nodes;
+  };
+
+ private:
+  struct FileEntry {
+    /// whether the file patterns of each rule match the file
+    std::vector<bool> fileMatched;
+    /// the first rule that matches each section name, or -1
+    std::unordered_map<std::string, int64_t> sections;
+  };
+
+ private:
+  void addPattern(const WildcardPattern& pPattern, uint32_t pRule);
+
+  bool isFileMatched(uint32_t pRule, const std::string& pInputFile) const;
+
+  int64_t lookup(FileEntry& pFile, const std::string& pInputSection);
+
+ private:
+  /// m_Rules - the output index and the input index of each rule
+  std::vector<std::pair<size_t, size_t> > m_Rules;
+  std::vector<const SectionMap::Input*> m_Inputs;
+
+  llvm::StringMap<RuleList> m_ExactNames;
+  PrefixTrie m_Prefixes;
+  GlobDFA m_Globs;
+
+  /// m_OtherGlobs - the globs which are not compiled, matched by fnmatch
+  std::vector<std::pair<const WildcardPattern*, uint32_t> > m_OtherGlobs;
+
+  std::unordered_map<std::string, FileEntry> m_Cache;
+};
+
+}  // namespace mcld
+
+#endif  // MCLD_OBJECT_SECTIONMATCHER_H_
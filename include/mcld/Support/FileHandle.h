@@ -41,6 +41,7 @@ class FileHandle {
     Append = 0x04,
     Create = 0x08,
     Truncate = 0x10,
+    Exclusive = 0x20,
     Unknown = 0xFF
   };
 
@@ -15,6 +15,7 @@
 #include <llvm/Support/DataTypes.h>
 #include <llvm/Support/FileSystem.h>
 
+#include <memory>
 #include <system_error>
 
 namespace mcld {
@@ -23,6 +24,17 @@ class FileHandle;
 
 /// FileOutputBuffer - This interface is borrowed from llvm bassically, and we
 /// may use ostream to emit output later.
+///
+/// The buffer is a shared writable mapping of the file, unless the output is
+/// at least as large as the stream threshold or the file cannot be mapped,
+/// e.g., on some network and FUSE file systems. Then the buffer is staged in
+/// a mapping of an unlinked temporary file, so that an output larger than
+/// the memory is paged out rather than failing. commit() writes the staging
+/// to the file in bounded, aligned windows in ascending offset order with
+/// pwrite. The all-zero windows are left as holes.
+///
+/// A streamed buffer that is destroyed before commit() is dropped without
+/// touching the file.
 class FileOutputBuffer {
  public:
   /// Factory method to create an OutputBuffer object which manages a read/write
@@ -30,26 +42,31 @@ class FileOutputBuffer {
   /// to the file at the specified path.
   static std::error_code create(FileHandle& pFileHandle,
                                 size_t pSize,
-                                std::unique_ptr<FileOutputBuffer>& pResult);
+                                std::unique_ptr<FileOutputBuffer>& pResult,
+                                uint64_t pStreamThreshold = UINT64_MAX);
 
   /// Returns a pointer to the start of the buffer.
-  uint8_t* getBufferStart() {
-    return reinterpret_cast<uint8_t*>(m_pRegion->data());
-  }
+  uint8_t* getBufferStart() { return m_pData; }
 
   /// Returns a pointer to the end of the buffer.
-  uint8_t* getBufferEnd() {
-    return reinterpret_cast<uint8_t*>(m_pRegion->data()) + m_pRegion->size();
-  }
+  uint8_t* getBufferEnd() { return m_pData + m_Size; }
 
   /// Returns size of the buffer.
-  size_t getBufferSize() const { return m_pRegion->size(); }
+  size_t getBufferSize() const { return m_Size; }
 
   MemoryRegion request(size_t pOffset, size_t pLength);
 
   /// Returns path where file will show up if buffer is committed.
   llvm::StringRef getPath() const;
 
+  /// isStreamed - whether the buffer is written to the file by commit()
+  bool isStreamed() const { return m_bStreamed; }
+
+  /// commit - write a streamed buffer to the file. A mapped buffer is
+  /// flushed by the OS when it is unmapped. It must be called for the output
+  /// to be kept.
+  std::error_code commit();
+
   ~FileOutputBuffer();
 
  private:
@@ -57,10 +74,17 @@ class FileOutputBuffer {
   FileOutputBuffer& operator=(const FileOutputBuffer&);
 
   FileOutputBuffer(llvm::sys::fs::mapped_file_region* pRegion,
-                   FileHandle& pFileHandle);
+                   size_t pSize,
+                   FileHandle& pFileHandle,
+                   bool pStreamed);
 
+  /// the mapping of the file, or of the staging file of a streamed buffer
   std::unique_ptr<llvm::sys::fs::mapped_file_region> m_pRegion;
+  uint8_t* m_pData;
+  size_t m_Size;
   FileHandle& m_FileHandle;
+  bool m_bStreamed;
+  bool m_bCommitted;
 };
 
 }  // namespace mcld
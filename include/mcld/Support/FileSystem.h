@@ -18,6 +18,7 @@
 
 #include <iosfwd>
 #include <locale>
+#include <stdint.h>
 #include <string>
 
 namespace mcld {
@@ -96,6 +97,11 @@ int open(const Path& pPath, int pOFlag, int pPermission);
 ssize_t pread(int pFD, void* pBuf, size_t pCount, off_t pOffset);
 ssize_t pwrite(int pFD, const void* pBuf, size_t pCount, off_t pOffset);
 int ftruncate(int pFD, size_t pLength);
+
+/// change_time - the last status change time (ctime) of pPath in nanoseconds.
+/// Unlike the modification time, it cannot be set back by the user. Return 0
+/// if it is unknown.
+uint64_t change_time(const Path& pPath);
 void* mmap(void* pAddr,
            size_t pLen,
            int pProt,
@@ -0,0 +1,147 @@
+//===- LinkerContext.h ----------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MCLD_SUPPORT_LINKERCONTEXT_H_
+#define MCLD_SUPPORT_LINKERCONTEXT_H_
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace mcld {
+
+class DiagnosticEngine;
+
+/** \class LinkerContext
+ *  \brief LinkerContext is the arena of one link. It owns the factories of
+ *  the IR objects (LDSection, LDSymbol, FragmentRef, Relocation, ...), of
+ *  the linker script tokens, and the DiagnosticEngine the link reports to.
+ *
+ *  The factories are declared by ContextStatic, one slot per factory, and
+ *  are created lazily in the current context of the calling thread. Every
+ *  mcld::Linker owns a LinkerContext and makes it current while it runs, so
+ *  several linkers can run on different threads at the same time, and
+ *  releasing the context destroys everything the link allocated at once.
+ *
+ *  Outside of any Linker, the current context is the process-wide default
+ *  context, which lives until the program exits.
+ *
+ *  The workers of parallelFor share the context of their caller, so the
+ *  slots are created under a lock and read without one.
+ *
+ *  @see ContextStatic
+ */
+class LinkerContext {
+ public:
+  /** \class Scope
+   *  \brief Scope makes a context current in the calling thread, and
+   *  restores the previous one when it goes out of scope.
+   */
+  class Scope {
+   public:
+    explicit Scope(LinkerContext& pContext);
+
+    ~Scope();
+
+   private:
+    Scope(const Scope&);             // DO NOT IMPLEMENT
+    Scope& operator=(const Scope&);  // DO NOT IMPLEMENT
+
+   private:
+    LinkerContext* m_pPrevious;
+  };
+
+  typedef void* (*CreatorTy)();
+  typedef void (*DeleterTy)(void*);
+
+ public:
+  LinkerContext();
+
+  ~LinkerContext();
+
+  /// current - the current context of the calling thread
+  static LinkerContext& current();
+
+  /// global - the process-wide default context
+  static LinkerContext& global();
+
+  /// registerSlot - allocate a slot id for a ContextStatic
+  static unsigned registerSlot();
+
+  /// getObject - get the object of slot pSlot, create it by pCreator if this
+  /// context does not have it yet.
+  void* getObject(unsigned pSlot, CreatorTy pCreator, DeleterTy pDeleter);
+
+  /// release - destroy all objects in this context, in the reverse order of
+  /// their creation. The diagnostic engine is kept.
+  void release();
+
+  bool empty() const { return m_Order.empty(); }
+
+  /// getDiagEngine - the diagnostic engine of the links in this context
+  DiagnosticEngine& getDiagEngine() { return *m_pDiagEngine; }
+
+ private:
+  LinkerContext(const LinkerContext&);             // DO NOT IMPLEMENT
+  LinkerContext& operator=(const LinkerContext&);  // DO NOT IMPLEMENT
+
+ private:
+  enum {
+    /// MaxSlots - the maximum number of ContextStatics in the program
+    MaxSlots = 64
+  };
+
+  struct Entry {
+    std::atomic<void*> object;
+    DeleterTy deleter;
+  };
+
+ private:
+  Entry m_Objects[MaxSlots];
+
+  /// m_Order - the slots in the order of creation
+  std::vector<unsigned> m_Order;
+
+  /// m_Mutex - guard the creation and the release of the objects. A creator
+  /// or a deleter may reach other slots of the same context.
+  std::recursive_mutex m_Mutex;
+
+  DiagnosticEngine* m_pDiagEngine;
+};
+
+/** \class ContextStatic
+ *  \brief ContextStatic is a replacement of llvm::ManagedStatic whose object
+ *  lives in the current LinkerContext instead of the process.
+ */
+template <typename T>
+class ContextStatic {
+ public:
+  ContextStatic() : m_Slot(LinkerContext::registerSlot()) {}
+
+  T& operator*() const { return *get(); }
+
+  T* operator->() const { return get(); }
+
+ private:
+  static void* create() { return new T(); }
+
+  static void destroy(void* pObject) { delete static_cast<T*>(pObject); }
+
+  T* get() const {
+    return static_cast<T*>(
+        LinkerContext::current().getObject(m_Slot, create, destroy));
+  }
+
+ private:
+  unsigned m_Slot;
+};
+
+}  // namespace mcld
+
+#endif  // MCLD_SUPPORT_LINKERCONTEXT_H_
@@ -59,6 +59,11 @@ class MemoryAreaFactory : public GCFactory<MemoryArea, 0> {
 
   void destruct(MemoryArea* pArea);
 
+ private:
+  // produceCached - get the MemoryArea of pPath from the InputCache if it is
+  // enabled. Return NULL otherwise.
+  MemoryArea* produceCached(const sys::fs::Path& pPath);
+
  private:
   llvm::StringMap<MemoryArea*> m_AreaMap;
 };
@@ -16,6 +16,8 @@ class LinkerConfig;
 class DiagnosticPrinter;
 class DiagnosticLineInfo;
 
+/// InitializeDiagnosticEngine - set up the diagnostic engine of the current
+/// LinkerContext
 void InitializeDiagnosticEngine(const LinkerConfig& pConfig,
                                 DiagnosticPrinter* pPrinter = NULL);
 
@@ -23,6 +25,7 @@ void FinalizeDiagnosticEngine();
 
 bool Diagnose();
 
+/// getDiagnosticEngine - the diagnostic engine of the current LinkerContext
 DiagnosticEngine& getDiagnosticEngine();
 
 MsgHandler unreachable(unsigned int pID);
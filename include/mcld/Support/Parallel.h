@@ -0,0 +1,123 @@
+//===- Parallel.h ---------------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MCLD_SUPPORT_PARALLEL_H_
+#define MCLD_SUPPORT_PARALLEL_H_
+
+#include "mcld/Support/LinkerContext.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace mcld {
+
+/// ParallelWorkerScope - mark the calling thread as running the body of a
+/// parallel loop until the scope ends.
+class ParallelWorkerScope {
+ public:
+  ParallelWorkerScope() : m_Prev(flag()) { flag() = true; }
+
+  ~ParallelWorkerScope() { flag() = m_Prev; }
+
+  /// isActive - whether the calling thread runs the body of a parallel loop
+  static bool isActive() { return flag(); }
+
+ private:
+  static bool& flag() {
+    static thread_local bool t_InWorker = false;
+    return t_InWorker;
+  }
+
+ private:
+  bool m_Prev;
+};
+
+/// parallelForRange - split [pBegin, pEnd) into chunks of at most pGrain
+/// indices and call pFunc(chunk_begin, chunk_end) for each chunk on up to
+/// pThreads threads. The calling thread takes part in the work.
+///
+/// Chunks are handed out dynamically, so the order in which they run is
+/// unspecified. pFunc must only touch state that belongs to its own chunk;
+/// anything order-dependent (diagnostics, symbol resolution, ...) has to be
+/// collected per chunk and merged by the caller afterwards.
+///
+/// If pThreads is one or the range fits in a single chunk, everything runs
+/// inline on the calling thread and no thread is spawned. The spawned
+/// threads share the current LinkerContext of the calling thread. While
+/// pFunc runs, ParallelWorkerScope::isActive() is true on its thread, even
+/// when it runs inline.
+template <typename FuncTy>
+void parallelForRange(unsigned pThreads,
+                      size_t pBegin,
+                      size_t pEnd,
+                      size_t pGrain,
+                      FuncTy pFunc) {
+  if (pBegin >= pEnd)
+    return;
+
+  if (pGrain == 0)
+    pGrain = 1;
+
+  size_t num_chunks = (pEnd - pBegin + pGrain - 1) / pGrain;
+  size_t num_workers = std::min<size_t>(pThreads, num_chunks);
+  if (num_workers <= 1) {
+    ParallelWorkerScope in_worker;
+    pFunc(pBegin, pEnd);
+    return;
+  }
+
+  std::atomic<size_t> next(0);
+  LinkerContext& context = LinkerContext::current();
+  auto worker = [&]() {
+    LinkerContext::Scope scope(context);
+    ParallelWorkerScope in_worker;
+    for (size_t chunk = next++; chunk < num_chunks; chunk = next++) {
+      size_t begin = pBegin + chunk * pGrain;
+      pFunc(begin, std::min(begin + pGrain, pEnd));
+    }
+  };
+
+  std::vector<std::thread> pool;
+  pool.reserve(num_workers - 1);
+  for (size_t i = 1; i < num_workers; ++i)
+    pool.emplace_back(worker);
+  worker();
+  for (std::thread& thread : pool)
+    thread.join();
+}
+
+/// parallelFor - call pFunc(idx) for every idx in [pBegin, pEnd) on up to
+/// pThreads threads. Use this form when each iteration is coarse, e.g. one
+/// input file.
+template <typename FuncTy>
+void parallelFor(unsigned pThreads, size_t pBegin, size_t pEnd, FuncTy pFunc) {
+  parallelForRange(pThreads, pBegin, pEnd, 1,
+                   [&pFunc](size_t pChunkBegin, size_t pChunkEnd) {
+                     for (size_t idx = pChunkBegin; idx != pChunkEnd; ++idx)
+                       pFunc(idx);
+                   });
+}
+
+/// parallelForEach - call pFunc(*iter) for every element of a random access
+/// range on up to pThreads threads.
+template <typename IterTy, typename FuncTy>
+void parallelForEach(unsigned pThreads,
+                     IterTy pBegin,
+                     IterTy pEnd,
+                     FuncTy pFunc) {
+  parallelFor(pThreads, 0, std::distance(pBegin, pEnd),
+              [&pBegin, &pFunc](size_t pIdx) { pFunc(pBegin[pIdx]); });
+}
+
+}  // namespace mcld
+
+#endif  // MCLD_SUPPORT_PARALLEL_H_
@@ -0,0 +1,45 @@
+//===- SHA1.h -------------------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MCLD_SUPPORT_SHA1_H_
+#define MCLD_SUPPORT_SHA1_H_
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace mcld {
+
+/** \class SHA1
+ *  \brief SHA1 computes the SHA-1 digest of a byte stream (FIPS 180-4).
+ */
+class SHA1 {
+ public:
+  enum { DigestSize = 20 };
+
+ public:
+  SHA1();
+
+  /// update - append pSize bytes of pData to the stream
+  void update(const uint8_t* pData, size_t pSize);
+
+  /// final - finish the stream and write its digest to pResult
+  void final(uint8_t pResult[DigestSize]);
+
+ private:
+  /// processBlock - fold one 64-byte block into the state
+  void processBlock(const uint8_t* pBlock);
+
+ private:
+  uint32_t m_State[5];
+  uint8_t m_Buffer[64];
+  uint64_t m_Length;  // in bytes
+};
+
+}  // namespace mcld
+
+#endif  // MCLD_SUPPORT_SHA1_H_
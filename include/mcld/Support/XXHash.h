@@ -0,0 +1,23 @@
+//===- XXHash.h -----------------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MCLD_SUPPORT_XXHASH_H_
+#define MCLD_SUPPORT_XXHASH_H_
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace mcld {
+
+/// xxHash64 - the 64-bit xxHash of pSize bytes at pData. It is not a
+/// cryptographic hash, but it runs at memory bandwidth.
+uint64_t xxHash64(const uint8_t* pData, size_t pSize, uint64_t pSeed = 0);
+
+}  // namespace mcld
+
+#endif  // MCLD_SUPPORT_XXHASH_H_
@@ -20,10 +20,13 @@
 #include <llvm/Support/ELF.h>
 
 #include <cstdint>
+#include <string>
+#include <vector>
 
 namespace mcld {
 
 class BranchIslandFactory;
+class BuildID;
 class EhFrameHdr;
 class ELFAttribute;
 class ELFDynamic;
@@ -39,6 +42,7 @@ class LinkerConfig;
 class LinkerScript;
 class Module;
 class Relocation;
+class StringTableBuilder;
 class StubFactory;
 
 /** \class GNULDBackend
@@ -103,6 +107,9 @@ class GNULDBackend : public TargetLDBackend {
 
   bool hasStaticTLS() const { return m_bHasStaticTLS; }
 
+  /// getShStrTabBuilder - the names of the output sections in .shstrtab
+  const StringTableBuilder& getShStrTabBuilder() const { return *m_pShStrTab; }
+
   /// getSegmentStartAddr - return the start address of the segment
   uint64_t getSegmentStartAddr(const LinkerScript& pScript) const;
 
@@ -114,6 +121,10 @@ class GNULDBackend : public TargetLDBackend {
   /// .dynsym, .dynstr, and .hash
   virtual void sizeNamePools(Module& pModule);
 
+  /// hashDynamicSymbols - compute the hash values in .gnu.hash and .hash of
+  /// the symbols in .dynsym that have none yet
+  void hashDynamicSymbols(Module& pModule);
+
   /// emitSectionData - emit target-dependent section data
   virtual uint64_t emitSectionData(const LDSection& pSection,
                                    MemoryRegion& pRegion) const = 0;
@@ -334,6 +345,13 @@ class GNULDBackend : public TargetLDBackend {
   /// function pointer access
   bool mayHaveUnsafeFunctionPointerAccess(const LDSection& pSection) const;
 
+  /// getHashBucketCount - choose the bucket count of the hash table of
+  /// pHashes by measuring the chains of the candidate counts on pNumThreads
+  /// threads
+  static unsigned getHashBucketCount(const std::vector<uint32_t>& pHashes,
+                                     bool pIsGNUStyle,
+                                     unsigned pNumThreads);
+
  protected:
   /// getRelEntrySize - the size in BYTE of rel type relocation
   virtual size_t getRelEntrySize() = 0;
@@ -352,26 +370,38 @@ class GNULDBackend : public TargetLDBackend {
   /// isTemporary - Whether pSymbol is a local label.
   virtual bool isTemporary(const LDSymbol& pSymbol) const;
 
-  /// getHashBucketCount - calculate hash bucket count.
-  static unsigned getHashBucketCount(unsigned pNumOfSymbols, bool pIsGNUStyle);
-
   /// getGNUHashMaskbitslog2 - calculate the number of mask bits in log2
   unsigned getGNUHashMaskbitslog2(unsigned pNumOfSymbols) const;
 
-  /// emitSymbol32 - emit an ELF32 symbol
+  /// emitSymbol32 - emit an ELF32 symbol whose name is at pStrOffset of the
+  /// string table
   void emitSymbol32(llvm::ELF::Elf32_Sym& pSym32,
                     LDSymbol& pSymbol,
-                    char* pStrtab,
-                    size_t pStrtabsize,
+                    size_t pStrOffset,
                     size_t pSymtabIdx);
 
-  /// emitSymbol64 - emit an ELF64 symbol
+  /// emitSymbol64 - emit an ELF64 symbol whose name is at pStrOffset of the
+  /// string table
   void emitSymbol64(llvm::ELF::Elf64_Sym& pSym64,
                     LDSymbol& pSymbol,
-                    char* pStrtab,
-                    size_t pStrtabsize,
+                    size_t pStrOffset,
                     size_t pSymtabIdx);
 
+  /// getRpath - the search paths of DT_RPATH or DT_RUNPATH
+  std::string getRpath() const;
+
+  /// emitSymbols - emit the symbols in [pBegin, pEnd) from symbol index
+  /// pSymtabIdx on. The names are looked up in pStrTab first, or appended to
+  /// it if they come after the table has been sized, so the entries can be
+  /// written on worker threads. Exactly one of pSymtab32 and pSymtab64 is
+  /// non-NULL.
+  void emitSymbols(Module::const_sym_iterator pBegin,
+                   Module::const_sym_iterator pEnd,
+                   llvm::ELF::Elf32_Sym* pSymtab32,
+                   llvm::ELF::Elf64_Sym* pSymtab64,
+                   StringTableBuilder& pStrTab,
+                   size_t pSymtabIdx);
+
  protected:
   /// createProgramHdrs - base on output sections to create the program headers
   void createProgramHdrs(Module& pModule);
@@ -438,6 +468,41 @@ class GNULDBackend : public TargetLDBackend {
     return false;
   }
 
+  /// mayRelaxBranch - Backends should override this function to tell if
+  /// pReloc is a branch that may be out of range and need a stub. relax()
+  /// puts these branches on the worklist of doRelax.
+  virtual bool mayRelaxBranch(const Relocation& pReloc) const { return false; }
+
+  /** \class RelaxBranch
+   *  \brief A branch on the relaxation worklist, and the addresses of its
+   *  place and its target when doRelax checked it last time.
+   */
+  struct RelaxBranch {
+    explicit RelaxBranch(Relocation& pReloc)
+        : reloc(&pReloc), place(0x0), target(0x0), checked(false) {}
+
+    Relocation* reloc;
+    uint64_t place;
+    uint64_t target;
+    bool checked;
+  };
+
+  typedef std::vector<RelaxBranch> RelaxWorklist;
+
+  /// getRelaxWorklist - the branches of the inputs that may need stubs
+  RelaxWorklist& getRelaxWorklist() { return m_RelaxWorklist; }
+
+  /// isBranchMoved - return true if pBranch has not been checked, or if its
+  /// place or its target, whose value is pTargetValue now, has moved since
+  /// then. A branch that has not moved needs no more stub than before.
+  static bool isBranchMoved(RelaxBranch& pBranch, uint64_t pTargetValue);
+
+  /// relayoutIslands - after doRelax inserts stubs, re-lay out the fragments
+  /// of each section from the first island that outgrows its exit, and reset
+  /// the sizes of the sections if pRelaxed. Set pFinished to false if any
+  /// island has outgrown.
+  void relayoutIslands(bool pRelaxed, bool& pFinished);
+
  protected:
   // Based on Kind in LDFileFormat to define basic section orders for ELF.
   enum SectionOrder {
@@ -524,12 +589,23 @@ class GNULDBackend : public TargetLDBackend {
   // stub factory
   StubFactory* m_pStubFactory;
 
+  // the branches to check in each pass of relaxation
+  RelaxWorklist m_RelaxWorklist;
+
   // map the LDSymbol to its index in the output symbol table
   HashTableType* m_pSymIndexMap;
 
+  // the names in .strtab, .dynstr and .shstrtab
+  StringTableBuilder* m_pStrTab;
+  StringTableBuilder* m_pDynStrTab;
+  StringTableBuilder* m_pShStrTab;
+
   // section .eh_frame_hdr
   EhFrameHdr* m_pEhFrameHdr;
 
+  // section .note.gnu.build-id
+  BuildID* m_pBuildID;
+
   // attribute section
   ELFAttribute* m_pAttribute;
 
@@ -540,6 +616,10 @@ class GNULDBackend : public TargetLDBackend {
   // DF_STATIC_TLS of DT_FLAGS
   bool m_bHasStaticTLS;
 
+  // the bucket counts of .gnu.hash and .hash chosen by sizeNamePools()
+  unsigned m_GNUHashBucketCount;
+  unsigned m_SysVHashBucketCount;
+
   // -----  standard symbols  ----- //
   // section symbols
   LDSymbol* f_pPreInitArrayStart;
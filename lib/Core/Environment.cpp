@@ -9,17 +9,22 @@
 #include "mcld/Environment.h"
 #include "mcld/Support/TargetSelect.h"
 
-void mcld::Initialize() {
-  static bool is_initialized = false;
+#include <mutex>
 
-  if (is_initialized)
-    return;
+namespace {
 
+void InitializeOnce() {
   mcld::InitializeAllTargets();
   mcld::InitializeAllEmulations();
   mcld::InitializeAllDiagnostics();
+}
 
-  is_initialized = true;
+}  // anonymous namespace
+
+void mcld::Initialize() {
+  // Linkers may be set up on several threads at once
+  static std::once_flag is_initialized;
+  std::call_once(is_initialized, InitializeOnce);
 }
 
 void mcld::Finalize() {
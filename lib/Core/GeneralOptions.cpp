@@ -59,11 +59,18 @@ GeneralOptions::GeneralOptions()
       m_bPrintGCSections(false),
       m_bGenUnwindInfo(true),
       m_bPrintICFSections(false),
+      m_bStreamRelocations(false),
+      m_bTailMergeStrings(false),
+      m_bPatchIdenticalLayout(false),
+      m_bFastExit(false),
       m_ICF(ICF::None),
       m_ICFIterations(2),
+      m_NumThreads(1),
+      m_StreamOutputThreshold(UINT64_C(4) << 30),
       m_GPSize(8),
       m_StripSymbols(StripSymbolMode::KeepAllSymbols),
-      m_HashStyle(HashStyle::SystemV) {
+      m_HashStyle(HashStyle::SystemV),
+      m_BuildIDStyle(BuildIDStyle::None) {
 }
 
 GeneralOptions::~GeneralOptions() {
@@ -395,7 +395,31 @@ uint64_t IRBuilder::AppendEhFrame(EhFrame::CIE& pCIE, EhFrame& pEhFrame) {
 /// AddSymbol - To add a symbol in the input file and resolve the symbol
 /// immediately
 LDSymbol* IRBuilder::AddSymbol(Input& pInput,
-                               const std::string& pName,
+                               const llvm::StringRef& pName,
+                               ResolveInfo::Type pType,
+                               ResolveInfo::Desc pDesc,
+                               ResolveInfo::Binding pBind,
+                               ResolveInfo::SizeType pSize,
+                               LDSymbol::ValueType pValue,
+                               LDSection* pSection,
+                               ResolveInfo::Visibility pVis) {
+  return AddSymbol(pInput,
+                   pName,
+                   NamePool::Hash(pName),
+                   pType,
+                   pDesc,
+                   pBind,
+                   pSize,
+                   pValue,
+                   pSection,
+                   pVis);
+}
+
+/// AddSymbol - To add a symbol with the hash value of its name in the input
+/// file and resolve the symbol immediately
+LDSymbol* IRBuilder::AddSymbol(Input& pInput,
+                               const llvm::StringRef& pName,
+                               uint32_t pHash,
                                ResolveInfo::Type pType,
                                ResolveInfo::Desc pDesc,
                                ResolveInfo::Binding pBind,
@@ -404,7 +428,8 @@ LDSymbol* IRBuilder::AddSymbol(Input& pInput,
                                LDSection* pSection,
                                ResolveInfo::Visibility pVis) {
   // rename symbols
-  std::string name = pName;
+  llvm::StringRef name = pName;
+  uint32_t hash = pHash;
   if (!m_Module.getScript().renameMap().empty() &&
       ResolveInfo::Undefined == pDesc) {
     // If the renameMap is not empty, some symbols should be renamed.
@@ -412,8 +437,10 @@ LDSymbol* IRBuilder::AddSymbol(Input& pInput,
     const LinkerScript& script = m_Module.getScript();
     LinkerScript::SymbolRenameMap::const_iterator renameSym =
         script.renameMap().find(pName);
-    if (script.renameMap().end() != renameSym)
+    if (script.renameMap().end() != renameSym) {
       name = renameSym.getEntry()->value();
+      hash = NamePool::Hash(name);
+    }
   }
 
   // Fix up the visibility if object has no export set.
@@ -435,13 +462,13 @@ LDSymbol* IRBuilder::AddSymbol(Input& pInput,
         frag = FragmentRef::Create(*pSection, pValue);
 
       LDSymbol* input_sym = addSymbolFromObject(
-          name, pType, pDesc, pBind, pSize, pValue, frag, pVis);
+          name, hash, pType, pDesc, pBind, pSize, pValue, frag, pVis);
       pInput.context()->addSymbol(input_sym);
       return input_sym;
     }
     case Input::DynObj: {
       return addSymbolFromDynObj(
-          pInput, name, pType, pDesc, pBind, pSize, pValue, pVis);
+          pInput, name, hash, pType, pDesc, pBind, pSize, pValue, pVis);
     }
     default: {
       return NULL;
@@ -451,7 +478,8 @@ LDSymbol* IRBuilder::AddSymbol(Input& pInput,
   return NULL;
 }
 
-LDSymbol* IRBuilder::addSymbolFromObject(const std::string& pName,
+LDSymbol* IRBuilder::addSymbolFromObject(const llvm::StringRef& pName,
+                                         uint32_t pHash,
                                          ResolveInfo::Type pType,
                                          ResolveInfo::Desc pDesc,
                                          ResolveInfo::Binding pBinding,
@@ -477,6 +505,7 @@ LDSymbol* IRBuilder::addSymbolFromObject(const std::string& pName,
   } else {
     // if the symbol is not local, insert and resolve it immediately
     m_Module.getNamePool().insertSymbol(pName,
+                                        pHash,
                                         false,
                                         pType,
                                         pDesc,
@@ -526,7 +555,8 @@ LDSymbol* IRBuilder::addSymbolFromObject(const std::string& pName,
 }
 
 LDSymbol* IRBuilder::addSymbolFromDynObj(Input& pInput,
-                                         const std::string& pName,
+                                         const llvm::StringRef& pName,
+                                         uint32_t pHash,
                                          ResolveInfo::Type pType,
                                          ResolveInfo::Desc pDesc,
                                          ResolveInfo::Binding pBinding,
@@ -552,6 +582,7 @@ LDSymbol* IRBuilder::addSymbolFromDynObj(Input& pInput,
   // resolved_result is a triple <resolved_info, existent, override>
   Resolver::Result resolved_result;
   m_Module.getNamePool().insertSymbol(pName,
+                                      pHash,
                                       true,
                                       pType,
                                       pDesc,
@@ -591,9 +622,8 @@ Relocation* IRBuilder::AddRelocation(LDSection& pSection,
                                      LDSymbol& pSym,
                                      uint32_t pOffset,
                                      Relocation::Address pAddend) {
-  FragmentRef* frag_ref = FragmentRef::Create(*pSection.getLink(), pOffset);
-
-  Relocation* relocation = Relocation::Create(pType, *frag_ref, pAddend);
+  Relocation* relocation =
+      Relocation::Create(pType, *pSection.getLink(), pOffset, pAddend);
 
   relocation->setSymInfo(pSym.resolveInfo());
   pSection.getRelocData()->append(*relocation);
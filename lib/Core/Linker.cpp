@@ -15,6 +15,7 @@
 #include "mcld/Fragment/Relocation.h"
 #include "mcld/LD/LDSection.h"
 #include "mcld/LD/LDSymbol.h"
+#include "mcld/LD/LinkState.h"
 #include "mcld/LD/ObjectWriter.h"
 #include "mcld/LD/RelocData.h"
 #include "mcld/LD/SectionData.h"
@@ -27,16 +28,55 @@
 #include "mcld/Support/raw_ostream.h"
 #include "mcld/Target/TargetLDBackend.h"
 
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Process.h>
+
 #include <cassert>
 
 namespace mcld {
 
+/// openOutputFile - open a new file next to pPath for the output, whose name
+/// is returned in pTemp. If pPath exists but is not a regular file, e.g.,
+/// /dev/null, or if no file can be created next to it, pPath is opened
+/// instead and pTemp is left empty.
+static bool openOutputFile(const std::string& pPath,
+                           FileHandle::Permission pPermission,
+                           std::unique_ptr<FileHandle>& pFile,
+                           std::string& pTemp) {
+  llvm::sys::fs::file_status status;
+  bool in_place = !llvm::sys::fs::status(pPath, status) &&
+                  llvm::sys::fs::exists(status) &&
+                  !llvm::sys::fs::is_regular_file(status);
+
+  if (!in_place) {
+    FileHandle::OpenMode temp_mode(
+        FileHandle::ReadWrite | FileHandle::Create | FileHandle::Exclusive);
+    for (unsigned tries = 0; tries < 8; ++tries) {
+      std::string temp = pPath + ".tmp" +
+          llvm::utohexstr(llvm::sys::Process::GetRandomNumber());
+      pFile.reset(new FileHandle());
+      if (pFile->open(sys::fs::Path(temp), temp_mode, pPermission)) {
+        pTemp = temp;
+        return true;
+      }
+    }
+  }
+
+  FileHandle::OpenMode open_mode(
+      FileHandle::ReadWrite | FileHandle::Truncate | FileHandle::Create);
+  pFile.reset(new FileHandle());
+  pTemp.clear();
+  return pFile->open(sys::fs::Path(pPath), open_mode, pPermission);
+}
+
 Linker::Linker()
     : m_pConfig(NULL),
       m_pIRBuilder(NULL),
       m_pTarget(NULL),
       m_pBackend(NULL),
-      m_pObjLinker(NULL) {
+      m_pObjLinker(NULL),
+      m_bPatched(false) {
 }
 
 Linker::~Linker() {
@@ -46,8 +86,13 @@ Linker::~Linker() {
 /// emulate - To set up target-dependent options and default linker script.
 /// Follow GNU ld quirks.
 bool Linker::emulate(LinkerScript& pScript, LinkerConfig& pConfig) {
+  LinkerContext::Scope scope(m_Context);
+
   m_pConfig = &pConfig;
 
+  // this link reports to the diagnostic engine of its own context
+  InitializeDiagnosticEngine(pConfig);
+
   if (!initTarget())
     return false;
 
@@ -64,6 +109,12 @@ bool Linker::emulate(LinkerScript& pScript, LinkerConfig& pConfig) {
 }
 
 bool Linker::link(Module& pModule, IRBuilder& pBuilder) {
+  LinkerContext::Scope scope(m_Context);
+  m_bPatched = m_pConfig->options().isPatchIdenticalLayout() &&
+               LinkState::Patch(*m_pConfig, pModule.name());
+  if (m_bPatched)
+    return true;
+
   if (!normalize(pModule, pBuilder))
     return false;
 
@@ -75,6 +126,7 @@ bool Linker::link(Module& pModule, IRBuilder& pBuilder) {
 
 /// normalize - to convert the command line language to the input tree.
 bool Linker::normalize(Module& pModule, IRBuilder& pBuilder) {
+  LinkerContext::Scope scope(m_Context);
   assert(m_pConfig != NULL);
 
   m_pIRBuilder = &pBuilder;
@@ -163,6 +215,7 @@ bool Linker::normalize(Module& pModule, IRBuilder& pBuilder) {
 }
 
 bool Linker::resolve(Module& pModule) {
+  LinkerContext::Scope scope(m_Context);
   assert(m_pConfig != NULL);
   assert(m_pObjLinker != NULL);
 
@@ -200,6 +253,7 @@ bool Linker::resolve(Module& pModule) {
 }
 
 bool Linker::layout() {
+  LinkerContext::Scope scope(m_Context);
   assert(m_pConfig != NULL && m_pObjLinker != NULL);
 
   // 10. - add standard symbols, target-dependent symbols and script symbols
@@ -240,8 +294,16 @@ bool Linker::layout() {
 }
 
 bool Linker::emit(FileOutputBuffer& pOutput) {
+  LinkerContext::Scope scope(m_Context);
+  // the output has been patched, and there is no IR to emit
+  if (m_bPatched)
+    return false;
+
   // 15. - write out output
-  m_pObjLinker->emitOutput(pOutput);
+  // With --stream-relocations, the relocations are applied here. Stop at
+  // their errors, the caller then discards the output.
+  if (!m_pObjLinker->emitOutput(pOutput) || !Diagnose())
+    return false;
 
   // 16. - post processing
   m_pObjLinker->postProcessing(pOutput);
@@ -253,9 +315,13 @@ bool Linker::emit(FileOutputBuffer& pOutput) {
 }
 
 bool Linker::emit(const Module& pModule, const std::string& pPath) {
-  FileHandle file;
-  FileHandle::OpenMode open_mode(
-      FileHandle::ReadWrite | FileHandle::Truncate | FileHandle::Create);
+  LinkerContext::Scope scope(m_Context);
+  if (m_bPatched)
+    return (pPath == pModule.name());
+
+  // the output of the previous emit may still be closing
+  waitForOutput();
+
   FileHandle::Permission permission;
   switch (m_pConfig->codeGenType()) {
     case mcld::LinkerConfig::Unknown:
@@ -271,36 +337,142 @@ bool Linker::emit(const Module& pModule, const std::string& pPath) {
       assert(0 && "Unknown file type");
   }
 
-  bool result = file.open(sys::fs::Path(pPath), open_mode, permission);
+  // The output is written to a new file that replaces pPath at the end, so
+  // that neither a program running from pPath nor the output of the last
+  // link is destroyed by a link that fails.
+  std::unique_ptr<FileHandle> file;
+  std::string temp;
+  bool result = openOutputFile(pPath, permission, file, temp);
   if (!result) {
     error(diag::err_cannot_open_output_file) << "Linker::emit()" << pPath;
     return false;
   }
 
   std::unique_ptr<FileOutputBuffer> output;
-  FileOutputBuffer::create(
-      file, m_pObjLinker->getWriter()->getOutputSize(pModule), output);
+  if (!createOutputBuffer(pModule, *file, output)) {
+    file->close();
+    if (!temp.empty())
+      llvm::sys::fs::remove(temp);
+    return false;
+  }
 
   result = emit(*output);
-  file.close();
+
+  // --patch-identical-layout: record the link for the next one. A stale
+  // state never
+  // outlives its output.
+  LinkState state;
+  bool record = result && m_pConfig->options().isPatchIdenticalLayout() &&
+                LinkState::IsSupported(*m_pConfig) &&
+                state.record(pModule, *m_pConfig,
+                             *m_pBackend->getRelocator(), *output);
+  // a failed link writes no output that looks complete
+  if (result && !commitOutputBuffer(*output))
+    result = record = false;
+
+  if (!temp.empty()) {
+    if (result) {
+      std::error_code ec = llvm::sys::fs::rename(temp, pPath);
+      if (ec) {
+        error(diag::fatal_cannot_rename_output) << temp << pPath
+                                                << ec.message();
+        result = record = false;
+      }
+    }
+    if (!result)
+      llvm::sys::fs::remove(temp);
+  } else if (!result) {
+    discardOutput(output, *file);
+  }
+  closeOutput(output, file);
+
+  if (!record || !state.write(pPath))
+    LinkState::Remove(pPath);
   return result;
 }
 
 bool Linker::emit(const Module& pModule, int pFileDescriptor) {
-  FileHandle file;
-  file.delegate(pFileDescriptor);
+  LinkerContext::Scope scope(m_Context);
+  // the output of the previous emit may still be closing
+  waitForOutput();
+
+  // the handle outlives this call if the output is closed on another thread
+  std::unique_ptr<FileHandle> file(new FileHandle());
+  file->delegate(pFileDescriptor);
 
   std::unique_ptr<FileOutputBuffer> output;
-  FileOutputBuffer::create(
-      file, m_pObjLinker->getWriter()->getOutputSize(pModule), output);
+  if (!createOutputBuffer(pModule, *file, output))
+    return false;
+
+  bool result = emit(*output);
+  if (result && !commitOutputBuffer(*output))
+    result = false;
+  if (!result)
+    discardOutput(output, *file);
+  closeOutput(output, file);
+  return result;
+}
 
-  return emit(*output);
+bool Linker::createOutputBuffer(const Module& pModule,
+                                FileHandle& pFile,
+                                std::unique_ptr<FileOutputBuffer>& pOutput) {
+  std::error_code ec = FileOutputBuffer::create(
+      pFile,
+      m_pObjLinker->getWriter()->getOutputSize(pModule),
+      pOutput,
+      m_pConfig->options().streamOutputThreshold());
+  if (ec) {
+    error(diag::err_cannot_open_output_file) << pFile.path().native()
+                                             << ec.message();
+    return false;
+  }
+  return true;
+}
+
+bool Linker::commitOutputBuffer(FileOutputBuffer& pOutput) {
+  if (pOutput.commit()) {
+    error(diag::fatal_unwritable_output) << pOutput.getPath();
+    return false;
+  }
+  return true;
+}
+
+void Linker::discardOutput(std::unique_ptr<FileOutputBuffer>& pOutput,
+                           FileHandle& pFile) {
+  // unmap the output first, truncating the file drops its dirty pages
+  pOutput.reset();
+  llvm::sys::fs::resize_file(pFile.handler(), 0);
+}
+
+void Linker::closeOutput(std::unique_ptr<FileOutputBuffer>& pOutput,
+                         std::unique_ptr<FileHandle>& pFile) {
+  FileOutputBuffer* output = pOutput.release();
+  FileHandle* file = pFile.release();
+
+  // Unmapping a large output waits for the kernel to tear down its pages,
+  // which the link need not wait for.
+  if (m_pConfig->options().numThreads() > 1) {
+    m_OutputCloser = std::thread([output, file]() {
+      delete output;
+      delete file;
+    });
+    return;
+  }
+  delete output;
+  delete file;
+}
+
+void Linker::waitForOutput() {
+  if (m_OutputCloser.joinable())
+    m_OutputCloser.join();
 }
 
 bool Linker::reset() {
+  LinkerContext::Scope scope(m_Context);
   m_pConfig = NULL;
   m_pIRBuilder = NULL;
   m_pTarget = NULL;
+  m_bPatched = false;
 
   // Because llvm::iplist will touch the removed node, we must clear
   // RelocData before deleting target backend.
@@ -314,10 +486,13 @@ bool Linker::reset() {
   delete m_pObjLinker;
   m_pObjLinker = NULL;
 
-  LDSection::Clear();
-  LDSymbol::Clear();
-  FragmentRef::Clear();
-  Relocation::Clear();
+  // Release the rest of this link at once: sections, symbols, fragment
+  // references, relocations, script tokens, ...
+  m_Context.release();
+
+  // The output of the last emit owns none of the above, so it keeps closing
+  // while the context is released.
+  waitForOutput();
   return true;
 }
 
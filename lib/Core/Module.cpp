@@ -34,23 +34,31 @@ Module::Module(const std::string& pName, LinkerScript& pScript)
 Module::~Module() {
 }
 
-// Following two functions will be obsolette when we have new section merger.
 LDSection* Module::getSection(const std::string& pName) {
-  iterator sect, sectEnd = end();
-  for (sect = begin(); sect != sectEnd; ++sect) {
-    if ((*sect)->name() == pName)
-      return *sect;
-  }
-  return NULL;
+  return findSection(pName);
 }
 
 const LDSection* Module::getSection(const std::string& pName) const {
-  const_iterator sect, sectEnd = end();
-  for (sect = begin(); sect != sectEnd; ++sect) {
-    if ((*sect)->name() == pName)
-      return *sect;
-  }
-  return NULL;
+  return findSection(pName);
+}
+
+void Module::addSection(LDSection& pSection) {
+  // the first section of a name is kept in the index
+  m_SectionIndex.insert(
+      std::make_pair(llvm::StringRef(pSection.name()), &pSection));
+  m_SectionTable.push_back(&pSection);
+}
+
+void Module::clearSections() {
+  m_SectionTable.clear();
+  m_SectionIndex.clear();
+}
+
+LDSection* Module::findSection(const std::string& pName) const {
+  SectionIndex::const_iterator entry = m_SectionIndex.find(pName);
+  if (entry == m_SectionIndex.end())
+    return NULL;
+  return entry->second;
 }
 
 void Module::CreateAliasList(const ResolveInfo& pSym) {
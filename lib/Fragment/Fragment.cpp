@@ -30,6 +30,12 @@ Fragment::Fragment(Type pKind, SectionData* pParent)
 Fragment::~Fragment() {
 }
 
+void Fragment::setOffset(uint64_t pOffset) {
+  m_Offset = pOffset;
+  if (m_pParent != NULL)
+    m_pParent->invalidateOffsetIndex();
+}
+
 uint64_t Fragment::getOffset() const {
   assert(hasOffset() && "Cannot getOffset() before setting it up.");
   return m_Offset;
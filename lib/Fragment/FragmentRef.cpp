@@ -15,10 +15,10 @@
 #include "mcld/LD/LDSection.h"
 #include "mcld/LD/SectionData.h"
 #include "mcld/Support/GCFactory.h"
+#include "mcld/Support/LinkerContext.h"
 
 #include <llvm/ADT/StringRef.h>
 #include <llvm/Support/Casting.h>
-#include <llvm/Support/ManagedStatic.h>
 
 #include <cassert>
 
@@ -26,10 +26,14 @@ namespace mcld {
 
 typedef GCFactory<FragmentRef, MCLD_SECTIONS_PER_INPUT> FragRefFactory;
 
-static llvm::ManagedStatic<FragRefFactory> g_FragRefFactory;
+static ContextStatic<FragRefFactory> g_FragRefFactory;
 
 FragmentRef FragmentRef::g_NullFragmentRef;
 
+/// the number of fragments FragmentRef::Find walks through before it looks
+/// up the offset index of the section
+static const unsigned int kMaxWalkSteps = 8;
+
 //===----------------------------------------------------------------------===//
 // FragmentRef
 //===----------------------------------------------------------------------===//
@@ -40,22 +44,40 @@ FragmentRef::FragmentRef(Fragment& pFrag, FragmentRef::Offset pOffset)
     : m_pFragment(&pFrag), m_Offset(pOffset) {
 }
 
-/// Create - create a fragment reference for a given fragment.
+/// Find - find the fragment at pOffset from pFrag.
 ///
 /// @param pFrag - the given fragment
 /// @param pOffset - the offset, can be larger than the fragment, but can not
 ///                  be larger than the section size.
-/// @return if the offset is legal, return the fragment reference. Otherwise,
-/// return NULL.
-FragmentRef* FragmentRef::Create(Fragment& pFrag, uint64_t pOffset) {
+/// @param pResult - the fragment reference of the place
+/// @return if the offset is legal, return true.
+bool FragmentRef::Find(Fragment& pFrag, uint64_t pOffset,
+                       FragmentRef& pResult) {
   int64_t offset = pOffset;
   Fragment* frag = &pFrag;
+  unsigned int steps = 0;
 
   while (frag != NULL) {
     offset -= frag->size();
     if (offset <= 0)
       break;
     frag = frag->getNextNode();
+
+    // the offset is far from the front of the section, look it up by the
+    // offset index of the section instead
+    if (++steps == kMaxWalkSteps && frag != NULL) {
+      SectionData* data = pFrag.getParent();
+      if (data != NULL && !data->empty() && &data->front() == &pFrag) {
+        Fragment* found = NULL;
+        uint64_t found_offset = 0;
+        if (data->findFragment(pOffset, found, found_offset)) {
+          if (found == NULL)
+            return false;
+          pResult.assign(*found, found_offset);
+          return true;
+        }
+      }
+    }
   }
   if ((frag != NULL) && (frag->size() != 0)) {
     if (offset == 0)
@@ -65,15 +87,14 @@ FragmentRef* FragmentRef::Create(Fragment& pFrag, uint64_t pOffset) {
   }
 
   if (frag == NULL)
-    return Null();
-
-  FragmentRef* result = g_FragRefFactory->allocate();
-  new (result) FragmentRef(*frag, offset);
+    return false;
 
-  return result;
+  pResult.assign(*frag, offset);
+  return true;
 }
 
-FragmentRef* FragmentRef::Create(LDSection& pSection, uint64_t pOffset) {
+bool FragmentRef::Find(LDSection& pSection, uint64_t pOffset,
+                       FragmentRef& pResult) {
   SectionData* data = NULL;
   switch (pSection.kind()) {
     case LDFileFormat::Relocation:
@@ -88,11 +109,39 @@ FragmentRef* FragmentRef::Create(LDSection& pSection, uint64_t pOffset) {
       break;
   }
 
-  if (data == NULL || data->empty()) {
+  if (data == NULL || data->empty())
+    return false;
+
+  return Find(data->front(), pOffset, pResult);
+}
+
+/// Create - create a fragment reference for a given fragment.
+///
+/// @param pFrag - the given fragment
+/// @param pOffset - the offset, can be larger than the fragment, but can not
+///                  be larger than the section size.
+/// @return if the offset is legal, return the fragment reference. Otherwise,
+/// return NULL.
+FragmentRef* FragmentRef::Create(Fragment& pFrag, uint64_t pOffset) {
+  FragmentRef place;
+  if (!Find(pFrag, pOffset, place))
     return Null();
-  }
 
-  return Create(data->front(), pOffset);
+  FragmentRef* result = g_FragRefFactory->allocate();
+  new (result) FragmentRef(*place.frag(), place.offset());
+
+  return result;
+}
+
+FragmentRef* FragmentRef::Create(LDSection& pSection, uint64_t pOffset) {
+  FragmentRef place;
+  if (!Find(pSection, pOffset, place))
+    return Null();
+
+  FragmentRef* result = g_FragRefFactory->allocate();
+  new (result) FragmentRef(*place.frag(), place.offset());
+
+  return result;
 }
 
 void FragmentRef::Clear() {
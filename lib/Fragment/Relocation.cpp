@@ -14,13 +14,11 @@
 #include "mcld/LD/Relocator.h"
 #include "mcld/LD/ResolveInfo.h"
 #include "mcld/LD/SectionData.h"
-#include "mcld/Support/MsgHandling.h"
-
-#include <llvm/Support/ManagedStatic.h>
+#include "mcld/Support/LinkerContext.h"
 
 namespace mcld {
 
-static llvm::ManagedStatic<RelocationFactory> g_RelocationFactory;
+static ContextStatic<RelocationFactory> g_RelocationFactory;
 
 //===----------------------------------------------------------------------===//
 // Relocation Factory Methods
@@ -50,12 +48,28 @@ Relocation* Relocation::Create(Type pType,
   return g_RelocationFactory->produce(pType, pFragRef, pAddend);
 }
 
+/// Create - produce a relocation entry that applies to pOffset of pSection
+Relocation* Relocation::Create(Type pType,
+                               LDSection& pSection,
+                               uint64_t pOffset,
+                               Address pAddend) {
+  FragmentRef place;
+  if (!FragmentRef::Find(pSection, pOffset, place))
+    return Create(pType, *FragmentRef::Null(), pAddend);
+  return Create(pType, place, pAddend);
+}
+
 /// Destroy - destroy a relocation entry
 void Relocation::Destroy(Relocation*& pRelocation) {
   g_RelocationFactory->destroy(pRelocation);
   pRelocation = NULL;
 }
 
+/// ReadTarget - read the target data at pFragRef
+Relocation::DWord Relocation::ReadTarget(const FragmentRef& pFragRef) {
+  return g_RelocationFactory->readTarget(pFragRef);
+}
+
 //===----------------------------------------------------------------------===//
 // Relocation
 //===----------------------------------------------------------------------===//
@@ -94,33 +108,7 @@ Relocation::Address Relocation::symValue() const {
 }
 
 void Relocation::apply(Relocator& pRelocator) {
-  Relocator::Result result = pRelocator.applyRelocation(*this);
-
-  switch (result) {
-    case Relocator::OK: {
-      // do nothing
-      return;
-    }
-    case Relocator::Overflow: {
-      error(diag::result_overflow) << pRelocator.getName(type())
-                                   << symInfo()->name();
-      return;
-    }
-    case Relocator::BadReloc: {
-      error(diag::result_badreloc) << pRelocator.getName(type())
-                                   << symInfo()->name();
-      return;
-    }
-    case Relocator::Unsupported: {
-      fatal(diag::unsupported_relocation) << type()
-                                          << "mclinker@googlegroups.com";
-      return;
-    }
-    case Relocator::Unknown: {
-      fatal(diag::unknown_relocation) << type() << symInfo()->name();
-      return;
-    }
-  }  // end of switch
+  pRelocator.issueApplyResult(*this, pRelocator.applyRelocation(*this));
 }
 
 void Relocation::setType(Type pType) {
@@ -30,6 +30,8 @@ Archive::Archive(Input& pInputFile, InputBuilder& pBuilder)
     : m_ArchiveFile(pInputFile),
       m_pInputTree(NULL),
       m_SymbolFactory(32),
+      m_SymTabSize(0),
+      m_UndefCursor(0),
       m_Builder(pBuilder) {
   // FIXME: move creation of input tree out of Archive.
   m_pInputTree = new InputTree();
@@ -171,9 +173,21 @@ void Archive::addSymbol(const char* pName,
                         enum Archive::Symbol::Status pStatus) {
   Symbol* entry = m_SymbolFactory.allocate();
   new (entry) Symbol(pName, pFileOffset, pStatus);
+  // keep the first entry of the name, which is the one the members are
+  // searched in
+  m_SymIndex.insert(std::make_pair(entry->name, m_SymTab.size()));
   m_SymTab.push_back(entry);
 }
 
+/// findSymbol - find the first symtab entry of the given name
+bool Archive::findSymbol(const llvm::StringRef& pName, size_t& pSymIdx) const {
+  llvm::StringMap<size_t>::const_iterator it = m_SymIndex.find(pName);
+  if (it == m_SymIndex.end())
+    return false;
+  pSymIdx = it->getValue();
+  return true;
+}
+
 /// getSymbolName - get the symbol name with the given index
 const std::string& Archive::getSymbolName(size_t pSymIdx) const {
   assert(pSymIdx < numOfSymbols());
@@ -199,6 +213,18 @@ void Archive::setSymbolStatus(size_t pSymIdx,
   m_SymTab[pSymIdx]->status = pStatus;
 }
 
+/// getUndefCursor - get the number of the undefined symbols in the NamePool
+/// that have been looked up in this archive
+size_t Archive::getUndefCursor() const {
+  return m_UndefCursor;
+}
+
+/// setUndefCursor - set the number of the undefined symbols in the NamePool
+/// that have been looked up in this archive
+void Archive::setUndefCursor(size_t pCursor) {
+  m_UndefCursor = pCursor;
+}
+
 /// getStrTable - get the extended name table
 std::string& Archive::getStrTable() {
   return m_StrTab;
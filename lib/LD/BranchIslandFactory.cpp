@@ -9,12 +9,22 @@
 #include "mcld/LD/BranchIslandFactory.h"
 
 #include "mcld/Fragment/Fragment.h"
-#include "mcld/LD/LDSection.h"
 #include "mcld/LD/SectionData.h"
-#include "mcld/Module.h"
+
+#include <algorithm>
+#include <cassert>
 
 namespace mcld {
 
+namespace {
+
+/// isBefore - whether pOffset is before the island pIsland
+bool isBefore(uint64_t pOffset, const BranchIsland* pIsland) {
+  return pOffset < pIsland->offset();
+}
+
+}  // anonymous namespace
+
 //===----------------------------------------------------------------------===//
 // BranchIslandFactory
 //===----------------------------------------------------------------------===//
@@ -37,27 +47,28 @@ BranchIslandFactory::~BranchIslandFactory() {
 
 /// group - group fragments and create islands when needed
 /// @param pSectionData - the SectionData holds fragments need to be grouped
-void BranchIslandFactory::group(Module& pModule) {
-  /* FIXME: Currently only support relaxing .text section! */
-  LDSection* text = pModule.getSection(".text");
-  if (text != NULL && text->hasSectionData()) {
-    SectionData& sd = *text->getSectionData();
-    uint64_t group_end = m_MaxFwdBranchRange;
-    for (SectionData::iterator it = sd.begin(), ie = sd.end(); it != ie; ++it) {
-      if ((*it).getOffset() + (*it).size() > group_end) {
-        Fragment* frag = (*it).getPrevNode();
-        while (frag != NULL && frag->getKind() == Fragment::Alignment) {
-          frag = frag->getPrevNode();
-        }
-        if (frag != NULL) {
-          produce(*frag);
-          group_end = (*it).getOffset() + m_MaxFwdBranchRange;
-        }
+void BranchIslandFactory::group(SectionData& pSectionData) {
+  if (pSectionData.empty())
+    return;
+
+  uint64_t group_end = m_MaxFwdBranchRange;
+  for (SectionData::iterator it = pSectionData.begin(),
+                             ie = pSectionData.end();
+       it != ie;
+       ++it) {
+    if ((*it).getOffset() + (*it).size() > group_end) {
+      Fragment* frag = (*it).getPrevNode();
+      while (frag != NULL && frag->getKind() == Fragment::Alignment) {
+        frag = frag->getPrevNode();
+      }
+      if (frag != NULL) {
+        produce(*frag);
+        group_end = (*it).getOffset() + m_MaxFwdBranchRange;
       }
     }
-    if (getIslands(sd.back()).first == NULL)
-      produce(sd.back());
   }
+  if (getIslands(pSectionData.back()).first == NULL)
+    produce(pSectionData.back());
 }
 
 /// produce - produce a island for the given fragment
@@ -67,6 +78,9 @@ BranchIsland* BranchIslandFactory::produce(Fragment& pFragment) {
   new (island) BranchIsland(pFragment,        // entry fragment to the island
                             m_MaxIslandSize,  // the max size of the island
                             size() - 1u);     // index in the island factory
+  IslandList& islands = m_Islands[pFragment.getParent()];
+  assert(islands.empty() || islands.back()->offset() <= island->offset());
+  islands.push_back(island);
   return island;
 }
 
@@ -76,20 +90,25 @@ std::pair<BranchIsland*, BranchIsland*> BranchIslandFactory::getIslands(
     const Fragment& pFragment) {
   BranchIsland* fwd = NULL;
   BranchIsland* bwd = NULL;
-  for (iterator it = begin(), ie = end(), prev = ie; it != ie;
-       prev = it, ++it) {
-    if ((pFragment.getOffset() < (*it).offset()) &&
-        ((pFragment.getOffset() + m_MaxFwdBranchRange) >= (*it).offset())) {
-      fwd = &*it;
-
-      if (prev != ie) {
-        int64_t bwd_off = (int64_t)pFragment.getOffset() + m_MaxBwdBranchRange;
-        if ((pFragment.getOffset() > (*prev).offset()) &&
-            (bwd_off <= (int64_t)(*prev).offset())) {
-          bwd = &*prev;
-        }
-      }
-      break;
+  // the fwd island is the first one after the fragment, and the bwd island is
+  // the one before it
+  IslandMap::iterator entry = m_Islands.find(pFragment.getParent());
+  if (entry == m_Islands.end())
+    return std::make_pair(fwd, bwd);
+
+  IslandList& islands = entry->second;
+  uint64_t frag_off = pFragment.getOffset();
+  IslandList::iterator it =
+      std::upper_bound(islands.begin(), islands.end(), frag_off, isBefore);
+  if (it != islands.end() &&
+      ((frag_off + m_MaxFwdBranchRange) >= (*it)->offset())) {
+    fwd = *it;
+
+    if (it != islands.begin()) {
+      BranchIsland* prev = *(it - 1);
+      int64_t bwd_off = (int64_t)frag_off + m_MaxBwdBranchRange;
+      if ((frag_off > prev->offset()) && (bwd_off <= (int64_t)prev->offset()))
+        bwd = prev;
     }
   }
   return std::make_pair(fwd, bwd);
@@ -0,0 +1,178 @@
+//===- BuildID.cpp --------------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "mcld/LD/BuildID.h"
+
+#include "mcld/GeneralOptions.h"
+#include "mcld/LinkerConfig.h"
+#include "mcld/LD/LDSection.h"
+#include "mcld/Support/FileOutputBuffer.h"
+#include "mcld/Support/Parallel.h"
+#include "mcld/Support/SHA1.h"
+#include "mcld/Support/XXHash.h"
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/Support/MD5.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace mcld {
+
+//===----------------------------------------------------------------------===//
+// Helper Functions
+//===----------------------------------------------------------------------===//
+namespace {
+
+/// the size of the note header and its name "GNU\0"
+const size_t NoteHeaderSize = 16;
+
+/// NT_GNU_BUILD_ID
+const uint32_t NoteGNUBuildID = 3;
+
+/// the size of the chunks hashed on the worker threads
+const size_t ChunkSize = 1024 * 1024;
+
+typedef void (*DigestFunc)(const uint8_t* pData, size_t pSize,
+                           uint8_t* pResult);
+
+void fastDigest(const uint8_t* pData, size_t pSize, uint8_t* pResult) {
+  uint64_t hash = xxHash64(pData, pSize);
+  for (unsigned i = 0; i < 8; ++i)
+    pResult[i] = static_cast<uint8_t>(hash >> (8 * i));
+}
+
+void md5Digest(const uint8_t* pData, size_t pSize, uint8_t* pResult) {
+  llvm::MD5 md5;
+  md5.update(llvm::ArrayRef<uint8_t>(pData, pSize));
+  llvm::MD5::MD5Result result;
+  md5.final(result);
+  std::memcpy(pResult, &result[0], 16);
+}
+
+void sha1Digest(const uint8_t* pData, size_t pSize, uint8_t* pResult) {
+  SHA1 sha1;
+  sha1.update(pData, pSize);
+  sha1.final(pResult);
+}
+
+/// treeDigest - digest every chunk of the data on pThreads threads, and then
+/// digest the concatenated chunk digests into pResult
+void treeDigest(const uint8_t* pData,
+                size_t pSize,
+                DigestFunc pDigest,
+                size_t pDigestSize,
+                unsigned pThreads,
+                uint8_t* pResult) {
+  size_t num_chunks = std::max<size_t>(1, (pSize + ChunkSize - 1) / ChunkSize);
+  std::vector<uint8_t> leaves(num_chunks * pDigestSize);
+  parallelFor(pThreads, 0, num_chunks, [&](size_t pIdx) {
+    size_t offset = pIdx * ChunkSize;
+    size_t size = std::min(ChunkSize, pSize - offset);
+    pDigest(pData + offset, size, &leaves[pIdx * pDigestSize]);
+  });
+  pDigest(leaves.data(), leaves.size(), pResult);
+}
+
+void write32(uint8_t* pDest, uint32_t pValue, bool pIsLittleEndian) {
+  for (unsigned i = 0; i < 4; ++i) {
+    unsigned shift = pIsLittleEndian ? (8 * i) : (24 - 8 * i);
+    pDest[i] = static_cast<uint8_t>(pValue >> shift);
+  }
+}
+
+}  // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// BuildID
+//===----------------------------------------------------------------------===//
+BuildID::BuildID(LDSection& pSection, const LinkerConfig& pConfig)
+    : m_Section(pSection), m_Config(pConfig) {
+}
+
+BuildID::~BuildID() {
+}
+
+size_t BuildID::getDescSize() const {
+  switch (m_Config.options().getBuildIDStyle()) {
+    case GeneralOptions::BuildIDStyle::Fast:
+      return 8;
+    case GeneralOptions::BuildIDStyle::MD5:
+    case GeneralOptions::BuildIDStyle::UUID:
+      return 16;
+    case GeneralOptions::BuildIDStyle::SHA1:
+      return SHA1::DigestSize;
+    case GeneralOptions::BuildIDStyle::Hex:
+      return m_Config.options().getBuildIDValue().size();
+    default:
+      return 0;
+  }
+}
+
+void BuildID::sizeOutput() {
+  size_t size = getDescSize();
+  if (size != 0)
+    size += NoteHeaderSize;
+  m_Section.setSize((size + 3) & ~size_t(3));
+}
+
+void BuildID::emitOutput(FileOutputBuffer& pOutput) {
+  MemoryRegion region = pOutput.request(m_Section.offset(), m_Section.size());
+  if (region.size() < NoteHeaderSize)
+    return;
+
+  uint8_t* note = region.begin();
+  bool is_little_endian = m_Config.targets().isLittleEndian();
+  write32(note, 4, is_little_endian);
+  write32(note + 4, getDescSize(), is_little_endian);
+  write32(note + 8, NoteGNUBuildID, is_little_endian);
+  std::memcpy(note + 12, "GNU", 4);
+
+  // the build ID is still zero while the output is hashed
+  computeID(pOutput.getBufferStart(), pOutput.getBufferSize(),
+            note + NoteHeaderSize);
+}
+
+void BuildID::computeID(const uint8_t* pData,
+                        size_t pSize,
+                        uint8_t* pResult) const {
+  unsigned threads = m_Config.options().numThreads();
+  switch (m_Config.options().getBuildIDStyle()) {
+    case GeneralOptions::BuildIDStyle::Fast:
+      treeDigest(pData, pSize, fastDigest, 8, threads, pResult);
+      break;
+    case GeneralOptions::BuildIDStyle::MD5:
+      treeDigest(pData, pSize, md5Digest, 16, threads, pResult);
+      break;
+    case GeneralOptions::BuildIDStyle::SHA1:
+      treeDigest(pData, pSize, sha1Digest, SHA1::DigestSize, threads, pResult);
+      break;
+    case GeneralOptions::BuildIDStyle::UUID: {
+      // random UUID (RFC 4122 version 4)
+      std::random_device random;
+      for (unsigned i = 0; i < 16; i += 4)
+        write32(pResult + i, random(), true);
+      pResult[6] = (pResult[6] & 0x0f) | 0x40;
+      pResult[8] = (pResult[8] & 0x3f) | 0x80;
+      break;
+    }
+    case GeneralOptions::BuildIDStyle::Hex: {
+      const std::string& value = m_Config.options().getBuildIDValue();
+      std::memcpy(pResult, value.data(), value.size());
+      break;
+    }
+    default:
+      assert(false && "no build ID to compute");
+      break;
+  }
+}
+
+}  // namespace mcld
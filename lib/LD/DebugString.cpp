@@ -15,25 +15,17 @@
 #include "mcld/Fragment/Fragment.h"
 #include "mcld/Fragment/RegionFragment.h"
 #include "mcld/Fragment/Relocation.h"
+#include "mcld/Support/LinkerContext.h"
 #include "mcld/Target/TargetLDBackend.h"
 #include "mcld/LD/Relocator.h"
 
 #include <llvm/Support/Casting.h>
-#include <llvm/Support/ManagedStatic.h>
 
 namespace mcld {
 
 // DebugString represents the output .debug_str section, which is at most on
 // in each linking
-static llvm::ManagedStatic<DebugString> g_DebugString;
-
-static inline size_t string_length(const char* pStr) {
-  const char* p = pStr;
-  size_t len = 0;
-  for (; *p != 0; ++p)
-    ++len;
-  return len;
-}
+static ContextStatic<DebugString> g_DebugString;
 
 //==========================
 // DebugString
@@ -44,22 +36,17 @@ void DebugString::merge(LDSection& pSection) {
   for (it = pSection.getSectionData()->begin(); it != end; ++it) {
     if ((*it).getKind() == Fragment::Region) {
       RegionFragment* frag = llvm::cast<RegionFragment>(&(*it));
-      strings = frag->getRegion().data();
+      strings = frag->getRegion();
     }
   }
 
-  // get the debug strings and add them into merged string table
-  const char* str = strings.data();
-  const char* str_end = str + pSection.size();
-  while (str < str_end) {
-    size_t len = string_length(str);
-    m_StringTable.insertString(llvm::StringRef(str, len));
-    str = str + len + 1;
-  }
+  // the strings are split and hashed in computeOffsetSize
+  m_InputMap[&pSection] =
+      m_StringTable.addStrings(strings.substr(0, pSection.size()));
 }
 
-size_t DebugString::computeOffsetSize() {
-  size_t size = m_StringTable.finalizeOffset();
+size_t DebugString::computeOffsetSize(unsigned pThreads) {
+  size_t size = m_StringTable.finalizeOffset(pThreads);
   m_pSection->setSize(size);
   return size;
 }
@@ -68,23 +55,20 @@ void DebugString::applyOffset(Relocation& pReloc, TargetLDBackend& pBackend) {
   // get the refered string
   ResolveInfo* info = pReloc.symInfo();
   // the symbol should point to the first region fragment in the debug
-  // string section, get the input .debut_str region
-  llvm::StringRef d_str;
-  if (info->outSymbol()->fragRef()->frag()->getKind() == Fragment::Region) {
-    RegionFragment* frag =
-        llvm::cast<RegionFragment>(info->outSymbol()->fragRef()->frag());
-    d_str = frag->getRegion();
-  }
+  // string section, get the input .debug_str
+  const SectionData* data = info->outSymbol()->fragRef()->frag()->getParent();
+  std::unordered_map<const LDSection*, size_t>::const_iterator input =
+      m_InputMap.find(&data->getSection());
+  assert(input != m_InputMap.end());
   uint32_t offset = pBackend.getRelocator()->getDebugStringOffset(pReloc);
-  const char* str = d_str.data() + offset;
 
   // apply the relocation
   pBackend.getRelocator()->applyDebugStringOffset(pReloc,
-      m_StringTable.getOutputOffset(llvm::StringRef(str, string_length(str))));
+      m_StringTable.getOutputOffset(input->second, offset));
 }
 
-void DebugString::emit(MemoryRegion& pRegion) {
-  return m_StringTable.emit(pRegion);
+void DebugString::emit(MemoryRegion& pRegion, unsigned pThreads) {
+  return m_StringTable.emit(pRegion, pThreads);
 }
 
 DebugString* DebugString::Create(LDSection& pSection) {
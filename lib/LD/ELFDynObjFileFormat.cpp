@@ -89,6 +89,11 @@ void ELFDynObjFileFormat::initObjectFormat(ObjectBuilder& pBuilder,
                                          llvm::ELF::SHT_GNU_HASH,
                                          llvm::ELF::SHF_ALLOC,
                                          pBitClass / 8);
+  f_pNoteGNUBuildID = pBuilder.CreateSection(".note.gnu.build-id",
+                                             LDFileFormat::Note,
+                                             llvm::ELF::SHT_NOTE,
+                                             llvm::ELF::SHF_ALLOC,
+                                             0x4);
 }
 
 }  // namespace mcld
@@ -11,6 +11,7 @@
 #include "mcld/IRBuilder.h"
 #include "mcld/LinkerConfig.h"
 #include "mcld/LD/ELFReader.h"
+#include "mcld/LD/InputCache.h"
 #include "mcld/LD/LDContext.h"
 #include "mcld/MC/Input.h"
 #include "mcld/Support/MemoryArea.h"
@@ -107,12 +108,25 @@ bool ELFDynObjReader::readSymbols(Input& pInput) {
     return false;
   }
 
+  // reuse the symbols decoded by a previous link of a linker server
+  InputCache* cache = InputCache::Get();
+  InputCache::Entry* entry = (cache != NULL) ? cache->lookup(pInput) : NULL;
+  if (entry != NULL && entry->hasDynSymbols)
+    return m_pELFReader->addSymbols(pInput, m_Builder, entry->dynSymbols);
+
   llvm::StringRef symtab_region = pInput.memArea()->request(
       pInput.fileOffset() + symtab_shdr->offset(), symtab_shdr->size());
 
   llvm::StringRef strtab_region = pInput.memArea()->request(
       pInput.fileOffset() + strtab_shdr->offset(), strtab_shdr->size());
   const char* strtab = strtab_region.begin();
+
+  if (entry != NULL) {
+    m_pELFReader->decodeSymbols(symtab_region, strtab, entry->dynSymbols);
+    entry->hasDynSymbols = true;
+    return m_pELFReader->addSymbols(pInput, m_Builder, entry->dynSymbols);
+  }
+
   bool result =
       m_pELFReader->readSymbols(pInput, m_Builder, symtab_region, strtab);
   return result;
@@ -60,7 +60,8 @@ ELFFileFormat::ELFFileFormat()
       f_pStack(NULL),
       f_pStackNote(NULL),
       f_pDataRelRoLocal(NULL),
-      f_pGNUHashTab(NULL) {
+      f_pGNUHashTab(NULL),
+      f_pNoteGNUBuildID(NULL) {
 }
 
 void ELFFileFormat::initStdSections(ObjectBuilder& pBuilder,
@@ -25,9 +25,20 @@
 
 #include <string>
 #include <cassert>
+#include <cstring>
 
 namespace mcld {
 
+//===----------------------------------------------------------------------===//
+// ELFObjectReader::PreparedInput
+//===----------------------------------------------------------------------===//
+/// PreparedInput - the tables of an input decoded by prepare()
+struct ELFObjectReader::PreparedInput {
+  ELFReaderIF::SectionHeaderList headers;
+  ELFReaderIF::SymbolList symbols;
+  size_t symtab;  ///< index of .symtab, or 0 if symbols are not prepared
+};
+
 //===----------------------------------------------------------------------===//
 // ELFObjectReader
 //===----------------------------------------------------------------------===//
@@ -89,10 +100,72 @@ bool ELFObjectReader::isMyFormat(Input& pInput, bool& pContinue) const {
   return result;
 }
 
+/// prepare - decode the section header table and the symbol table.
+bool ELFObjectReader::prepare(Input& pInput) {
+  assert(pInput.hasMemArea());
+
+  size_t hdr_size = m_pELFReader->getELFHeaderSize();
+  if (pInput.memArea()->size() < hdr_size)
+    return false;
+
+  llvm::StringRef region =
+      pInput.memArea()->request(pInput.fileOffset(), hdr_size);
+  std::unique_ptr<PreparedInput> prepared(new PreparedInput());
+  prepared->symtab = 0;
+  if (!m_pELFReader->decodeSectionHeaders(
+          pInput, region.begin(), prepared->headers))
+    return false;
+
+  // find .symtab and its string table the same way as readSymbols() does.
+  // Anything unusual is left to readSymbols() to diagnose.
+  for (size_t idx = 0; idx < prepared->headers.size(); ++idx) {
+    const ELFReaderIF::SectionHeaderEntry& symtab = prepared->headers[idx];
+    if (strcmp(symtab.name, ".symtab") != 0)
+      continue;
+
+    if (symtab.link != 0 && symtab.link < prepared->headers.size()) {
+      const ELFReaderIF::SectionHeaderEntry& strtab =
+          prepared->headers[symtab.link];
+      llvm::StringRef symtab_region = pInput.memArea()->request(
+          pInput.fileOffset() + symtab.offset, symtab.size);
+      llvm::StringRef strtab_region = pInput.memArea()->request(
+          pInput.fileOffset() + strtab.offset, strtab.size);
+      m_pELFReader->decodeSymbols(
+          symtab_region, strtab_region.begin(), prepared->symbols);
+      prepared->symtab = idx;
+    }
+    break;
+  }
+
+  std::lock_guard<std::mutex> lock(m_PreparedMutex);
+  m_PreparedInputs[&pInput] = std::move(prepared);
+  return true;
+}
+
+/// findPrepared - return the data prepared for the input, or NULL
+ELFObjectReader::PreparedInput* ELFObjectReader::findPrepared(
+    const Input& pInput) {
+  std::lock_guard<std::mutex> lock(m_PreparedMutex);
+  PreparedMap::iterator entry = m_PreparedInputs.find(&pInput);
+  if (entry == m_PreparedInputs.end())
+    return NULL;
+  return entry->second.get();
+}
+
+/// dropPrepared - release the data prepared for the input
+void ELFObjectReader::dropPrepared(const Input& pInput) {
+  std::lock_guard<std::mutex> lock(m_PreparedMutex);
+  m_PreparedInputs.erase(&pInput);
+}
+
 /// readHeader - read section header and create LDSections.
 bool ELFObjectReader::readHeader(Input& pInput) {
   assert(pInput.hasMemArea());
 
+  PreparedInput* prepared = findPrepared(pInput);
+  if (prepared != NULL)
+    return m_pELFReader->createSections(pInput, prepared->headers);
+
   size_t hdr_size = m_pELFReader->getELFHeaderSize();
   if (pInput.memArea()->size() < hdr_size)
     return false;
@@ -279,6 +352,7 @@ bool ELFObjectReader::readSymbols(Input& pInput) {
   if (symtab_shdr == NULL) {
     note(diag::note_has_no_symtab) << pInput.name() << pInput.path()
                                    << ".symtab";
+    dropPrepared(pInput);
     return true;
   }
 
@@ -289,6 +363,14 @@ bool ELFObjectReader::readSymbols(Input& pInput) {
     return false;
   }
 
+  PreparedInput* prepared = findPrepared(pInput);
+  if (prepared != NULL && prepared->symtab == symtab_shdr->index()) {
+    bool result =
+        m_pELFReader->addSymbols(pInput, m_Builder, prepared->symbols);
+    dropPrepared(pInput);
+    return result;
+  }
+
   llvm::StringRef symtab_region = pInput.memArea()->request(
       pInput.fileOffset() + symtab_shdr->offset(), symtab_shdr->size());
   llvm::StringRef strtab_region = pInput.memArea()->request(
@@ -26,7 +26,9 @@
 #include "mcld/LD/LDSymbol.h"
 #include "mcld/LD/RelocData.h"
 #include "mcld/LD/SectionData.h"
+#include "mcld/LD/StringTableBuilder.h"
 #include "mcld/Support/MsgHandling.h"
+#include "mcld/Support/Parallel.h"
 #include "mcld/Target/GNUInfo.h"
 #include "mcld/Target/GNULDBackend.h"
 
@@ -35,6 +37,8 @@
 #include <llvm/Support/Errc.h>
 #include <llvm/Support/ErrorHandling.h>
 
+#include <vector>
+
 namespace mcld {
 
 //===----------------------------------------------------------------------===//
@@ -50,7 +54,8 @@ ELFObjectWriter::~ELFObjectWriter() {
 
 void ELFObjectWriter::writeSection(Module& pModule,
                                    FileOutputBuffer& pOutput,
-                                   LDSection* section) {
+                                   LDSection* section,
+                                   unsigned pThreads) {
   MemoryRegion region;
   // Request output region
   switch (section->kind()) {
@@ -94,10 +99,10 @@ void ELFObjectWriter::writeSection(Module& pModule,
     case LDFileFormat::DATA:
     case LDFileFormat::Debug:
     case LDFileFormat::Note:
-      emitSectionData(*section, region);
+      emitSectionData(*section, region, pThreads);
       break;
     case LDFileFormat::EhFrame:
-      emitEhFrame(pModule, *section->getEhFrame(), region);
+      emitEhFrame(pModule, *section->getEhFrame(), region, pThreads);
       break;
     case LDFileFormat::Relocation:
       // sort relocation for the benefit of the dynamic linker.
@@ -109,15 +114,105 @@ void ELFObjectWriter::writeSection(Module& pModule,
       target().emitSectionData(*section, region);
       break;
     case LDFileFormat::DebugString:
-      section->getDebugString()->emit(region);
+      section->getDebugString()->emit(region, pThreads);
       break;
     default:
       llvm_unreachable("invalid section kind");
   }
 }
 
+bool ELFObjectWriter::isInputContent(const LDSection& pSection) const {
+  switch (pSection.kind()) {
+    case LDFileFormat::TEXT:
+    case LDFileFormat::DATA:
+    case LDFileFormat::Debug:
+    case LDFileFormat::DebugString:
+    case LDFileFormat::Note:
+    case LDFileFormat::GCCExceptTable:
+    case LDFileFormat::EhFrame:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void ELFObjectWriter::writeSections(Module& pModule,
+                                    FileOutputBuffer& pOutput,
+                                    bool pInputContent) {
+  std::vector<LDSection*> sections;
+  if (m_Config.codeGenType() == LinkerConfig::Binary) {
+    // Iterate over the loadable segments and write the corresponding sections
+    ELFSegmentFactory::iterator seg, segEnd = target().elfSegmentTable().end();
+
+    for (seg = target().elfSegmentTable().begin(); seg != segEnd; ++seg) {
+      if (llvm::ELF::PT_LOAD == (*seg)->type()) {
+        ELFSegment::iterator sect, sectEnd = (*seg)->end();
+        for (sect = (*seg)->begin(); sect != sectEnd; ++sect) {
+          if (isInputContent(**sect) == pInputContent)
+            sections.push_back(*sect);
+        }
+      }
+    }
+  } else {
+    // Write out regular ELF sections
+    Module::iterator sect, sectEnd = pModule.end();
+    for (sect = pModule.begin(); sect != sectEnd; ++sect) {
+      if (isInputContent(**sect) == pInputContent)
+        sections.push_back(*sect);
+    }
+  }
+
+  // The sections built by the linker are written by the backend, which may
+  // share state between them (e.g., .plt and .got.plt), so they are written
+  // one by one.
+  unsigned threads = m_Config.options().numThreads();
+  if (!pInputContent || threads <= 1) {
+    std::vector<LDSection*>::iterator sect, sectEnd = sections.end();
+    for (sect = sections.begin(); sect != sectEnd; ++sect)
+      writeSection(pModule, pOutput, *sect);
+    return;
+  }
+
+  // The input contents only read the fragments and every section owns a
+  // disjoint range of the output. A section bigger than a fair share of the
+  // work (typically .text or .debug_info) is split by fragments instead, so
+  // it does not keep a single thread busy on its own.
+  uint64_t total_size = 0;
+  std::vector<LDSection*>::iterator sect, sectEnd = sections.end();
+  for (sect = sections.begin(); sect != sectEnd; ++sect)
+    total_size += (*sect)->size();
+
+  std::vector<LDSection*> small_sections;
+  for (sect = sections.begin(); sect != sectEnd; ++sect) {
+    if ((*sect)->size() * threads >= total_size)
+      writeSection(pModule, pOutput, *sect, threads);
+    else
+      small_sections.push_back(*sect);
+  }
+
+  parallelForEach(threads, small_sections.begin(), small_sections.end(),
+                  [&](LDSection* pSection) {
+    writeSection(pModule, pOutput, pSection);
+  });
+}
+
 std::error_code ELFObjectWriter::writeObject(Module& pModule,
                                              FileOutputBuffer& pOutput) {
+  std::error_code result = writeInputContents(pModule, pOutput);
+  if (result)
+    return result;
+  return writeLinkerContents(pModule, pOutput);
+}
+
+std::error_code ELFObjectWriter::writeInputContents(Module& pModule,
+                                                    FileOutputBuffer& pOutput) {
+  writeSections(pModule, pOutput, true);
+  return std::error_code();
+}
+
+std::error_code ELFObjectWriter::writeLinkerContents(
+    Module& pModule,
+    FileOutputBuffer& pOutput) {
   bool is_dynobj = m_Config.codeGenType() == LinkerConfig::DynObj;
   bool is_exec = m_Config.codeGenType() == LinkerConfig::Exec;
   bool is_binary = m_Config.codeGenType() == LinkerConfig::Binary;
@@ -141,23 +236,10 @@ std::error_code ELFObjectWriter::writeObject(Module& pModule,
     target().emitRegNamePools(pModule, pOutput);
   }
 
-  if (is_binary) {
-    // Iterate over the loadable segments and write the corresponding sections
-    ELFSegmentFactory::iterator seg, segEnd = target().elfSegmentTable().end();
-
-    for (seg = target().elfSegmentTable().begin(); seg != segEnd; ++seg) {
-      if (llvm::ELF::PT_LOAD == (*seg)->type()) {
-        ELFSegment::iterator sect, sectEnd = (*seg)->end();
-        for (sect = (*seg)->begin(); sect != sectEnd; ++sect)
-          writeSection(pModule, pOutput, *sect);
-      }
-    }
-  } else {
-    // Write out regular ELF sections
-    Module::iterator sect, sectEnd = pModule.end();
-    for (sect = pModule.begin(); sect != sectEnd; ++sect)
-      writeSection(pModule, pOutput, *sect);
+  // Write out the sections built by the linker
+  writeSections(pModule, pOutput, false);
 
+  if (!is_binary) {
     emitShStrTab(target().getOutputFormat()->getShStrTab(), pModule, pOutput);
 
     if (m_Config.targets().is32Bits()) {
@@ -308,11 +390,12 @@ void ELFObjectWriter::emitSectionHeader(const Module& pModule,
   ElfXX_Shdr* shdr = reinterpret_cast<ElfXX_Shdr*>(region.begin());
 
   // Iterate the SectionTable in LDContext
+  const StringTableBuilder& shstrtab = target().getShStrTabBuilder();
   unsigned int sectIdx = 0;
-  unsigned int shstridx = 0;  // NULL section has empty name
   for (; sectIdx < sectNum; ++sectIdx) {
     const LDSection* ld_sect = pModule.getSectionTable().at(sectIdx);
-    shdr[sectIdx].sh_name = shstridx;
+    // NULL section has empty name
+    shdr[sectIdx].sh_name = shstrtab.getOffset(ld_sect->name());
     shdr[sectIdx].sh_type = ld_sect->type();
     shdr[sectIdx].sh_flags = ld_sect->flag();
     shdr[sectIdx].sh_addr = ld_sect->addr();
@@ -322,9 +405,6 @@ void ELFObjectWriter::emitSectionHeader(const Module& pModule,
     shdr[sectIdx].sh_entsize = getSectEntrySize<SIZE>(*ld_sect);
     shdr[sectIdx].sh_link = getSectLink(*ld_sect, pConfig);
     shdr[sectIdx].sh_info = getSectInfo(*ld_sect);
-
-    // adjust strshidx
-    shstridx += ld_sect->name().size() + 1;
   }
 }
 
@@ -366,20 +446,13 @@ void ELFObjectWriter::emitShStrTab(const LDSection& pShStrTab,
                                    FileOutputBuffer& pOutput) {
   // write out data
   MemoryRegion region = pOutput.request(pShStrTab.offset(), pShStrTab.size());
-  char* data = reinterpret_cast<char*>(region.begin());
-  size_t shstrsize = 0;
-  Module::const_iterator section, sectEnd = pModule.end();
-  for (section = pModule.begin(); section != sectEnd; ++section) {
-    ::memcpy(reinterpret_cast<char*>(data + shstrsize),
-             (*section)->name().data(),
-             (*section)->name().size());
-    shstrsize += (*section)->name().size() + 1;
-  }
+  target().getShStrTabBuilder().emit(region);
 }
 
 /// emitSectionData
 void ELFObjectWriter::emitSectionData(const LDSection& pSection,
-                                      MemoryRegion& pRegion) const {
+                                      MemoryRegion& pRegion,
+                                      unsigned pThreads) const {
   const SectionData* sd = NULL;
   switch (pSection.kind()) {
     case LDFileFormat::Relocation:
@@ -394,14 +467,15 @@ void ELFObjectWriter::emitSectionData(const LDSection& pSection,
       sd = pSection.getSectionData();
       break;
   }
-  emitSectionData(*sd, pRegion);
+  emitSectionData(*sd, pRegion, pThreads);
 }
 
 /// emitEhFrame
 void ELFObjectWriter::emitEhFrame(Module& pModule,
                                   EhFrame& pFrame,
-                                  MemoryRegion& pRegion) const {
-  emitSectionData(*pFrame.getSectionData(), pRegion);
+                                  MemoryRegion& pRegion,
+                                  unsigned pThreads) const {
+  emitSectionData(*pFrame.getSectionData(), pRegion, pThreads);
 
   // Patch FDE field (offset to CIE)
   for (EhFrame::cie_iterator i = pFrame.cie_begin(), e = pFrame.cie_end();
@@ -579,10 +653,11 @@ uint64_t ELFObjectWriter::getSectEntrySize(const LDSection& pSection) const {
     return sizeof(ElfXX_Word);
   if (llvm::ELF::SHT_DYNAMIC == pSection.type())
     return sizeof(ElfXX_Dyn);
-  // FIXME: We should get the entsize from input since the size of each
-  // character is specified in the section header's sh_entsize field.
+  // The size of each character or constant comes from the input sections.
   // For example, traditional string is 0x1, UCS-2 is 0x2, ... and so on.
   // Ref: http://www.sco.com/developers/gabi/2003-12-17/ch4.sheader.html
+  if ((pSection.flag() & llvm::ELF::SHF_MERGE) && pSection.entSize() != 0)
+    return pSection.entSize();
   if (pSection.flag() & llvm::ELF::SHF_STRINGS)
     return 0x1;
   return 0x0;
@@ -647,70 +722,90 @@ uint64_t ELFObjectWriter::getLastStartOffset<64>(const Module& pModule) const {
 
 /// emitSectionData
 void ELFObjectWriter::emitSectionData(const SectionData& pSD,
-                                      MemoryRegion& pRegion) const {
+                                      MemoryRegion& pRegion,
+                                      unsigned pThreads) const {
   SectionData::const_iterator fragIter, fragEnd = pSD.end();
   size_t cur_offset = 0;
+  if (pThreads <= 1) {
+    for (fragIter = pSD.begin(); fragIter != fragEnd; ++fragIter) {
+      emitFragment(*fragIter, pRegion.begin() + cur_offset);
+      cur_offset += fragIter->size();
+    }
+    return;
+  }
+
+  // Fragments occupy disjoint ranges of the region. Take their offsets
+  // first and then copy them in chunks on the worker threads.
+  std::vector<std::pair<const Fragment*, size_t> > frags;
   for (fragIter = pSD.begin(); fragIter != fragEnd; ++fragIter) {
-    size_t size = fragIter->size();
-    switch (fragIter->getKind()) {
-      case Fragment::Region: {
-        const RegionFragment& region_frag =
-            llvm::cast<RegionFragment>(*fragIter);
-        const char* from = region_frag.getRegion().begin();
-        memcpy(pRegion.begin() + cur_offset, from, size);
-        break;
-      }
-      case Fragment::Alignment: {
-        // TODO: emit values with different sizes (> 1 byte), and emit nops
-        const AlignFragment& align_frag = llvm::cast<AlignFragment>(*fragIter);
-        uint64_t count = size / align_frag.getValueSize();
-        switch (align_frag.getValueSize()) {
-          case 1u:
-            std::memset(
-                pRegion.begin() + cur_offset, align_frag.getValue(), count);
-            break;
-          default:
-            llvm::report_fatal_error(
-                "unsupported value size for align fragment emission yet.\n");
-            break;
-        }
-        break;
-      }
-      case Fragment::Fillment: {
-        const FillFragment& fill_frag = llvm::cast<FillFragment>(*fragIter);
-        if (0 == size || 0 == fill_frag.getValueSize() ||
-            0 == fill_frag.size()) {
-          // ignore virtual fillment
-          break;
-        }
+    frags.push_back(std::make_pair(&*fragIter, cur_offset));
+    cur_offset += fragIter->size();
+  }
 
-        uint64_t num_tiles = fill_frag.size() / fill_frag.getValueSize();
-        for (uint64_t i = 0; i != num_tiles; ++i) {
-          std::memset(pRegion.begin() + cur_offset,
-                      fill_frag.getValue(),
-                      fill_frag.getValueSize());
-        }
-        break;
+  const size_t frags_per_chunk = 256;
+  parallelForRange(pThreads, 0, frags.size(), frags_per_chunk,
+                   [&](size_t pChunkBegin, size_t pChunkEnd) {
+    for (size_t i = pChunkBegin; i != pChunkEnd; ++i)
+      emitFragment(*frags[i].first, pRegion.begin() + frags[i].second);
+  });
+}
+
+void ELFObjectWriter::emitFragment(const Fragment& pFrag,
+                                   uint8_t* pDest) const {
+  size_t size = pFrag.size();
+  switch (pFrag.getKind()) {
+    case Fragment::Region: {
+      const RegionFragment& region_frag = llvm::cast<RegionFragment>(pFrag);
+      const char* from = region_frag.getRegion().begin();
+      memcpy(pDest, from, size);
+      break;
+    }
+    case Fragment::Alignment: {
+      // TODO: emit values with different sizes (> 1 byte), and emit nops
+      const AlignFragment& align_frag = llvm::cast<AlignFragment>(pFrag);
+      uint64_t count = size / align_frag.getValueSize();
+      switch (align_frag.getValueSize()) {
+        case 1u:
+          std::memset(pDest, align_frag.getValue(), count);
+          break;
+        default:
+          llvm::report_fatal_error(
+              "unsupported value size for align fragment emission yet.\n");
+          break;
       }
-      case Fragment::Stub: {
-        const Stub& stub_frag = llvm::cast<Stub>(*fragIter);
-        memcpy(pRegion.begin() + cur_offset, stub_frag.getContent(), size);
+      break;
+    }
+    case Fragment::Fillment: {
+      const FillFragment& fill_frag = llvm::cast<FillFragment>(pFrag);
+      if (0 == size || 0 == fill_frag.getValueSize() ||
+          0 == fill_frag.size()) {
+        // ignore virtual fillment
         break;
       }
-      case Fragment::Null: {
-        assert(0x0 == size);
-        break;
+
+      uint64_t num_tiles = fill_frag.size() / fill_frag.getValueSize();
+      for (uint64_t i = 0; i != num_tiles; ++i) {
+        std::memset(pDest, fill_frag.getValue(), fill_frag.getValueSize());
       }
-      case Fragment::Target:
-        llvm::report_fatal_error(
-            "Target fragment should not be in a regular section.\n");
-        break;
-      default:
-        llvm::report_fatal_error(
-            "invalid fragment should not be in a regular section.\n");
-        break;
+      break;
+    }
+    case Fragment::Stub: {
+      const Stub& stub_frag = llvm::cast<Stub>(pFrag);
+      memcpy(pDest, stub_frag.getContent(), size);
+      break;
     }
-    cur_offset += size;
+    case Fragment::Null: {
+      assert(0x0 == size);
+      break;
+    }
+    case Fragment::Target:
+      llvm::report_fatal_error(
+          "Target fragment should not be in a regular section.\n");
+      break;
+    default:
+      llvm::report_fatal_error(
+          "invalid fragment should not be in a regular section.\n");
+      break;
   }
 }
 
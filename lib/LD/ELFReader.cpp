@@ -12,6 +12,8 @@
 #include "mcld/Fragment/FillFragment.h"
 #include "mcld/LD/EhFrame.h"
 #include "mcld/LD/LDContext.h"
+#include "mcld/LD/NamePool.h"
+#include "mcld/LD/RelocData.h"
 #include "mcld/LD/SectionData.h"
 #include "mcld/Object/ObjectBuilder.h"
 #include "mcld/Support/MemoryArea.h"
@@ -61,140 +63,36 @@ bool ELFReader<32, true>::readRegularSection(Input& pInput,
   return true;
 }
 
-/// readSymbols - read ELF symbols and create LDSymbol
-bool ELFReader<32, true>::readSymbols(Input& pInput,
-                                      IRBuilder& pBuilder,
-                                      llvm::StringRef pRegion,
-                                      const char* pStrTab) const {
+/// decodeSymbols - decode ELF symbol table
+void ELFReader<32, true>::decodeSymbols(llvm::StringRef pRegion,
+                                        const char* pStrTab,
+                                        SymbolList& pSymbols) const {
   // get number of symbols
   size_t entsize = pRegion.size() / sizeof(llvm::ELF::Elf32_Sym);
   const llvm::ELF::Elf32_Sym* symtab =
       reinterpret_cast<const llvm::ELF::Elf32_Sym*>(pRegion.begin());
 
-  uint32_t st_name = 0x0;
-  uint32_t st_value = 0x0;
-  uint32_t st_size = 0x0;
-  uint8_t st_info = 0x0;
-  uint8_t st_other = 0x0;
-  uint16_t st_shndx = 0x0;
-
-  // skip the first NULL symbol
-  pInput.context()->addSymbol(LDSymbol::Null());
-
-  /// recording symbols added from DynObj to analyze weak alias
-  std::vector<AliasInfo> potential_aliases;
-  bool is_dyn_obj = (pInput.type() == Input::DynObj);
-  for (size_t idx = 1; idx < entsize; ++idx) {
-    st_info = symtab[idx].st_info;
-    st_other = symtab[idx].st_other;
+  pSymbols.resize(entsize);
+  for (size_t idx = 0; idx < entsize; ++idx) {
+    SymbolEntry& entry = pSymbols[idx];
+    uint32_t st_name = 0x0;
+    entry.info = symtab[idx].st_info;
+    entry.other = symtab[idx].st_other;
 
     if (llvm::sys::IsLittleEndianHost) {
       st_name = symtab[idx].st_name;
-      st_value = symtab[idx].st_value;
-      st_size = symtab[idx].st_size;
-      st_shndx = symtab[idx].st_shndx;
+      entry.value = symtab[idx].st_value;
+      entry.size = symtab[idx].st_size;
+      entry.shndx = symtab[idx].st_shndx;
     } else {
       st_name = mcld::bswap32(symtab[idx].st_name);
-      st_value = mcld::bswap32(symtab[idx].st_value);
-      st_size = mcld::bswap32(symtab[idx].st_size);
-      st_shndx = mcld::bswap16(symtab[idx].st_shndx);
-    }
-
-    // If the section should not be included, set the st_shndx SHN_UNDEF
-    // - A section in interrelated groups are not included.
-    if (pInput.type() == Input::Object && st_shndx < llvm::ELF::SHN_LORESERVE &&
-        st_shndx != llvm::ELF::SHN_UNDEF) {
-      if (pInput.context()->getSection(st_shndx) == NULL)
-        st_shndx = llvm::ELF::SHN_UNDEF;
-    }
-
-    // get ld_type
-    ResolveInfo::Type ld_type = getSymType(st_info, st_shndx);
-
-    // get ld_desc
-    ResolveInfo::Desc ld_desc = getSymDesc(st_shndx, pInput);
-
-    // get ld_binding
-    ResolveInfo::Binding ld_binding =
-        getSymBinding((st_info >> 4), st_shndx, st_other);
-
-    // get ld_value - ld_value must be section relative.
-    uint64_t ld_value = getSymValue(st_value, st_shndx, pInput);
-
-    // get ld_vis
-    ResolveInfo::Visibility ld_vis = getSymVisibility(st_other);
-
-    // get section
-    LDSection* section = NULL;
-    if (st_shndx < llvm::ELF::SHN_LORESERVE)  // including ABS and COMMON
-      section = pInput.context()->getSection(st_shndx);
-
-    // get ld_name
-    std::string ld_name;
-    if (ResolveInfo::Section == ld_type) {
-      // Section symbol's st_name is the section index.
-      assert(section != NULL && "get a invalid section");
-      ld_name = section->name();
-    } else {
-      ld_name = std::string(pStrTab + st_name);
-    }
-
-    LDSymbol* psym = pBuilder.AddSymbol(pInput,
-                                        ld_name,
-                                        ld_type,
-                                        ld_desc,
-                                        ld_binding,
-                                        st_size,
-                                        ld_value,
-                                        section,
-                                        ld_vis);
-
-    if (is_dyn_obj && psym != NULL && ResolveInfo::Undefined != ld_desc &&
-        (ResolveInfo::Global == ld_binding ||
-         ResolveInfo::Weak == ld_binding) &&
-        ResolveInfo::Object == ld_type) {
-      AliasInfo p;
-      p.pt_alias = psym;
-      p.ld_binding = ld_binding;
-      p.ld_value = ld_value;
-      potential_aliases.push_back(p);
+      entry.value = mcld::bswap32(symtab[idx].st_value);
+      entry.size = mcld::bswap32(symtab[idx].st_size);
+      entry.shndx = mcld::bswap16(symtab[idx].st_shndx);
     }
+    entry.name = llvm::StringRef(pStrTab + st_name);
+    entry.hash = NamePool::Hash(entry.name);
   }  // end of for loop
-
-  // analyze weak alias
-  // FIXME: it is better to let IRBuilder handle alias anlysis.
-  //        1. eliminate code duplication
-  //        2. easy to know if a symbol is from .so
-  //           (so that it may be a potential alias)
-  if (is_dyn_obj) {
-    // sort symbols by symbol value and then weak before strong
-    std::sort(potential_aliases.begin(), potential_aliases.end(), less);
-
-    // for each weak symbol, find out all its aliases, and
-    // then link them as a circular list in Module
-    std::vector<AliasInfo>::iterator sym_it, sym_e;
-    sym_e = potential_aliases.end();
-    for (sym_it = potential_aliases.begin(); sym_it != sym_e; ++sym_it) {
-      if (ResolveInfo::Weak != sym_it->ld_binding)
-        continue;
-
-      Module& pModule = pBuilder.getModule();
-      std::vector<AliasInfo>::iterator alias_it = sym_it + 1;
-      while (alias_it != sym_e) {
-        if (sym_it->ld_value != alias_it->ld_value)
-          break;
-
-        if (sym_it + 1 == alias_it)
-          pModule.CreateAliasList(*sym_it->pt_alias->resolveInfo());
-        pModule.addAlias(*alias_it->pt_alias->resolveInfo());
-        ++alias_it;
-      }
-
-      sym_it = alias_it - 1;
-    }  // end of for loop
-  }
-
-  return true;
 }
 
 //===----------------------------------------------------------------------===//
@@ -209,6 +107,10 @@ bool ELFReader<32, true>::readRela(Input& pInput,
   const llvm::ELF::Elf32_Rela* relaTab =
       reinterpret_cast<const llvm::ELF::Elf32_Rela*>(pRegion.begin());
 
+  // the relocations are kept packed until a pass needs Relocation
+  RelocData* reloc_data = pSection.getRelocData();
+  reloc_data->reserve(entsize);
+
   for (size_t idx = 0; idx < entsize; ++idx) {
     Relocation::Type r_type = 0x0;
     uint32_t r_sym = 0x0;
@@ -224,7 +126,7 @@ bool ELFReader<32, true>::readRela(Input& pInput,
       fatal(diag::err_cannot_read_symbol) << r_sym << pInput.path();
     }
 
-    IRBuilder::AddRelocation(pSection, r_type, *symbol, r_offset, r_addend);
+    reloc_data->addPacked(r_type, symbol->resolveInfo(), r_offset, r_addend);
   }  // end of for
   return true;
 }
@@ -238,6 +140,10 @@ bool ELFReader<32, true>::readRel(Input& pInput,
   const llvm::ELF::Elf32_Rel* relTab =
       reinterpret_cast<const llvm::ELF::Elf32_Rel*>(pRegion.begin());
 
+  // the relocations are kept packed until a pass needs Relocation
+  RelocData* reloc_data = pSection.getRelocData();
+  reloc_data->reserve(entsize);
+
   for (size_t idx = 0; idx < entsize; ++idx) {
     Relocation::Type r_type = 0x0;
     uint32_t r_sym = 0x0;
@@ -251,7 +157,7 @@ bool ELFReader<32, true>::readRel(Input& pInput,
       fatal(diag::err_cannot_read_symbol) << r_sym << pInput.path();
     }
 
-    IRBuilder::AddRelocation(pSection, r_type, *symbol, r_offset);
+    reloc_data->addPacked(r_type, symbol->resolveInfo(), r_offset, 0);
   }  // end of for
   return true;
 }
@@ -299,9 +205,11 @@ Input::Type ELFReader<32, true>::fileType(const void* pELFHeader) const {
   }
 }
 
-/// readSectionHeaders - read ELF section header table and create LDSections
-bool ELFReader<32, true>::readSectionHeaders(Input& pInput,
-                                             const void* pELFHeader) const {
+/// decodeSectionHeaders - decode ELF section header table
+bool ELFReader<32, true>::decodeSectionHeaders(
+    Input& pInput,
+    const void* pELFHeader,
+    SectionHeaderList& pHeaders) const {
   const llvm::ELF::Elf32_Ehdr* ehdr =
       reinterpret_cast<const llvm::ELF::Elf32_Ehdr*>(pELFHeader);
 
@@ -336,6 +244,7 @@ bool ELFReader<32, true>::readSectionHeaders(Input& pInput,
   uint32_t sh_link = 0x0;
   uint32_t sh_info = 0x0;
   uint32_t sh_addralign = 0x0;
+  uint32_t sh_entsize = 0x0;
 
   // if shnum and shstrtab overflow, the actual values are in the 1st shdr
   if (shnum == llvm::ELF::SHN_UNDEF || shstrtab == llvm::ELF::SHN_XINDEX) {
@@ -378,9 +287,8 @@ bool ELFReader<32, true>::readSectionHeaders(Input& pInput,
       pInput.memArea()->request(pInput.fileOffset() + sh_offset, sh_size);
   const char* sect_name = sect_name_region.begin();
 
-  LinkInfoList link_info_list;
-
-  // create all LDSections, including first NULL section.
+  // decode all section headers, including first NULL section.
+  pHeaders.resize(shnum);
   for (size_t idx = 0; idx < shnum; ++idx) {
     if (llvm::sys::IsLittleEndianHost) {
       sh_name = shdrTab[idx].sh_name;
@@ -391,6 +299,7 @@ bool ELFReader<32, true>::readSectionHeaders(Input& pInput,
       sh_link = shdrTab[idx].sh_link;
       sh_info = shdrTab[idx].sh_info;
       sh_addralign = shdrTab[idx].sh_addralign;
+      sh_entsize = shdrTab[idx].sh_entsize;
     } else {
       sh_name = mcld::bswap32(shdrTab[idx].sh_name);
       sh_type = mcld::bswap32(shdrTab[idx].sh_type);
@@ -400,29 +309,21 @@ bool ELFReader<32, true>::readSectionHeaders(Input& pInput,
       sh_link = mcld::bswap32(shdrTab[idx].sh_link);
       sh_info = mcld::bswap32(shdrTab[idx].sh_info);
       sh_addralign = mcld::bswap32(shdrTab[idx].sh_addralign);
+      sh_entsize = mcld::bswap32(shdrTab[idx].sh_entsize);
     }
 
-    LDSection* section = IRBuilder::CreateELFHeader(
-        pInput, sect_name + sh_name, sh_type, sh_flags, sh_addralign);
-    section->setSize(sh_size);
-    section->setOffset(sh_offset);
-    section->setInfo(sh_info);
-
-    if (sh_link != 0x0 || sh_info != 0x0) {
-      LinkInfo link_info = {section, sh_link, sh_info};
-      link_info_list.push_back(link_info);
-    }
+    SectionHeaderEntry& entry = pHeaders[idx];
+    entry.name = sect_name + sh_name;
+    entry.type = sh_type;
+    entry.flags = sh_flags;
+    entry.offset = sh_offset;
+    entry.size = sh_size;
+    entry.link = sh_link;
+    entry.info = sh_info;
+    entry.addralign = sh_addralign;
+    entry.entsize = sh_entsize;
   }  // end of for
 
-  // set up InfoLink
-  LinkInfoList::iterator info, infoEnd = link_info_list.end();
-  for (info = link_info_list.begin(); info != infoEnd; ++info) {
-    if (LDFileFormat::Relocation == info->section->kind())
-      info->section->setLink(pInput.context()->getSection(info->sh_info));
-    else
-      info->section->setLink(pInput.context()->getSection(info->sh_link));
-  }
-
   return true;
 }
 
@@ -561,135 +462,36 @@ bool ELFReader<64, true>::readRegularSection(Input& pInput,
   return true;
 }
 
-/// readSymbols - read ELF symbols and create LDSymbol
-bool ELFReader<64, true>::readSymbols(Input& pInput,
-                                      IRBuilder& pBuilder,
-                                      llvm::StringRef pRegion,
-                                      const char* pStrTab) const {
+/// decodeSymbols - decode ELF symbol table
+void ELFReader<64, true>::decodeSymbols(llvm::StringRef pRegion,
+                                        const char* pStrTab,
+                                        SymbolList& pSymbols) const {
   // get number of symbols
   size_t entsize = pRegion.size() / sizeof(llvm::ELF::Elf64_Sym);
   const llvm::ELF::Elf64_Sym* symtab =
       reinterpret_cast<const llvm::ELF::Elf64_Sym*>(pRegion.begin());
 
-  uint32_t st_name = 0x0;
-  uint64_t st_value = 0x0;
-  uint64_t st_size = 0x0;
-  uint8_t st_info = 0x0;
-  uint8_t st_other = 0x0;
-  uint16_t st_shndx = 0x0;
-
-  // skip the first NULL symbol
-  pInput.context()->addSymbol(LDSymbol::Null());
-
-  /// recording symbols added from DynObj to analyze weak alias
-  std::vector<AliasInfo> potential_aliases;
-  bool is_dyn_obj = (pInput.type() == Input::DynObj);
-  for (size_t idx = 1; idx < entsize; ++idx) {
-    st_info = symtab[idx].st_info;
-    st_other = symtab[idx].st_other;
+  pSymbols.resize(entsize);
+  for (size_t idx = 0; idx < entsize; ++idx) {
+    SymbolEntry& entry = pSymbols[idx];
+    uint32_t st_name = 0x0;
+    entry.info = symtab[idx].st_info;
+    entry.other = symtab[idx].st_other;
 
     if (llvm::sys::IsLittleEndianHost) {
       st_name = symtab[idx].st_name;
-      st_value = symtab[idx].st_value;
-      st_size = symtab[idx].st_size;
-      st_shndx = symtab[idx].st_shndx;
+      entry.value = symtab[idx].st_value;
+      entry.size = symtab[idx].st_size;
+      entry.shndx = symtab[idx].st_shndx;
     } else {
       st_name = mcld::bswap32(symtab[idx].st_name);
-      st_value = mcld::bswap64(symtab[idx].st_value);
-      st_size = mcld::bswap64(symtab[idx].st_size);
-      st_shndx = mcld::bswap16(symtab[idx].st_shndx);
-    }
-
-    // If the section should not be included, set the st_shndx SHN_UNDEF
-    // - A section in interrelated groups are not included.
-    if (pInput.type() == Input::Object && st_shndx < llvm::ELF::SHN_LORESERVE &&
-        st_shndx != llvm::ELF::SHN_UNDEF) {
-      if (pInput.context()->getSection(st_shndx) == NULL)
-        st_shndx = llvm::ELF::SHN_UNDEF;
-    }
-
-    // get ld_type
-    ResolveInfo::Type ld_type = getSymType(st_info, st_shndx);
-
-    // get ld_desc
-    ResolveInfo::Desc ld_desc = getSymDesc(st_shndx, pInput);
-
-    // get ld_binding
-    ResolveInfo::Binding ld_binding =
-        getSymBinding((st_info >> 4), st_shndx, st_other);
-
-    // get ld_value - ld_value must be section relative.
-    uint64_t ld_value = getSymValue(st_value, st_shndx, pInput);
-
-    // get ld_vis
-    ResolveInfo::Visibility ld_vis = getSymVisibility(st_other);
-
-    // get section
-    LDSection* section = NULL;
-    if (st_shndx < llvm::ELF::SHN_LORESERVE)  // including ABS and COMMON
-      section = pInput.context()->getSection(st_shndx);
-
-    // get ld_name
-    std::string ld_name;
-    if (ResolveInfo::Section == ld_type) {
-      // Section symbol's st_name is the section index.
-      assert(section != NULL && "get a invalid section");
-      ld_name = section->name();
-    } else {
-      ld_name = std::string(pStrTab + st_name);
-    }
-
-    LDSymbol* psym = pBuilder.AddSymbol(pInput,
-                                        ld_name,
-                                        ld_type,
-                                        ld_desc,
-                                        ld_binding,
-                                        st_size,
-                                        ld_value,
-                                        section,
-                                        ld_vis);
-
-    if (is_dyn_obj && psym != NULL && ResolveInfo::Undefined != ld_desc &&
-        (ResolveInfo::Global == ld_binding ||
-         ResolveInfo::Weak == ld_binding) &&
-        ResolveInfo::Object == ld_type) {
-      AliasInfo p;
-      p.pt_alias = psym;
-      p.ld_binding = ld_binding;
-      p.ld_value = ld_value;
-      potential_aliases.push_back(p);
+      entry.value = mcld::bswap64(symtab[idx].st_value);
+      entry.size = mcld::bswap64(symtab[idx].st_size);
+      entry.shndx = mcld::bswap16(symtab[idx].st_shndx);
     }
+    entry.name = llvm::StringRef(pStrTab + st_name);
+    entry.hash = NamePool::Hash(entry.name);
   }  // end of for loop
-
-  // analyze weak alias here
-  if (is_dyn_obj) {
-    // sort symbols by symbol value and then weak before strong
-    std::sort(potential_aliases.begin(), potential_aliases.end(), less);
-
-    // for each weak symbol, find out all its aliases, and
-    // then link them as a circular list in Module
-    std::vector<AliasInfo>::iterator sym_it, sym_e;
-    sym_e = potential_aliases.end();
-    for (sym_it = potential_aliases.begin(); sym_it != sym_e; ++sym_it) {
-      if (ResolveInfo::Weak != sym_it->ld_binding)
-        continue;
-
-      Module& pModule = pBuilder.getModule();
-      std::vector<AliasInfo>::iterator alias_it = sym_it + 1;
-      while (alias_it != sym_e) {
-        if (sym_it->ld_value != alias_it->ld_value)
-          break;
-
-        if (sym_it + 1 == alias_it)
-          pModule.CreateAliasList(*sym_it->pt_alias->resolveInfo());
-        pModule.addAlias(*alias_it->pt_alias->resolveInfo());
-        ++alias_it;
-      }
-
-      sym_it = alias_it - 1;
-    }  // end of for loop
-  }
-  return true;
 }
 
 //===----------------------------------------------------------------------===//
@@ -704,6 +506,10 @@ bool ELFReader<64, true>::readRela(Input& pInput,
   const llvm::ELF::Elf64_Rela* relaTab =
       reinterpret_cast<const llvm::ELF::Elf64_Rela*>(pRegion.begin());
 
+  // the relocations are kept packed until a pass needs Relocation
+  RelocData* reloc_data = pSection.getRelocData();
+  reloc_data->reserve(entsize);
+
   for (size_t idx = 0; idx < entsize; ++idx) {
     Relocation::Type r_type = 0x0;
     uint32_t r_sym = 0x0;
@@ -719,7 +525,7 @@ bool ELFReader<64, true>::readRela(Input& pInput,
       fatal(diag::err_cannot_read_symbol) << r_sym << pInput.path();
     }
 
-    IRBuilder::AddRelocation(pSection, r_type, *symbol, r_offset, r_addend);
+    reloc_data->addPacked(r_type, symbol->resolveInfo(), r_offset, r_addend);
   }  // end of for
   return true;
 }
@@ -733,6 +539,10 @@ bool ELFReader<64, true>::readRel(Input& pInput,
   const llvm::ELF::Elf64_Rel* relTab =
       reinterpret_cast<const llvm::ELF::Elf64_Rel*>(pRegion.begin());
 
+  // the relocations are kept packed until a pass needs Relocation
+  RelocData* reloc_data = pSection.getRelocData();
+  reloc_data->reserve(entsize);
+
   for (size_t idx = 0; idx < entsize; ++idx) {
     Relocation::Type r_type = 0x0;
     uint32_t r_sym = 0x0;
@@ -745,7 +555,7 @@ bool ELFReader<64, true>::readRel(Input& pInput,
       fatal(diag::err_cannot_read_symbol) << r_sym << pInput.path();
     }
 
-    IRBuilder::AddRelocation(pSection, r_type, *symbol, r_offset);
+    reloc_data->addPacked(r_type, symbol->resolveInfo(), r_offset, 0);
   }  // end of for
   return true;
 }
@@ -793,9 +603,11 @@ Input::Type ELFReader<64, true>::fileType(const void* pELFHeader) const {
   }
 }
 
-/// readSectionHeaders - read ELF section header table and create LDSections
-bool ELFReader<64, true>::readSectionHeaders(Input& pInput,
-                                             const void* pELFHeader) const {
+/// decodeSectionHeaders - decode ELF section header table
+bool ELFReader<64, true>::decodeSectionHeaders(
+    Input& pInput,
+    const void* pELFHeader,
+    SectionHeaderList& pHeaders) const {
   const llvm::ELF::Elf64_Ehdr* ehdr =
       reinterpret_cast<const llvm::ELF::Elf64_Ehdr*>(pELFHeader);
 
@@ -830,6 +642,7 @@ bool ELFReader<64, true>::readSectionHeaders(Input& pInput,
   uint32_t sh_link = 0x0;
   uint32_t sh_info = 0x0;
   uint64_t sh_addralign = 0x0;
+  uint64_t sh_entsize = 0x0;
 
   // if shnum and shstrtab overflow, the actual values are in the 1st shdr
   if (shnum == llvm::ELF::SHN_UNDEF || shstrtab == llvm::ELF::SHN_XINDEX) {
@@ -872,9 +685,8 @@ bool ELFReader<64, true>::readSectionHeaders(Input& pInput,
       pInput.memArea()->request(pInput.fileOffset() + sh_offset, sh_size);
   const char* sect_name = sect_name_region.begin();
 
-  LinkInfoList link_info_list;
-
-  // create all LDSections, including first NULL section.
+  // decode all section headers, including first NULL section.
+  pHeaders.resize(shnum);
   for (size_t idx = 0; idx < shnum; ++idx) {
     if (llvm::sys::IsLittleEndianHost) {
       sh_name = shdrTab[idx].sh_name;
@@ -885,6 +697,7 @@ bool ELFReader<64, true>::readSectionHeaders(Input& pInput,
       sh_link = shdrTab[idx].sh_link;
       sh_info = shdrTab[idx].sh_info;
       sh_addralign = shdrTab[idx].sh_addralign;
+      sh_entsize = shdrTab[idx].sh_entsize;
     } else {
       sh_name = mcld::bswap32(shdrTab[idx].sh_name);
       sh_type = mcld::bswap32(shdrTab[idx].sh_type);
@@ -894,29 +707,21 @@ bool ELFReader<64, true>::readSectionHeaders(Input& pInput,
       sh_link = mcld::bswap32(shdrTab[idx].sh_link);
       sh_info = mcld::bswap32(shdrTab[idx].sh_info);
       sh_addralign = mcld::bswap64(shdrTab[idx].sh_addralign);
+      sh_entsize = mcld::bswap64(shdrTab[idx].sh_entsize);
     }
 
-    LDSection* section = IRBuilder::CreateELFHeader(
-        pInput, sect_name + sh_name, sh_type, sh_flags, sh_addralign);
-    section->setSize(sh_size);
-    section->setOffset(sh_offset);
-    section->setInfo(sh_info);
-
-    if (sh_link != 0x0 || sh_info != 0x0) {
-      LinkInfo link_info = {section, sh_link, sh_info};
-      link_info_list.push_back(link_info);
-    }
+    SectionHeaderEntry& entry = pHeaders[idx];
+    entry.name = sect_name + sh_name;
+    entry.type = sh_type;
+    entry.flags = sh_flags;
+    entry.offset = sh_offset;
+    entry.size = sh_size;
+    entry.link = sh_link;
+    entry.info = sh_info;
+    entry.addralign = sh_addralign;
+    entry.entsize = sh_entsize;
   }  // end of for
 
-  // set up InfoLink
-  LinkInfoList::iterator info, infoEnd = link_info_list.end();
-  for (info = link_info_list.begin(); info != infoEnd; ++info) {
-    if (LDFileFormat::Relocation == info->section->kind())
-      info->section->setLink(pInput.context()->getSection(info->sh_info));
-    else
-      info->section->setLink(pInput.context()->getSection(info->sh_link));
-  }
-
   return true;
 }
 
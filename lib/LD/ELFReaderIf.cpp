@@ -9,6 +9,7 @@
 #include "mcld/LD/ELFReaderIf.h"
 
 #include "mcld/IRBuilder.h"
+#include "mcld/Module.h"
 #include "mcld/Fragment/FillFragment.h"
 #include "mcld/LD/EhFrame.h"
 #include "mcld/LD/LDContext.h"
@@ -20,6 +21,7 @@
 #include <llvm/Support/ELF.h>
 #include <llvm/Support/Host.h>
 
+#include <algorithm>
 #include <cstring>
 
 namespace mcld {
@@ -27,6 +29,172 @@ namespace mcld {
 //===----------------------------------------------------------------------===//
 // ELFReaderIF
 //===----------------------------------------------------------------------===//
+/// readSectionHeaders - read ELF section header table and create LDSections
+bool ELFReaderIF::readSectionHeaders(Input& pInput,
+                                     const void* pELFHeader) const {
+  SectionHeaderList headers;
+  if (!decodeSectionHeaders(pInput, pELFHeader, headers))
+    return false;
+  return createSections(pInput, headers);
+}
+
+/// createSections - create LDSections from the decoded section headers
+bool ELFReaderIF::createSections(Input& pInput,
+                                 const SectionHeaderList& pHeaders) const {
+  LinkInfoList link_info_list;
+
+  // create all LDSections, including first NULL section.
+  SectionHeaderList::const_iterator shdr, shdrEnd = pHeaders.end();
+  for (shdr = pHeaders.begin(); shdr != shdrEnd; ++shdr) {
+    LDSection* section = IRBuilder::CreateELFHeader(
+        pInput, shdr->name, shdr->type, shdr->flags, shdr->addralign);
+    section->setSize(shdr->size);
+    section->setOffset(shdr->offset);
+    section->setInfo(shdr->info);
+    section->setEntSize(shdr->entsize);
+
+    if (shdr->link != 0x0 || shdr->info != 0x0) {
+      LinkInfo link_info = {section, shdr->link, shdr->info};
+      link_info_list.push_back(link_info);
+    }
+  }  // end of for
+
+  // set up InfoLink
+  LinkInfoList::iterator info, infoEnd = link_info_list.end();
+  for (info = link_info_list.begin(); info != infoEnd; ++info) {
+    if (LDFileFormat::Relocation == info->section->kind())
+      info->section->setLink(pInput.context()->getSection(info->sh_info));
+    else
+      info->section->setLink(pInput.context()->getSection(info->sh_link));
+  }
+
+  return true;
+}
+
+/// readSymbols - read ELF symbols and create LDSymbol
+bool ELFReaderIF::readSymbols(Input& pInput,
+                              IRBuilder& pBuilder,
+                              llvm::StringRef pRegion,
+                              const char* pStrTab) const {
+  SymbolList symbols;
+  decodeSymbols(pRegion, pStrTab, symbols);
+  return addSymbols(pInput, pBuilder, symbols);
+}
+
+/// addSymbols - create LDSymbols from the decoded symbols and resolve them
+bool ELFReaderIF::addSymbols(Input& pInput,
+                             IRBuilder& pBuilder,
+                             const SymbolList& pSymbols) const {
+  // skip the first NULL symbol
+  pInput.context()->addSymbol(LDSymbol::Null());
+
+  /// recording symbols added from DynObj to analyze weak alias
+  std::vector<AliasInfo> potential_aliases;
+  bool is_dyn_obj = (pInput.type() == Input::DynObj);
+  for (size_t idx = 1; idx < pSymbols.size(); ++idx) {
+    const SymbolEntry& entry = pSymbols[idx];
+    uint8_t st_info = entry.info;
+    uint8_t st_other = entry.other;
+    uint16_t st_shndx = entry.shndx;
+
+    // If the section should not be included, set the st_shndx SHN_UNDEF
+    // - A section in interrelated groups are not included.
+    if (pInput.type() == Input::Object && st_shndx < llvm::ELF::SHN_LORESERVE &&
+        st_shndx != llvm::ELF::SHN_UNDEF) {
+      if (pInput.context()->getSection(st_shndx) == NULL)
+        st_shndx = llvm::ELF::SHN_UNDEF;
+    }
+
+    // get ld_type
+    ResolveInfo::Type ld_type = getSymType(st_info, st_shndx);
+
+    // get ld_desc
+    ResolveInfo::Desc ld_desc = getSymDesc(st_shndx, pInput);
+
+    // get ld_binding
+    ResolveInfo::Binding ld_binding =
+        getSymBinding((st_info >> 4), st_shndx, st_other);
+
+    // get ld_value - ld_value must be section relative.
+    uint64_t ld_value = getSymValue(entry.value, st_shndx, pInput);
+
+    // get ld_vis
+    ResolveInfo::Visibility ld_vis = getSymVisibility(st_other);
+
+    // get section
+    LDSection* section = NULL;
+    if (st_shndx < llvm::ELF::SHN_LORESERVE)  // including ABS and COMMON
+      section = pInput.context()->getSection(st_shndx);
+
+    // get ld_name. It points into the input and is not copied here.
+    llvm::StringRef ld_name = entry.name;
+    uint32_t ld_hash = entry.hash;
+    if (ResolveInfo::Section == ld_type) {
+      // Section symbol's st_name is the section index.
+      assert(section != NULL && "get a invalid section");
+      ld_name = section->name();
+      ld_hash = NamePool::Hash(ld_name);
+    }
+
+    LDSymbol* psym = pBuilder.AddSymbol(pInput,
+                                        ld_name,
+                                        ld_hash,
+                                        ld_type,
+                                        ld_desc,
+                                        ld_binding,
+                                        entry.size,
+                                        ld_value,
+                                        section,
+                                        ld_vis);
+
+    if (is_dyn_obj && psym != NULL && ResolveInfo::Undefined != ld_desc &&
+        (ResolveInfo::Global == ld_binding ||
+         ResolveInfo::Weak == ld_binding) &&
+        ResolveInfo::Object == ld_type) {
+      AliasInfo p;
+      p.pt_alias = psym;
+      p.ld_binding = ld_binding;
+      p.ld_value = ld_value;
+      potential_aliases.push_back(p);
+    }
+  }  // end of for loop
+
+  // analyze weak alias
+  // FIXME: it is better to let IRBuilder handle alias anlysis.
+  //        1. eliminate code duplication
+  //        2. easy to know if a symbol is from .so
+  //           (so that it may be a potential alias)
+  if (is_dyn_obj) {
+    // sort symbols by symbol value and then weak before strong
+    std::sort(potential_aliases.begin(), potential_aliases.end(), less);
+
+    // for each weak symbol, find out all its aliases, and
+    // then link them as a circular list in Module
+    std::vector<AliasInfo>::iterator sym_it, sym_e;
+    sym_e = potential_aliases.end();
+    for (sym_it = potential_aliases.begin(); sym_it != sym_e; ++sym_it) {
+      if (ResolveInfo::Weak != sym_it->ld_binding)
+        continue;
+
+      Module& pModule = pBuilder.getModule();
+      std::vector<AliasInfo>::iterator alias_it = sym_it + 1;
+      while (alias_it != sym_e) {
+        if (sym_it->ld_value != alias_it->ld_value)
+          break;
+
+        if (sym_it + 1 == alias_it)
+          pModule.CreateAliasList(*sym_it->pt_alias->resolveInfo());
+        pModule.addAlias(*alias_it->pt_alias->resolveInfo());
+        ++alias_it;
+      }
+
+      sym_it = alias_it - 1;
+    }  // end of for loop
+  }
+
+  return true;
+}
+
 /// getSymType
 ResolveInfo::Type ELFReaderIF::getSymType(uint8_t pInfo,
                                           uint16_t pShndx) const {
@@ -11,15 +11,14 @@
 #include "mcld/Config/Config.h"
 #include "mcld/LD/LDSection.h"
 #include "mcld/Support/GCFactory.h"
-
-#include <llvm/Support/ManagedStatic.h>
+#include "mcld/Support/LinkerContext.h"
 
 #include <cassert>
 
 namespace mcld {
 
 typedef GCFactory<ELFSegment, MCLD_SEGMENTS_PER_OUTPUT> ELFSegmentFactory;
-static llvm::ManagedStatic<ELFSegmentFactory> g_ELFSegmentFactory;
+static ContextStatic<ELFSegmentFactory> g_ELFSegmentFactory;
 
 //===----------------------------------------------------------------------===//
 // ELFSegment
@@ -18,14 +18,13 @@
 #include "mcld/MC/Input.h"
 #include "mcld/Object/ObjectBuilder.h"
 #include "mcld/Support/GCFactory.h"
-
-#include <llvm/Support/ManagedStatic.h>
+#include "mcld/Support/LinkerContext.h"
 
 namespace mcld {
 
 typedef GCFactory<EhFrame, MCLD_SECTIONS_PER_INPUT> EhFrameFactory;
 
-static llvm::ManagedStatic<EhFrameFactory> g_EhFrameFactory;
+static ContextStatic<EhFrameFactory> g_EhFrameFactory;
 
 //===----------------------------------------------------------------------===//
 // EhFrame::Record
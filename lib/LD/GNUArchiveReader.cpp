@@ -15,6 +15,7 @@
 #include "mcld/MC/Attribute.h"
 #include "mcld/MC/Input.h"
 #include "mcld/LD/ELFObjectReader.h"
+#include "mcld/LD/InputCache.h"
 #include "mcld/LD/ResolveInfo.h"
 #include "mcld/Support/FileHandle.h"
 #include "mcld/Support/FileSystem.h"
@@ -105,34 +106,35 @@ bool GNUArchiveReader::readArchive(const LinkerConfig& pConfig,
                               &InputTree::Downward);
   }
 
-  // include the needed members in the archive and build up the input tree
-  bool willSymResolved;
-  do {
-    willSymResolved = false;
-    for (size_t idx = 0; idx < pArchive.numOfSymbols(); ++idx) {
-      // bypass if we already decided to include this symbol or not
-      if (Archive::Symbol::Unknown != pArchive.getSymbolStatus(idx))
-        continue;
-
-      // bypass if another symbol with the same object file offset is included
-      if (pArchive.hasObjectMember(pArchive.getObjFileOffset(idx))) {
-        pArchive.setSymbolStatus(idx, Archive::Symbol::Include);
-        continue;
-      }
+  // include the needed members in the archive and build up the input tree.
+  // Only the symbols which became undefined since the last time this archive
+  // was read are looked up in the armap. Including a member may add more
+  // undefined symbols to the end of the list, and they are looked up in turn.
+  const NamePool::UndefList& undefs = m_Module.getNamePool().getUndefList();
+  for (size_t cursor = pArchive.getUndefCursor(); cursor < undefs.size();
+       pArchive.setUndefCursor(++cursor)) {
+    // bypass if the symbol has been defined or referred weakly since then
+    const ResolveInfo* info = undefs[cursor];
+    if (!info->isUndef() || info->isWeak())
+      continue;
 
-      // check if we should include this defined symbol
-      Archive::Symbol::Status status =
-          shouldIncludeSymbol(pArchive.getSymbolName(idx));
-      if (Archive::Symbol::Unknown != status)
-        pArchive.setSymbolStatus(idx, status);
+    size_t idx = 0;
+    if (!pArchive.findSymbol(llvm::StringRef(info->name(), info->nameSize()),
+                             idx))
+      continue;
 
-      if (Archive::Symbol::Include == status) {
-        // include the object member from the given offset
-        includeMember(pConfig, pArchive, pArchive.getObjFileOffset(idx));
-        willSymResolved = true;
-      }  // end of if
-    }    // end of for
-  } while (willSymResolved);
+    // bypass if we already decided to include this symbol
+    if (Archive::Symbol::Include == pArchive.getSymbolStatus(idx))
+      continue;
+    pArchive.setSymbolStatus(idx, Archive::Symbol::Include);
+
+    // bypass if another symbol with the same object file offset is included
+    if (pArchive.hasObjectMember(pArchive.getObjFileOffset(idx)))
+      continue;
+
+    // include the object member from the given offset
+    includeMember(pConfig, pArchive, pArchive.getObjFileOffset(idx));
+  }
 
   return true;
 }
@@ -261,6 +263,21 @@ bool GNUArchiveReader::readSymbolTable(Archive& pArchive) {
   assert(pArchive.getARFile().hasMemArea());
   MemoryArea* memory_area = pArchive.getARFile().memArea();
 
+  // reuse the armap read by a previous link of a linker server
+  InputCache::Entry* entry = NULL;
+  if (InputCache::Get() != NULL &&
+      !pArchive.getARFile().attribute()->isWholeArchive())
+    entry = InputCache::Get()->lookup(pArchive.getARFile());
+
+  if (entry != NULL && entry->hasArchiveSymbols) {
+    pArchive.setSymTabSize(entry->archiveSymTabSize);
+    InputCache::ArchiveSymbolList::const_iterator sym,
+        symEnd = entry->archiveSymbols.end();
+    for (sym = entry->archiveSymbols.begin(); sym != symEnd; ++sym)
+      pArchive.addSymbol(sym->name.c_str(), sym->offset);
+    return true;
+  }
+
   llvm::StringRef header_region = memory_area->request(
       (pArchive.getARFile().fileOffset() + Archive::MAGIC_LEN),
       sizeof(Archive::MemberHeader));
@@ -289,6 +306,17 @@ bool GNUArchiveReader::readSymbolTable(Archive& pArchive) {
     else
       unreachable(diag::err_unsupported_archive);
   }
+
+  if (entry != NULL) {
+    entry->archiveSymTabSize = symtab_size;
+    Archive::SymTabType::const_iterator sym,
+        symEnd = pArchive.getSymbolTable().end();
+    for (sym = pArchive.getSymbolTable().begin(); sym != symEnd; ++sym) {
+      InputCache::ArchiveSymbol cached = {(*sym)->name, (*sym)->fileOffset};
+      entry->archiveSymbols.push_back(cached);
+    }
+    entry->hasArchiveSymbols = true;
+  }
   return true;
 }
 
@@ -325,22 +353,6 @@ bool GNUArchiveReader::readStringTable(Archive& pArchive) {
   return true;
 }
 
-/// shouldIncludeStatus - given a sym name from armap and check if including
-/// the corresponding archive member, and then return the decision
-enum Archive::Symbol::Status GNUArchiveReader::shouldIncludeSymbol(
-    const llvm::StringRef& pSymName) const {
-  // TODO: handle symbol version issue and user defined symbols
-  const ResolveInfo* info = m_Module.getNamePool().findInfo(pSymName);
-  if (info != NULL) {
-    if (!info->isUndef())
-      return Archive::Symbol::Exclude;
-    if (info->isWeak())
-      return Archive::Symbol::Unknown;
-    return Archive::Symbol::Include;
-  }
-  return Archive::Symbol::Unknown;
-}
-
 /// includeMember - include the object member in the given file offset, and
 /// return the size of the object
 /// @param pConfig - LinkerConfig
@@ -20,11 +20,15 @@
 #include "mcld/LinkerScript.h"
 #include "mcld/Module.h"
 #include "mcld/Support/MsgHandling.h"
+#include "mcld/Support/Parallel.h"
 #include "mcld/Target/TargetLDBackend.h"
 
 #include <llvm/Support/Casting.h>
 
-#include <queue>
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <thread>
 #if !defined(MCLD_ON_WIN32)
 #include <fnmatch.h>
 #define fnmatch0(pattern, string) (fnmatch(pattern, string, 0) == 0)
@@ -68,6 +72,45 @@ static bool mayProcessGC(const LDSection& pSection) {
   return false;
 }
 
+namespace {
+
+/** \class WorkList
+ *  \brief WorkList is the shared part of the worklist of a mark thread. The
+ *  owner pushes its surplus at the back and pops from the back, and the idle
+ *  threads steal from the front.
+ */
+class WorkList {
+ public:
+  void push(const uint32_t* pBegin, const uint32_t* pEnd) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Items.insert(m_Items.end(), pBegin, pEnd);
+  }
+
+  bool pop(uint32_t& pIdx) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_Items.empty())
+      return false;
+    pIdx = m_Items.back();
+    m_Items.pop_back();
+    return true;
+  }
+
+  bool steal(uint32_t& pIdx) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_Items.empty())
+      return false;
+    pIdx = m_Items.front();
+    m_Items.pop_front();
+    return true;
+  }
+
+ private:
+  std::mutex m_Mutex;
+  std::deque<uint32_t> m_Items;
+};
+
+}  // anonymous namespace
+
 //===----------------------------------------------------------------------===//
 // GarbageCollection::SectionReachedListMap
 //===----------------------------------------------------------------------===//
@@ -105,79 +148,180 @@ GarbageCollection::~GarbageCollection() {
 }
 
 bool GarbageCollection::run() {
-  // 1. traverse all the relocations to set up the reached sections of each
+  // 1. number the input sections
+  numberSections();
+
+  // 2. traverse all the relocations to set up the reached sections of each
   // section
-  setUpReachedSections();
   m_Backend.setUpReachedSectionsForGC(m_Module, m_SectionReachedListMap);
+  setUpReachedSections();
 
-  // 2. get all sections defined the entry point
+  // 3. get all sections defined the entry point
   SectionVecTy entry;
   getEntrySections(entry);
 
-  // 3. find all the referenced sections those can be reached by entry
+  // 4. find all the referenced sections those can be reached by entry
   findReferencedSections(entry);
 
-  // 4. stripSections - set the unreached sections to Ignore
+  // 5. stripSections - set the unreached sections to Ignore
   stripSections();
   return true;
 }
 
-void GarbageCollection::setUpReachedSections() {
-  // traverse all the input relocations to setup the reached sections
-  Module::obj_iterator input, inEnd = m_Module.obj_end();
-  for (input = m_Module.obj_begin(); input != inEnd; ++input) {
-    LDContext::sect_iterator rs, rsEnd = (*input)->context()->relocSectEnd();
-    for (rs = (*input)->context()->relocSectBegin(); rs != rsEnd; ++rs) {
-      // bypass the discarded relocation section
-      // 1. its section kind is changed to Ignore. (The target section is a
-      // discarded group section.)
-      // 2. it has no reloc data. (All symbols in the input relocs are in the
-      // discarded group sections)
-      LDSection* reloc_sect = *rs;
-      LDSection* apply_sect = reloc_sect->getLink();
-      if ((LDFileFormat::Ignore == reloc_sect->kind()) ||
-          (!reloc_sect->hasRelocData()))
-        continue;
+void GarbageCollection::numberSections() {
+  Module::obj_iterator obj, objEnd = m_Module.obj_end();
+  for (obj = m_Module.obj_begin(); obj != objEnd; ++obj) {
+    m_InputBase.push_back(m_Sections.size());
+    LDContext::sect_iterator sect, sectEnd = (*obj)->context()->sectEnd();
+    for (sect = (*obj)->context()->sectBegin(); sect != sectEnd; ++sect) {
+      m_SectionIndex[*sect] = m_Sections.size();
+      m_Sections.push_back(*sect);
+    }
+  }
+}
 
-      // bypass the apply target sections which are not handled by gc
-      if (!mayProcessGC(*apply_sect))
-        continue;
+int64_t GarbageCollection::getIndex(const LDSection& pSection) const {
+  std::unordered_map<const LDSection*, uint32_t>::const_iterator it =
+      m_SectionIndex.find(&pSection);
+  if (it == m_SectionIndex.end())
+    return -1;
+  return it->second;
+}
 
-      bool add_first = false;
-      SectionListTy* reached_sects = NULL;
-      RelocData::iterator reloc_it, rEnd = reloc_sect->getRelocData()->end();
-      for (reloc_it = reloc_sect->getRelocData()->begin(); reloc_it != rEnd;
-           ++reloc_it) {
-        Relocation* reloc = llvm::cast<Relocation>(reloc_it);
-        ResolveInfo* sym = reloc->symInfo();
-        // only the target symbols defined in the input fragments can make the
-        // reference
-        if (sym == NULL)
-          continue;
-        if (!sym->isDefine() || !sym->outSymbol()->hasFragRef())
-          continue;
+void GarbageCollection::collectReferences(size_t pInput,
+                                          EdgeListTy& pEdges) const {
+  // traverse all the relocations of the input to setup the reached sections
+  LDContext* context = m_Module.getObjectList()[pInput]->context();
+  LDContext::sect_iterator rs, rsEnd = context->relocSectEnd();
+  for (rs = context->relocSectBegin(); rs != rsEnd; ++rs) {
+    // bypass the discarded relocation section
+    // 1. its section kind is changed to Ignore. (The target section is a
+    // discarded group section.)
+    // 2. it has no reloc data. (All symbols in the input relocs are in the
+    // discarded group sections)
+    LDSection* reloc_sect = *rs;
+    LDSection* apply_sect = reloc_sect->getLink();
+    if ((LDFileFormat::Ignore == reloc_sect->kind()) ||
+        (!reloc_sect->hasRelocData()))
+      continue;
 
-        // only the target symbols defined in the concerned sections can make
-        // the reference
-        const LDSection* target_sect =
-            &sym->outSymbol()->fragRef()->frag()->getParent()->getSection();
-        if (!mayProcessGC(*target_sect))
-          continue;
+    // bypass the apply target sections which are not handled by gc
+    if (!mayProcessGC(*apply_sect))
+      continue;
 
-        // setup the reached list, if we first add the element to reached list
-        // of this section, create an entry in ReachedSections map
-        if (!add_first) {
-          reached_sects = &m_SectionReachedListMap.getReachedList(*apply_sect);
-          add_first = true;
-        }
-        reached_sects->insert(target_sect);
-      }
-      reached_sects = NULL;
-      add_first = false;
+    int64_t from = getIndex(*apply_sect);
+    if (from < 0)
+      continue;
+
+    // the relocations are still packed unless the target has looked at
+    // them to set up its own references
+    const RelocData* reloc_data = reloc_sect->getRelocData();
+    if (reloc_data->hasPacked()) {
+      for (size_t i = 0, e = reloc_data->numOfPacked(); i != e; ++i)
+        addReference(from, reloc_data->getSymInfo(i), pEdges);
+    } else {
+      RelocData::const_iterator reloc, rEnd = reloc_data->end();
+      for (reloc = reloc_data->begin(); reloc != rEnd; ++reloc)
+        addReference(from, reloc->symInfo(), pEdges);
     }
   }
 }
 
+void GarbageCollection::addReference(int64_t pFrom,
+                                     const ResolveInfo* pSym,
+                                     EdgeListTy& pEdges) const {
+  // only the target symbols defined in the input fragments can make the
+  // reference
+  if (pSym == NULL)
+    return;
+  if (!pSym->isDefine() || !pSym->outSymbol()->hasFragRef())
+    return;
+
+  // only the target symbols defined in the concerned sections can make the
+  // reference
+  const LDSection* target_sect =
+      &pSym->outSymbol()->fragRef()->frag()->getParent()->getSection();
+  if (!mayProcessGC(*target_sect))
+    return;
+
+  // the sections not in the objects reach nothing and are never stripped
+  int64_t to = getIndex(*target_sect);
+  if (to >= 0)
+    pEdges.push_back(std::make_pair(pFrom, to));
+}
+
+void GarbageCollection::setUpReachedSections() {
+  unsigned threads = m_Config.options().numThreads();
+  size_t num_inputs = m_InputBase.size();
+
+  // collect the references of each input. A reference starts from the input
+  // section that it is applied to, so the references of an input start from
+  // its own sections
+  std::vector<EdgeListTy> edges(num_inputs);
+  parallelFor(threads, 0, num_inputs, [&](size_t pInput) {
+    collectReferences(pInput, edges[pInput]);
+  });
+
+  // add the references set up by the target to the input they start from
+  SectionReachedListMap::const_iterator it, end = m_SectionReachedListMap.end();
+  for (it = m_SectionReachedListMap.begin(); it != end; ++it) {
+    int64_t from = getIndex(*it->first);
+    if (from < 0)
+      continue;
+    size_t input = std::upper_bound(m_InputBase.begin(), m_InputBase.end(),
+                                    from) - m_InputBase.begin() - 1;
+    SectionListTy::const_iterator to, toEnd = it->second.end();
+    for (to = it->second.begin(); to != toEnd; ++to) {
+      int64_t idx = getIndex(**to);
+      if (idx >= 0)
+        edges[input].push_back(std::make_pair(from, idx));
+    }
+  }
+
+  // sort the references of each input by the section they start from, and
+  // count the references of each section
+  size_t num_sects = m_Sections.size();
+  m_ReachedBegin.assign(num_sects + 1, 0);
+  parallelFor(threads, 0, num_inputs, [&](size_t pInput) {
+    EdgeListTy& list = edges[pInput];
+    std::sort(list.begin(), list.end());
+    list.erase(std::unique(list.begin(), list.end()), list.end());
+    EdgeListTy::iterator edge, edgeEnd = list.end();
+    for (edge = list.begin(); edge != edgeEnd; ++edge)
+      ++m_ReachedBegin[edge->first];
+  });
+
+  // turn the counts into the beginning of the reached list of each section
+  uint32_t offset = 0;
+  for (size_t i = 0; i < num_sects; ++i) {
+    uint32_t count = m_ReachedBegin[i];
+    m_ReachedBegin[i] = offset;
+    offset += count;
+  }
+  m_ReachedBegin[num_sects] = offset;
+
+  // the reached lists of an input are consecutive
+  m_Reached.resize(offset);
+  parallelFor(threads, 0, num_inputs, [&](size_t pInput) {
+    std::vector<uint32_t>::iterator out =
+        m_Reached.begin() + m_ReachedBegin[m_InputBase[pInput]];
+    EdgeListTy::iterator edge, edgeEnd = edges[pInput].end();
+    for (edge = edges[pInput].begin(); edge != edgeEnd; ++edge)
+      *out++ = edge->second;
+  });
+}
+
+bool GarbageCollection::mark(uint32_t pIdx) {
+  uint64_t bit = 1ULL << (pIdx % 64);
+  return (m_Referenced[pIdx / 64].fetch_or(bit, std::memory_order_relaxed) &
+          bit) == 0;
+}
+
+bool GarbageCollection::isMarked(uint32_t pIdx) const {
+  uint64_t bit = 1ULL << (pIdx % 64);
+  return (m_Referenced[pIdx / 64].load(std::memory_order_relaxed) & bit) != 0;
+}
+
 void GarbageCollection::getEntrySections(SectionVecTy& pEntry) {
   // all the KEEP sections defined in ldscript are entries, traverse all the
   // input sections and check the SectionMap to find the KEEP sections
@@ -285,55 +429,94 @@ void GarbageCollection::getEntrySections(SectionVecTy& pEntry) {
 }
 
 void GarbageCollection::findReferencedSections(SectionVecTy& pEntry) {
-  // list of sections waiting to be processed
-  typedef std::queue<const LDSection*> WorkListTy;
-  WorkListTy work_list;
-  // start from each entry, resolve the transitive closure
+  std::vector<std::atomic<uint64_t> >((m_Sections.size() + 63) / 64)
+      .swap(m_Referenced);
+  for (size_t i = 0; i < m_Referenced.size(); ++i)
+    m_Referenced[i].store(0, std::memory_order_relaxed);
+
+  // the entries are the roots of the transitive closure
+  std::vector<uint32_t> roots;
   SectionVecTy::iterator entry_it, entry_end = pEntry.end();
   for (entry_it = pEntry.begin(); entry_it != entry_end; ++entry_it) {
-    // add entry point to work list
-    work_list.push(*entry_it);
+    int64_t idx = getIndex(**entry_it);
+    if (idx >= 0 && mark(idx))
+      roots.push_back(idx);
+  }
 
-    // add section from the work_list to the referencedSections until every
-    // reached sections are added
+  unsigned threads = m_Config.options().numThreads();
+  if (threads <= 1) {
+    std::vector<uint32_t>& work_list = roots;
     while (!work_list.empty()) {
-      const LDSection* sect = work_list.front();
-      work_list.pop();
-      // add section to the ReferencedSections, if the section has been put into
-      // referencedSections, skip this section
-      if (!m_ReferencedSections.insert(sect).second)
-        continue;
+      uint32_t sect = work_list.back();
+      work_list.pop_back();
+      for (uint32_t i = m_ReachedBegin[sect]; i < m_ReachedBegin[sect + 1]; ++i)
+        if (mark(m_Reached[i]))
+          work_list.push_back(m_Reached[i]);
+    }
+    return;
+  }
 
-      // get the section reached list, if the section do not has one, which
-      // means no referenced between it and other sections, then skip it
-      SectionListTy* reach_list =
-          m_SectionReachedListMap.findReachedList(*sect);
-      if (reach_list == NULL)
-        continue;
+  // Each thread works on a private stack and moves its surplus to its shared
+  // WorkList, from which the idle threads steal. A section is pushed only by
+  // the thread that marks it, and pending counts the marked sections that
+  // have not been processed, so the walk ends when it drops to zero.
+  static const size_t ShareThreshold = 64;
+  std::vector<WorkList> lists(threads);
+  for (size_t i = 0; i < roots.size(); ++i)
+    lists[i % threads].push(&roots[i], &roots[i] + 1);
+  std::atomic<size_t> pending(roots.size());
+
+  parallelFor(threads, 0, threads, [&](size_t pWorker) {
+    std::vector<uint32_t> stack;
+    while (pending.load(std::memory_order_acquire) != 0) {
+      uint32_t sect;
+      if (!stack.empty()) {
+        sect = stack.back();
+        stack.pop_back();
+      } else if (!lists[pWorker].pop(sect)) {
+        bool stolen = false;
+        for (size_t i = 1; i < threads && !stolen; ++i)
+          stolen = lists[(pWorker + i) % threads].steal(sect);
+        if (!stolen) {
+          std::this_thread::yield();
+          continue;
+        }
+      }
+
+      for (uint32_t i = m_ReachedBegin[sect]; i < m_ReachedBegin[sect + 1];
+           ++i) {
+        if (mark(m_Reached[i])) {
+          pending.fetch_add(1, std::memory_order_relaxed);
+          stack.push_back(m_Reached[i]);
+        }
+      }
 
-      // put the reached sections to work list, skip the one already be in
-      // referencedSections
-      SectionListTy::iterator it, end = reach_list->end();
-      for (it = reach_list->begin(); it != end; ++it) {
-        if (m_ReferencedSections.find(*it) == m_ReferencedSections.end())
-          work_list.push(*it);
+      // share the half of the surplus
+      if (stack.size() > ShareThreshold) {
+        size_t half = stack.size() / 2;
+        lists[pWorker].push(&stack[0], &stack[0] + half);
+        stack.erase(stack.begin(), stack.begin() + half);
       }
+      pending.fetch_sub(1, std::memory_order_release);
     }
-  }
+  });
 }
 
 void GarbageCollection::stripSections() {
-  // Traverse all the input Regular and BSS sections, if a section is not found
-  // in the ReferencedSections, then it should be garbage collected
+  // Traverse all the input Regular and BSS sections, if a section is not marked
+  // as referenced, then it should be garbage collected. The sections are
+  // visited in the order they are numbered.
+  uint32_t idx = 0;
   Module::obj_iterator obj, objEnd = m_Module.obj_end();
   for (obj = m_Module.obj_begin(); obj != objEnd; ++obj) {
     LDContext::sect_iterator sect, sectEnd = (*obj)->context()->sectEnd();
-    for (sect = (*obj)->context()->sectBegin(); sect != sectEnd; ++sect) {
+    for (sect = (*obj)->context()->sectBegin(); sect != sectEnd;
+         ++sect, ++idx) {
       LDSection* section = *sect;
       if (!mayProcessGC(*section))
         continue;
 
-      if (m_ReferencedSections.find(section) == m_ReferencedSections.end()) {
+      if (!isMarked(idx)) {
         section->setKind(LDFileFormat::Ignore);
         debug(diag::debug_print_gc_sections) << section->name()
                                              << (*obj)->name();
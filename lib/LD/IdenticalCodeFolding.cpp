@@ -21,18 +21,18 @@
 #include "mcld/MC/Input.h"
 #include "mcld/Support/Demangle.h"
 #include "mcld/Support/MsgHandling.h"
+#include "mcld/Support/Parallel.h"
+#include "mcld/Support/XXHash.h"
 #include "mcld/Target/GNULDBackend.h"
 
 #include <llvm/ADT/StringRef.h>
 #include <llvm/Support/Casting.h>
-#include <llvm/Support/Format.h>
 
+#include <algorithm>
 #include <cassert>
 #include <map>
 #include <set>
 
-#include <zlib.h>
-
 namespace mcld {
 
 static bool isSymCtorOrDtor(const ResolveInfo& pSym) {
@@ -45,6 +45,53 @@ static bool isSymCtorOrDtor(const ResolveInfo& pSym) {
   return isCtorOrDtor(pSym.name(), pSym.nameSize());
 }
 
+static inline uint64_t hashCombine(uint64_t pHash, uint64_t pValue) {
+  uint64_t data[2] = {pHash, pValue};
+  return xxHash64(reinterpret_cast<const uint8_t*>(data), sizeof(data));
+}
+
+/// groupCandidates - set pClass[i] to the smallest index j such that
+/// pEqual(j, i). pHashes[i] is the hash of candidate i, and equal candidates
+/// must have equal hashes.
+template <typename EqualTy>
+static void groupCandidates(unsigned pThreads,
+                            const std::vector<uint64_t>& pHashes,
+                            EqualTy pEqual,
+                            std::vector<size_t>& pClass) {
+  size_t size = pHashes.size();
+  std::vector<std::pair<uint64_t, size_t> > order(size);
+  for (size_t i = 0; i < size; ++i)
+    order[i] = std::make_pair(pHashes[i], i);
+  std::sort(order.begin(), order.end());
+
+  // the candidates of the same hash are consecutive, and sorted by index
+  std::vector<size_t> runs;
+  for (size_t i = 0; i < size; ++i) {
+    if (i == 0 || order[i].first != order[i - 1].first)
+      runs.push_back(i);
+  }
+  runs.push_back(size);
+
+  pClass.resize(size);
+  parallelFor(pThreads, 0, runs.size() - 1, [&](size_t pRun) {
+    std::vector<size_t> leaders;
+    for (size_t i = runs[pRun]; i < runs[pRun + 1]; ++i) {
+      size_t idx = order[i].second;
+      std::vector<size_t>::iterator leader, lEnd = leaders.end();
+      for (leader = leaders.begin(); leader != lEnd; ++leader) {
+        if (pEqual(*leader, idx))
+          break;
+      }
+      if (leader == lEnd) {
+        leaders.push_back(idx);
+        pClass[idx] = idx;
+      } else {
+        pClass[idx] = *leader;
+      }
+    }
+  });
+}
+
 IdenticalCodeFolding::IdenticalCodeFolding(const LinkerConfig& pConfig,
                                            const TargetLDBackend& pBackend,
                                            Module& pModule)
@@ -57,9 +104,23 @@ void IdenticalCodeFolding::foldIdenticalCode() {
   findCandidates(candidate_list);
 
   // 2. Initialize constant section content
-  for (size_t i = 0; i < candidate_list.size(); ++i) {
-    candidate_list[i].initConstantContent(m_Backend, m_KeptSections);
-  }
+  unsigned threads = m_Config.options().numThreads();
+  parallelForEach(threads, candidate_list.begin(), candidate_list.end(),
+                  [this](FoldingCandidate& pCandidate) {
+    pCandidate.initConstantContent(m_Backend, m_KeptSections);
+  });
+
+  std::vector<uint64_t> hashes(candidate_list.size());
+  for (size_t i = 0; i < candidate_list.size(); ++i)
+    hashes[i] = candidate_list[i].hash;
+  groupCandidates(threads, hashes, [&](size_t pA, size_t pB) {
+    return candidate_list[pA].isConstantEqual(candidate_list[pB]);
+  }, m_ConstantClass);
+
+  // every candidate is kept at first
+  m_Kept.resize(candidate_list.size());
+  for (size_t i = 0; i < m_Kept.size(); ++i)
+    m_Kept[i] = i;
 
   // 3. Find identical code until convergence
   bool converged = false;
@@ -72,6 +133,9 @@ void IdenticalCodeFolding::foldIdenticalCode() {
     debug(diag::debug_icf_iterations) << iterations;
   }
 
+  for (size_t i = 0; i < candidate_list.size(); ++i)
+    m_KeptSections[candidate_list[i].sect].second = m_Kept[i];
+
   // 4. Fold the identical code
   typedef std::set<Input*> FoldedObjects;
   FoldedObjects folded_objs;
@@ -108,8 +172,18 @@ void IdenticalCodeFolding::foldIdenticalCode() {
         if (sect->kind() == LDFileFormat::Folded) {
           size_t kept_index = m_KeptSections[sect].second;
           LDSection* kept_sect = (*(m_KeptSections.begin() + kept_index)).first;
-          frag_ref->assign(kept_sect->getSectionData()->front(),
-                           frag_ref->offset());
+          // the folded section is identical to the kept one, so the symbol
+          // is at the same offset from the start of the kept section
+          uint64_t sect_offset =
+              frag_ref->frag()->getOffset() + frag_ref->offset();
+          Fragment* frag = NULL;
+          uint64_t offset = 0;
+          bool found = kept_sect->getSectionData()->findFragment(
+              sect_offset, frag, offset);
+          assert(found && frag != NULL &&
+                 "the folded symbol is out of the kept section");
+          (void)found;
+          frag_ref->assign(*frag, offset);
         }
       }
     }  // for each symbol
@@ -134,6 +208,10 @@ void IdenticalCodeFolding::findCandidates(FoldingCandidates& pCandidateList) {
           LDSection* target = (*sect)->getLink();
           if (target->kind() == LDFileFormat::TEXT) {
             candidate_map[target] = *sect;
+            // the candidates are hashed on many threads, which must not
+            // materialize the relocations
+            if ((*sect)->hasRelocData())
+              (*sect)->getRelocData()->materialize();
           }
 
           // Safe icf
@@ -178,49 +256,68 @@ void IdenticalCodeFolding::findCandidates(FoldingCandidates& pCandidateList) {
 }
 
 bool IdenticalCodeFolding::matchCandidates(FoldingCandidates& pCandidateList) {
-  typedef std::multimap<uint32_t, size_t> ChecksumMap;
-  ChecksumMap checksum_map;
-  std::vector<std::string> contents(pCandidateList.size());
-  bool converged = true;
-
-  for (size_t index = 0; index < pCandidateList.size(); ++index) {
-    contents[index] = pCandidateList[index].getContentWithVariables(
-        m_Backend, m_KeptSections);
-    uint32_t checksum = ::crc32(0xFFFFFFFF,
-                                (const uint8_t*)contents[index].c_str(),
-                                contents[index].length());
-
-    size_t count = checksum_map.count(checksum);
-    if (count == 0) {
-      checksum_map.insert(std::make_pair(checksum, index));
-    } else {
-      std::pair<ChecksumMap::iterator, ChecksumMap::iterator> ret =
-          checksum_map.equal_range(checksum);
-      for (ChecksumMap::iterator it = ret.first; it != ret.second; ++it) {
-        size_t kept_index = (*it).second;
-        if (contents[index].compare(contents[kept_index]) == 0) {
-          m_KeptSections[pCandidateList[index].sect].second = kept_index;
-          converged = false;
-          break;
-        }
-      }
+  // hash the constant class and the kept candidates referred by each
+  // candidate
+  unsigned threads = m_Config.options().numThreads();
+  std::vector<uint64_t> hashes(pCandidateList.size());
+  parallelFor(threads, 0, pCandidateList.size(), [&](size_t pIdx) {
+    uint64_t hash = m_ConstantClass[pIdx];
+    const std::vector<size_t>& variables = pCandidateList[pIdx].variables;
+    for (size_t i = 0; i < variables.size(); ++i)
+      hash = hashCombine(hash, m_Kept[variables[i]]);
+    hashes[pIdx] = hash;
+  });
+
+  std::vector<size_t> kept;
+  groupCandidates(threads, hashes, [&](size_t pA, size_t pB) {
+    if (m_ConstantClass[pA] != m_ConstantClass[pB])
+      return false;
+    // the candidates of the same constant class have the same number of
+    // variables
+    const std::vector<size_t>& varA = pCandidateList[pA].variables;
+    const std::vector<size_t>& varB = pCandidateList[pB].variables;
+    for (size_t i = 0; i < varA.size(); ++i) {
+      if (m_Kept[varA[i]] != m_Kept[varB[i]])
+        return false;
     }
-  }
+    return true;
+  }, kept);
 
+  bool converged = (kept == m_Kept);
+  m_Kept.swap(kept);
   return converged;
 }
 
+//===----------------------------------------------------------------------===//
+// IdenticalCodeFolding::FoldingCandidate
+//===----------------------------------------------------------------------===//
+bool IdenticalCodeFolding::FoldingCandidate::ConstantReloc::operator==(
+    const ConstantReloc& pOther) const {
+  if (kind != pOther.kind || type != pOther.type ||
+      symValue != pOther.symValue || addend != pOther.addend ||
+      place != pOther.place)
+    return false;
+  if (kind != Symbol)
+    return true;
+  // the local symbols are identical only if they are in the same input
+  if (obj != pOther.obj)
+    return false;
+  return llvm::StringRef(sym->name(), sym->nameSize()) ==
+         llvm::StringRef(pOther.sym->name(), pOther.sym->nameSize());
+}
+
 void IdenticalCodeFolding::FoldingCandidate::initConstantContent(
     const TargetLDBackend& pBackend,
     const IdenticalCodeFolding::KeptSections& pKeptSections) {
   // Get the static content from text.
   assert(sect != NULL && sect->hasSectionData());
+  std::vector<llvm::StringRef> regions;
   SectionData::const_iterator frag, fragEnd = sect->getSectionData()->end();
   for (frag = sect->getSectionData()->begin(); frag != fragEnd; ++frag) {
     switch (frag->getKind()) {
       case Fragment::Region: {
         const RegionFragment& region = llvm::cast<RegionFragment>(*frag);
-        content.append(region.getRegion().begin(), region.size());
+        regions.push_back(region.getRegion());
         break;
       }
       default: {
@@ -229,71 +326,63 @@ void IdenticalCodeFolding::FoldingCandidate::initConstantContent(
       }
     }
   }
+  if (regions.size() == 1) {
+    content = regions.front();
+  } else {
+    for (size_t i = 0; i < regions.size(); ++i)
+      m_Joined.append(regions[i].data(), regions[i].size());
+    content = m_Joined;
+  }
+  hash = xxHash64(reinterpret_cast<const uint8_t*>(content.data()),
+                  content.size());
 
   // Get the static content from relocs.
   if (reloc_sect != NULL && reloc_sect->hasRelocData()) {
     RelocData::iterator rel, relEnd = reloc_sect->getRelocData()->end();
     for (rel = reloc_sect->getRelocData()->begin(); rel != relEnd; ++rel) {
-      llvm::format_object<Relocation::Type,
-                          Relocation::Address,
-                          Relocation::Address,
-                          Relocation::Address> rel_info("%x%llx%llx%llx",
-                                                        rel->type(),
-                                                        rel->symValue(),
-                                                        rel->addend(),
-                                                        rel->place());
-      char rel_str[48];
-      rel_info.print(rel_str, sizeof(rel_str));
-      content.append(rel_str);
+      ConstantReloc constant = { ConstantReloc::Symbol, rel->type(),
+                                 rel->symValue(), rel->addend(), rel->place(),
+                                 NULL, NULL };
+      hash = hashCombine(hash, constant.type);
+      hash = hashCombine(hash, constant.symValue);
+      hash = hashCombine(hash, constant.addend);
+      hash = hashCombine(hash, constant.place);
 
       // Handle the recursive call.
       LDSymbol* sym = rel->symInfo()->outSymbol();
-      if ((sym->type() == ResolveInfo::Function) && sym->hasFragRef()) {
-        LDSection* def = &sym->fragRef()->frag()->getParent()->getSection();
-        if (def == sect) {
-          continue;
-        }
-      }
-
-      if (!pBackend.isSymbolPreemptible(*rel->symInfo()) && sym->hasFragRef() &&
-          (pKeptSections.find(
-               &sym->fragRef()->frag()->getParent()->getSection()) !=
-           pKeptSections.end())) {
+      LDSection* def = NULL;
+      if (sym->hasFragRef())
+        def = &sym->fragRef()->frag()->getParent()->getSection();
+      if ((sym->type() == ResolveInfo::Function) && (def == sect)) {
+        constant.kind = ConstantReloc::Self;
+      } else if (!pBackend.isSymbolPreemptible(*rel->symInfo()) &&
+                 (def != NULL) &&
+                 (pKeptSections.find(def) != pKeptSections.end())) {
         // Mark this reloc as a variable.
-        variable_relocs.push_back(rel);
+        constant.kind = ConstantReloc::Variable;
+        variables.push_back(pKeptSections.find(def)->second.second);
       } else {
         // TODO: Support inlining merge sections if possible (target-dependent).
+        constant.sym = rel->symInfo();
         if ((sym->binding() == ResolveInfo::Local) ||
             (sym->binding() == ResolveInfo::Absolute)) {
           // ABS or Local symbols.
-          content.append(sym->name()).append(obj->name()).append(
-              obj->path().native());
-        } else {
-          content.append(sym->name());
+          constant.obj = obj;
         }
+        hash = hashCombine(hash, xxHash64(
+            reinterpret_cast<const uint8_t*>(constant.sym->name()),
+            constant.sym->nameSize()));
       }
+      hash = hashCombine(hash, constant.kind);
+      relocs.push_back(constant);
     }
   }
 }
 
-std::string IdenticalCodeFolding::FoldingCandidate::getContentWithVariables(
-    const TargetLDBackend& pBackend,
-    const IdenticalCodeFolding::KeptSections& pKeptSections) {
-  std::string result(content);
-  // Compute the variable content from relocs.
-  std::vector<Relocation*>::const_iterator rel, relEnd = variable_relocs.end();
-  for (rel = variable_relocs.begin(); rel != relEnd; ++rel) {
-    LDSymbol* sym = (*rel)->symInfo()->outSymbol();
-    LDSection* def = &sym->fragRef()->frag()->getParent()->getSection();
-    // Use the kept section index.
-    KeptSections::const_iterator it = pKeptSections.find(def);
-    llvm::format_object<size_t> kept_info("%x", (*it).second.second);
-    char kept_str[8];
-    kept_info.print(kept_str, sizeof(kept_str));
-    result.append(kept_str);
-  }
-
-  return result;
+bool IdenticalCodeFolding::FoldingCandidate::isConstantEqual(
+    const FoldingCandidate& pOther) const {
+  return hash == pOther.hash && content == pOther.content &&
+         relocs == pOther.relocs;
 }
 
 }  // namespace mcld
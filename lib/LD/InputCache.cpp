@@ -0,0 +1,135 @@
+//===- InputCache.cpp -----------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "mcld/LD/InputCache.h"
+
+#include "mcld/MC/Input.h"
+#include "mcld/Support/FileSystem.h"
+#include "mcld/Support/MemoryArea.h"
+#include "mcld/Support/Path.h"
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/TimeValue.h>
+
+namespace mcld {
+
+/// g_pInputCache - the cache of this process, NULL if disabled
+static InputCache* g_pInputCache = NULL;
+
+//===----------------------------------------------------------------------===//
+// InputCache::Entry
+//===----------------------------------------------------------------------===//
+InputCache::Entry::Entry()
+    : device(0),
+      inode(0),
+      mtime(0),
+      ctime(0),
+      size(0),
+      area(NULL),
+      hasArchiveSymbols(false),
+      archiveSymTabSize(0),
+      hasDynSymbols(false) {
+}
+
+InputCache::Entry::~Entry() {
+  delete area;
+}
+
+//===----------------------------------------------------------------------===//
+// InputCache
+//===----------------------------------------------------------------------===//
+InputCache::InputCache() {
+}
+
+InputCache::~InputCache() {
+  clear();
+}
+
+InputCache* InputCache::Get() {
+  return g_pInputCache;
+}
+
+void InputCache::Enable() {
+  if (g_pInputCache == NULL)
+    g_pInputCache = new InputCache();
+}
+
+MemoryArea* InputCache::getMemoryArea(const sys::fs::Path& pPath) {
+  llvm::sys::fs::file_status status;
+  if (llvm::sys::fs::status(pPath.native(), status) ||
+      !llvm::sys::fs::is_regular_file(status))
+    return NULL;
+
+  // The links may run in different directories. A relative path is made
+  // absolute so that the same file gets the same entry; the identity check
+  // below guards the rest.
+  llvm::SmallString<256> name(pPath.native());
+  llvm::sys::fs::make_absolute(name);
+
+  llvm::sys::fs::UniqueID id = status.getUniqueID();
+  llvm::sys::TimeValue time = status.getLastModificationTime();
+  uint64_t mtime = time.toEpochTime() * 1000000000ULL + time.nanoseconds();
+
+  // The modification time may be too coarse to tell two writes apart, and
+  // can be set back, while any write moves the status change time.
+  uint64_t ctime = sys::fs::detail::change_time(pPath);
+
+  EntryMapTy::iterator it = m_Entries.find(name);
+  if (it != m_Entries.end()) {
+    Entry* entry = it->getValue();
+    if (entry->device == id.getDevice() && entry->inode == id.getFile() &&
+        entry->mtime == mtime && entry->ctime == ctime &&
+        entry->size == status.getSize())
+      return entry->area;
+
+    // the file has been changed since it was cached
+    m_Entries.erase(it);
+    erase(entry);
+  }
+
+  Entry* entry = new Entry();
+  entry->device = id.getDevice();
+  entry->inode = id.getFile();
+  entry->mtime = mtime;
+  entry->ctime = ctime;
+  entry->size = status.getSize();
+  entry->area = new MemoryArea(pPath.native());
+
+  m_Entries[name] = entry;
+  m_AreaMap[entry->area] = entry;
+  return entry->area;
+}
+
+InputCache::Entry* InputCache::lookup(const Input& pInput) {
+  if (pInput.fileOffset() != 0 || !pInput.hasMemArea())
+    return NULL;
+
+  AreaMapTy::iterator it = m_AreaMap.find(pInput.memArea());
+  if (it == m_AreaMap.end())
+    return NULL;
+  return it->second;
+}
+
+bool InputCache::isCached(const MemoryArea* pArea) const {
+  return (m_AreaMap.find(pArea) != m_AreaMap.end());
+}
+
+void InputCache::clear() {
+  EntryMapTy::iterator it, itEnd = m_Entries.end();
+  for (it = m_Entries.begin(); it != itEnd; ++it)
+    erase(it->getValue());
+  m_Entries.clear();
+}
+
+void InputCache::erase(Entry* pEntry) {
+  m_AreaMap.erase(pEntry->area);
+  delete pEntry;
+}
+
+}  // namespace mcld
@@ -9,14 +9,13 @@
 #include "mcld/LD/LDSection.h"
 
 #include "mcld/Support/GCFactory.h"
-
-#include <llvm/Support/ManagedStatic.h>
+#include "mcld/Support/LinkerContext.h"
 
 namespace mcld {
 
 typedef GCFactory<LDSection, MCLD_SECTIONS_PER_INPUT> SectionFactory;
 
-static llvm::ManagedStatic<SectionFactory> g_SectFactory;
+static ContextStatic<SectionFactory> g_SectFactory;
 
 //===----------------------------------------------------------------------===//
 // LDSection
@@ -30,6 +29,7 @@ LDSection::LDSection()
       m_Offset(~uint64_t(0)),
       m_Addr(0x0),
       m_Align(0),
+      m_EntSize(0),
       m_Info(0),
       m_pLink(NULL),
       m_Index(0) {
@@ -50,6 +50,7 @@ LDSection::LDSection(const std::string& pName,
       m_Offset(~uint64_t(0)),
       m_Addr(pAddr),
       m_Align(0),
+      m_EntSize(0),
       m_Info(0),
       m_pLink(NULL),
       m_Index(0) {
@@ -12,10 +12,12 @@
 #include "mcld/Fragment/FragmentRef.h"
 #include "mcld/Fragment/NullFragment.h"
 #include "mcld/Support/GCFactory.h"
+#include "mcld/Support/LinkerContext.h"
 
 #include <llvm/Support/ManagedStatic.h>
 
 #include <cstring>
+#include <mutex>
 
 namespace mcld {
 
@@ -23,12 +25,18 @@ typedef GCFactory<LDSymbol, MCLD_SYMBOLS_PER_INPUT> LDSymbolFactory;
 
 static llvm::ManagedStatic<LDSymbol> g_NullSymbol;
 static llvm::ManagedStatic<NullFragment> g_NullSymbolFragment;
-static llvm::ManagedStatic<LDSymbolFactory> g_LDSymbolFactory;
+static std::once_flag g_NullSymbolFlag;
+static ContextStatic<LDSymbolFactory> g_LDSymbolFactory;
 
 //===----------------------------------------------------------------------===//
 // LDSymbol
 //===----------------------------------------------------------------------===//
-LDSymbol::LDSymbol() : m_pResolveInfo(NULL), m_pFragRef(NULL), m_Value(0) {
+LDSymbol::LDSymbol()
+    : m_pResolveInfo(NULL),
+      m_pFragRef(NULL),
+      m_Value(0),
+      m_GNUHash(0),
+      m_SysVHash(NoHash) {
 }
 
 LDSymbol::~LDSymbol() {
@@ -37,13 +45,17 @@ LDSymbol::~LDSymbol() {
 LDSymbol::LDSymbol(const LDSymbol& pCopy)
     : m_pResolveInfo(pCopy.m_pResolveInfo),
       m_pFragRef(pCopy.m_pFragRef),
-      m_Value(pCopy.m_Value) {
+      m_Value(pCopy.m_Value),
+      m_GNUHash(pCopy.m_GNUHash),
+      m_SysVHash(pCopy.m_SysVHash) {
 }
 
 LDSymbol& LDSymbol::operator=(const LDSymbol& pCopy) {
   m_pResolveInfo = pCopy.m_pResolveInfo;
   m_pFragRef = pCopy.m_pFragRef;
   m_Value = pCopy.m_Value;
+  m_GNUHash = pCopy.m_GNUHash;
+  m_SysVHash = pCopy.m_SysVHash;
   return (*this);
 }
 
@@ -65,12 +77,14 @@ void LDSymbol::Clear() {
 }
 
 LDSymbol* LDSymbol::Null() {
-  // lazy initialization
-  if (g_NullSymbol->resolveInfo() == NULL) {
+  // lazy initialization. The null symbol is shared by all links, so its
+  // fragment reference is kept in the default context.
+  std::call_once(g_NullSymbolFlag, []() {
+    LinkerContext::Scope scope(LinkerContext::global());
     g_NullSymbol->setResolveInfo(*ResolveInfo::Null());
     g_NullSymbol->setFragmentRef(FragmentRef::Create(*g_NullSymbolFragment, 0));
     ResolveInfo::Null()->setSymPtr(&*g_NullSymbol);
-  }
+  });
   return &*g_NullSymbol;
 }
 
@@ -80,6 +94,8 @@ void LDSymbol::setFragmentRef(FragmentRef* pFragmentRef) {
 
 void LDSymbol::setResolveInfo(const ResolveInfo& pInfo) {
   m_pResolveInfo = const_cast<ResolveInfo*>(&pInfo);
+  // the hash values belong to the name of the old info
+  m_SysVHash = NoHash;
 }
 
 bool LDSymbol::isNull() const {
@@ -0,0 +1,852 @@
+//===- LinkState.cpp ------------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "mcld/LD/LinkState.h"
+
+#include "mcld/GeneralOptions.h"
+#include "mcld/IRBuilder.h"
+#include "mcld/InputTree.h"
+#include "mcld/LinkerConfig.h"
+#include "mcld/Module.h"
+#include "mcld/Fragment/RegionFragment.h"
+#include "mcld/Fragment/Relocation.h"
+#include "mcld/LD/LDContext.h"
+#include "mcld/LD/LDSection.h"
+#include "mcld/LD/RelocData.h"
+#include "mcld/LD/Relocator.h"
+#include "mcld/LD/SectionData.h"
+#include "mcld/MC/Input.h"
+#include "mcld/Support/FileHandle.h"
+#include "mcld/Support/FileOutputBuffer.h"
+#include "mcld/Support/FileSystem.h"
+#include "mcld/Support/MemoryArea.h"
+#include "mcld/Support/MsgHandling.h"
+#include "mcld/Support/Path.h"
+#include "mcld/Support/XXHash.h"
+
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/Casting.h>
+#include <llvm/Support/ELF.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Process.h>
+#include <llvm/Support/TimeValue.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+namespace mcld {
+
+/// the first line of a state file
+static const char kStateMagic[] = "mcld-link-state 2";
+
+static uint64_t hashBytes(llvm::StringRef pData, uint64_t pSeed = 0) {
+  return xxHash64(reinterpret_cast<const uint8_t*>(pData.data()),
+                  pData.size(),
+                  pSeed);
+}
+
+static uint64_t getKey(const LinkerConfig& pConfig) {
+  return hashBytes(pConfig.options().getPatchKey());
+}
+
+static bool getStamp(llvm::StringRef pPath, LinkState::Stamp& pStamp) {
+  llvm::sys::fs::file_status status;
+  if (llvm::sys::fs::status(pPath, status) ||
+      !llvm::sys::fs::is_regular_file(status))
+    return false;
+
+  llvm::sys::TimeValue time = status.getLastModificationTime();
+  pStamp.size = status.getSize();
+  pStamp.mtime = time.toEpochTime() * 1000000000ULL + time.nanoseconds();
+  pStamp.inode = status.getUniqueID().getFile();
+  pStamp.ctime = sys::fs::detail::change_time(sys::fs::Path(pPath.str()));
+  return true;
+}
+
+/// copyOutput - copy the output pOutput to a new file next to it with the
+/// same permissions, and open the copy as pCopy. The name of the copy is
+/// returned in pTemp.
+static bool copyOutput(llvm::StringRef pOutput,
+                       FileHandle& pCopy,
+                       std::string& pTemp) {
+  llvm::sys::fs::file_status status;
+  if (llvm::sys::fs::status(pOutput, status))
+    return false;
+  llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer> > buffer =
+      llvm::MemoryBuffer::getFile(pOutput, -1, false);
+  if (!buffer)
+    return false;
+
+  // the octal permission bits, one digit per nibble of FileHandle::Permission
+  unsigned perms = status.permissions() & 0777;
+  FileHandle::Permission permission(
+      ((perms >> 6) & 7) << 8 | ((perms >> 3) & 7) << 4 | (perms & 7));
+
+  FileHandle::OpenMode open_mode(
+      FileHandle::ReadWrite | FileHandle::Create | FileHandle::Exclusive);
+  for (unsigned tries = 0; tries < 8; ++tries) {
+    std::string temp = pOutput.str() + ".tmp" +
+        llvm::utohexstr(llvm::sys::Process::GetRandomNumber());
+    if (!pCopy.open(sys::fs::Path(temp), open_mode, permission))
+      continue;
+    llvm::StringRef content = buffer.get()->getBuffer();
+    if (!pCopy.write(content.data(), 0, content.size())) {
+      pCopy.close();
+      llvm::sys::fs::remove(temp);
+      return false;
+    }
+    pTemp = temp;
+    return true;
+  }
+  return false;
+}
+
+static uint64_t hashFixups(llvm::StringRef pContent,
+                           const LinkState::RangeList& pFixups) {
+  uint64_t hash = 0;
+  LinkState::RangeList::const_iterator range, rEnd = pFixups.end();
+  for (range = pFixups.begin(); range != rEnd; ++range)
+    hash = hashBytes(pContent.substr(range->offset, range->size), hash);
+  return hash;
+}
+
+namespace {
+
+/// isKeptAsIs - whether the linker keeps the content of an input section of
+/// the kind pKind
+bool isKeptAsIs(LDFileFormat::Kind pKind) {
+  switch (pKind) {
+    case LDFileFormat::TEXT:
+    case LDFileFormat::DATA:
+    case LDFileFormat::Debug:
+    case LDFileFormat::Ignore:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/** \class ELFImage
+ *  \brief ELFImage decodes the section header table of a relocatable object.
+ *
+ *  The link state is computed from the files rather than from the IR, so that
+ *  the next link can compare an object with its previous version before it
+ *  reads any input.
+ */
+class ELFImage {
+ public:
+  struct Section {
+    llvm::StringRef name;
+    uint32_t type;
+    uint64_t flags;
+    uint64_t addr;
+    uint64_t offset;
+    uint64_t size;
+    uint32_t link;
+    uint32_t info;
+    uint64_t align;
+    uint64_t entsize;
+  };
+
+ public:
+  bool parse(llvm::StringRef pFile);
+
+  size_t size() const { return m_Sections.size(); }
+
+  const Section& section(unsigned pIdx) const { return m_Sections[pIdx]; }
+
+  /// content - the content of a section, which is empty for SHT_NOBITS
+  llvm::StringRef content(unsigned pIdx) const;
+
+  /// isPatchable - whether the content of a section may be patched. The
+  /// sections that the linker decodes or merges are not.
+  bool isPatchable(unsigned pIdx) const;
+
+  /// hash - hash all the object but the content of the patchable sections
+  uint64_t hash(const std::vector<bool>& pPatchable) const;
+
+ private:
+  uint64_t read(uint64_t pOffset, unsigned pSize) const;
+
+  bool readSection(uint64_t pOffset, Section& pSection) const;
+
+ private:
+  llvm::StringRef m_File;
+  bool m_Is64;
+  bool m_IsLittle;
+  uint64_t m_HeaderSize;
+  std::vector<Section> m_Sections;
+};
+
+uint64_t ELFImage::read(uint64_t pOffset, unsigned pSize) const {
+  const uint8_t* data =
+      reinterpret_cast<const uint8_t*>(m_File.data()) + pOffset;
+  uint64_t result = 0;
+  for (unsigned i = 0; i < pSize; ++i) {
+    unsigned shift = m_IsLittle ? i : (pSize - 1 - i);
+    result |= uint64_t(data[i]) << (8 * shift);
+  }
+  return result;
+}
+
+bool ELFImage::readSection(uint64_t pOffset, Section& pSection) const {
+  if (m_Is64) {
+    pSection.type = read(pOffset + 4, 4);
+    pSection.flags = read(pOffset + 8, 8);
+    pSection.addr = read(pOffset + 16, 8);
+    pSection.offset = read(pOffset + 24, 8);
+    pSection.size = read(pOffset + 32, 8);
+    pSection.link = read(pOffset + 40, 4);
+    pSection.info = read(pOffset + 44, 4);
+    pSection.align = read(pOffset + 48, 8);
+    pSection.entsize = read(pOffset + 56, 8);
+  } else {
+    pSection.type = read(pOffset + 4, 4);
+    pSection.flags = read(pOffset + 8, 4);
+    pSection.addr = read(pOffset + 12, 4);
+    pSection.offset = read(pOffset + 16, 4);
+    pSection.size = read(pOffset + 20, 4);
+    pSection.link = read(pOffset + 24, 4);
+    pSection.info = read(pOffset + 28, 4);
+    pSection.align = read(pOffset + 32, 4);
+    pSection.entsize = read(pOffset + 36, 4);
+  }
+
+  if (pSection.type == llvm::ELF::SHT_NOBITS)
+    return true;
+  return pSection.offset <= m_File.size() &&
+         pSection.size <= m_File.size() - pSection.offset;
+}
+
+bool ELFImage::parse(llvm::StringRef pFile) {
+  m_File = pFile;
+  m_Sections.clear();
+  if (pFile.size() < llvm::ELF::EI_NIDENT ||
+      memcmp(pFile.data(), llvm::ELF::ElfMagic, 4) != 0)
+    return false;
+
+  uint8_t cls = pFile[llvm::ELF::EI_CLASS];
+  uint8_t encoding = pFile[llvm::ELF::EI_DATA];
+  if ((cls != llvm::ELF::ELFCLASS32 && cls != llvm::ELF::ELFCLASS64) ||
+      (encoding != llvm::ELF::ELFDATA2LSB &&
+       encoding != llvm::ELF::ELFDATA2MSB))
+    return false;
+  m_Is64 = (cls == llvm::ELF::ELFCLASS64);
+  m_IsLittle = (encoding == llvm::ELF::ELFDATA2LSB);
+
+  m_HeaderSize = m_Is64 ? 64 : 52;
+  if (pFile.size() < m_HeaderSize || read(16, 2) != llvm::ELF::ET_REL)
+    return false;
+
+  uint64_t shoff = m_Is64 ? read(40, 8) : read(32, 4);
+  uint64_t shentsize = read(m_Is64 ? 58 : 46, 2);
+  uint64_t shnum = read(m_Is64 ? 60 : 48, 2);
+  uint64_t shstrndx = read(m_Is64 ? 62 : 50, 2);
+  if (shoff == 0 || shentsize != (m_Is64 ? 64 : 40) ||
+      shoff > pFile.size() || pFile.size() - shoff < shentsize)
+    return false;
+
+  // the extended section numbering
+  Section first;
+  if (!readSection(shoff, first))
+    return false;
+  if (shnum == 0)
+    shnum = first.size;
+  if (shstrndx == llvm::ELF::SHN_XINDEX)
+    shstrndx = first.link;
+  if (shnum > (pFile.size() - shoff) / shentsize || shstrndx >= shnum)
+    return false;
+
+  m_Sections.resize(shnum);
+  for (uint64_t i = 0; i < shnum; ++i) {
+    if (!readSection(shoff + i * shentsize, m_Sections[i]))
+      return false;
+  }
+
+  llvm::StringRef strtab = content(shstrndx);
+  for (uint64_t i = 0; i < shnum; ++i) {
+    uint32_t name = read(shoff + i * shentsize, 4);
+    if (name >= strtab.size())
+      return false;
+    llvm::StringRef str = strtab.substr(name);
+    m_Sections[i].name = str.substr(0, str.find('\0'));
+  }
+  return true;
+}
+
+llvm::StringRef ELFImage::content(unsigned pIdx) const {
+  const Section& sect = m_Sections[pIdx];
+  if (sect.type == llvm::ELF::SHT_NOBITS)
+    return llvm::StringRef();
+  return m_File.substr(sect.offset, sect.size);
+}
+
+bool ELFImage::isPatchable(unsigned pIdx) const {
+  const Section& sect = m_Sections[pIdx];
+  if (sect.type != llvm::ELF::SHT_PROGBITS || sect.size == 0 ||
+      (sect.flags & llvm::ELF::SHF_MERGE) != 0)
+    return false;
+
+  // classify the section as the readers do
+  std::string name = sect.name.str();
+  LDFileFormat::Kind kind = GetELFSectionKind(sect.type, name.c_str(),
+                                              sect.flags);
+  return isKeptAsIs(kind);
+}
+
+uint64_t ELFImage::hash(const std::vector<bool>& pPatchable) const {
+  uint64_t hash = hashBytes(m_File.substr(0, m_HeaderSize));
+  for (unsigned i = 0; i < m_Sections.size(); ++i) {
+    // the offset of a section does not change the output
+    const Section& sect = m_Sections[i];
+    uint64_t fields[] = {sect.type, sect.flags, sect.addr, sect.size,
+                         sect.link, sect.info, sect.align, sect.entsize};
+    hash = xxHash64(
+        reinterpret_cast<const uint8_t*>(fields), sizeof(fields), hash);
+    hash = hashBytes(sect.name, hash);
+    if (!pPatchable[i])
+      hash = hashBytes(content(i), hash);
+  }
+  return hash;
+}
+
+/// Candidate - a patchable section of an input object
+struct Candidate {
+  const char* start;
+  size_t file;
+  unsigned index;
+  const RegionFragment* frag;
+  bool bad;
+
+  bool operator<(const Candidate& pOther) const {
+    return start < pOther.start;
+  }
+};
+
+/// getFixups - get the bytes of a section that the link may rewrite, i.e.,
+/// the fields of its relocations pFields and the bytes that differ from the
+/// input, e.g., the instructions rewritten by a relaxation.
+void getFixups(llvm::StringRef pInput,
+               const uint8_t* pOutput,
+               const LinkState::RangeList& pFields,
+               LinkState::RangeList& pFixups) {
+  LinkState::RangeList ranges(pFields);
+  uint64_t size = pInput.size();
+  const uint8_t* input = reinterpret_cast<const uint8_t*>(pInput.data());
+  for (uint64_t i = 0; i < size; ++i) {
+    if (input[i] == pOutput[i])
+      continue;
+    LinkState::Range range;
+    range.offset = i;
+    while (i < size && input[i] != pOutput[i])
+      ++i;
+    range.size = i - range.offset;
+    ranges.push_back(range);
+  }
+
+  std::sort(ranges.begin(), ranges.end(),
+            [](const LinkState::Range& pA, const LinkState::Range& pB) {
+              return pA.offset < pB.offset;
+            });
+
+  // merge the overlapping ranges
+  pFixups.clear();
+  LinkState::RangeList::iterator range, rEnd = ranges.end();
+  for (range = ranges.begin(); range != rEnd; ++range) {
+    if (range->offset >= size)
+      continue;
+    uint64_t end = std::min(size, range->offset + range->size);
+    if (!pFixups.empty() &&
+        range->offset <= pFixups.back().offset + pFixups.back().size) {
+      LinkState::Range& last = pFixups.back();
+      last.size = std::max(last.offset + last.size, end) - last.offset;
+      continue;
+    }
+    LinkState::Range fixup = {range->offset, end - range->offset};
+    pFixups.push_back(fixup);
+  }
+}
+
+/// getRelocFields - get the fields that the relocations of the section pIdx
+/// of pInput write. Return false if a relocation does not refer to pFrag, the
+/// fragment of the section.
+bool getRelocFields(const Input& pInput,
+                    unsigned pIdx,
+                    const Fragment& pFrag,
+                    const Relocator& pRelocator,
+                    LinkState::RangeList& pFields) {
+  const LDContext* context = pInput.context();
+  const LDSection* target = context->getSection(pIdx);
+  LDContext::const_sect_iterator rs, rsEnd = context->relocSectEnd();
+  for (rs = context->relocSectBegin(); rs != rsEnd; ++rs) {
+    if ((*rs)->getLink() != target || !(*rs)->hasRelocData())
+      continue;
+
+    const RelocData* data = (*rs)->getRelocData();
+    if (data->hasPacked()) {
+      // the bound relocations know their places
+      if (!data->isBound())
+        return false;
+      for (size_t i = 0, e = data->numOfPacked(); i != e; ++i) {
+        if (data->getFrag(i) != &pFrag)
+          return false;
+        LinkState::Range field;
+        field.offset = data->getOffset(i);
+        field.size = (pRelocator.getSize(data->getType(i)) + 7) / 8;
+        pFields.push_back(field);
+      }
+      continue;
+    }
+
+    RelocData::const_iterator reloc, rEnd = data->end();
+    for (reloc = data->begin(); reloc != rEnd; ++reloc) {
+      if (reloc->targetRef().frag() != &pFrag)
+        return false;
+      LinkState::Range field;
+      field.offset = reloc->targetRef().offset();
+      field.size = (pRelocator.getSize(reloc->type()) + 7) / 8;
+      pFields.push_back(field);
+    }
+  }
+  return true;
+}
+
+}  // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// LinkState
+//===----------------------------------------------------------------------===//
+LinkState::LinkState() : m_Key(0) {
+  m_Output.size = 0;
+  m_Output.mtime = 0;
+  m_Output.inode = 0;
+  m_Output.ctime = 0;
+}
+
+std::string LinkState::Path(llvm::StringRef pOutput) {
+  return pOutput.str() + ".mcld-state";
+}
+
+bool LinkState::IsSupported(const LinkerConfig& pConfig) {
+  const GeneralOptions& options = pConfig.options();
+  return pConfig.codeGenType() != LinkerConfig::Binary &&
+         !options.hasBuildID() &&
+         options.getICFMode() == GeneralOptions::ICF::None;
+}
+
+void LinkState::Remove(llvm::StringRef pOutput) {
+  llvm::sys::fs::remove(Path(pOutput));
+}
+
+bool LinkState::Patch(const LinkerConfig& pConfig, llvm::StringRef pOutput) {
+  if (!IsSupported(pConfig))
+    return false;
+
+  LinkState state;
+  if (!state.read(Path(pOutput)))
+    return false;
+  return state.patch(pConfig, pOutput);
+}
+
+bool LinkState::record(const Module& pModule,
+                       const LinkerConfig& pConfig,
+                       const Relocator& pRelocator,
+                       FileOutputBuffer& pOutput) {
+  m_Key = getKey(pConfig);
+  m_Files.clear();
+
+  // -----  record the input files  ----- //
+  std::map<std::string, size_t> paths;
+  std::vector<const Input*> inputs;
+  std::vector<ELFImage> images;
+  std::vector<Candidate> candidates;
+  InputTree::const_dfs_iterator input,
+      inEnd = pModule.getInputTree().dfs_end();
+  for (input = pModule.getInputTree().dfs_begin(); input != inEnd; ++input) {
+    // an archive member is a part of the archive, which is recorded
+    if (isGroup(input) || !(*input)->hasMemArea() ||
+        (*input)->fileOffset() != 0)
+      continue;
+
+    const std::string& path = (*input)->path().native();
+    std::map<std::string, size_t>::iterator seen = paths.find(path);
+    if (seen != paths.end()) {
+      // an object linked twice is not patched
+      m_Files[seen->second].isObject = false;
+      continue;
+    }
+    paths[path] = m_Files.size();
+
+    File file;
+    file.path = path;
+    if (!getStamp(path, file.stamp))
+      return false;
+    MemoryArea* area = const_cast<Input*>(*input)->memArea();
+    llvm::StringRef content = area->request(0, area->size());
+    file.hash = hashBytes(content);
+    file.isObject = false;
+    file.structHash = 0;
+
+    inputs.push_back(*input);
+    images.push_back(ELFImage());
+    const LDContext* context = (*input)->context();
+    if ((*input)->type() == Input::Object && context != NULL &&
+        images.back().parse(content) &&
+        images.back().size() == context->numOfSections()) {
+      file.isObject = true;
+      for (unsigned i = 0; i < images.back().size(); ++i) {
+        if (!images.back().isPatchable(i) ||
+            !isKeptAsIs(context->getSection(i)->kind()))
+          continue;
+        const char* start = content.data() + images.back().section(i).offset;
+        Candidate candidate = {start, m_Files.size(), i, NULL, false};
+        candidates.push_back(candidate);
+      }
+    }
+    m_Files.push_back(file);
+  }
+
+  // -----  find the patchable sections in the output  ----- //
+  // An input section is copied as one region fragment that refers to the
+  // input file. A section split into fragments is not patchable.
+  std::sort(candidates.begin(), candidates.end());
+  Module::const_iterator sect, sectEnd = pModule.end();
+  for (sect = pModule.begin(); sect != sectEnd; ++sect) {
+    if (!(*sect)->hasSectionData())
+      continue;
+    const SectionData* data = (*sect)->getSectionData();
+    SectionData::const_iterator frag, fragEnd = data->end();
+    for (frag = data->begin(); frag != fragEnd; ++frag) {
+      if (frag->getKind() != Fragment::Region)
+        continue;
+      const RegionFragment& region = llvm::cast<RegionFragment>(*frag);
+      Candidate key = {region.getRegion().data(), 0, 0, NULL, false};
+      std::vector<Candidate>::iterator cand =
+          std::upper_bound(candidates.begin(), candidates.end(), key);
+      if (cand == candidates.begin())
+        continue;
+      --cand;
+      const ELFImage::Section& header =
+          images[cand->file].section(cand->index);
+      if (key.start >= cand->start + header.size)
+        continue;
+      if (key.start == cand->start && region.size() == header.size &&
+          cand->frag == NULL)
+        cand->frag = &region;
+      else
+        cand->bad = true;
+    }
+  }
+
+  // -----  record the placements  ----- //
+  std::vector<std::vector<bool> > patchable(m_Files.size());
+  for (size_t i = 0; i < m_Files.size(); ++i)
+    patchable[i].resize(images[i].size(), false);
+
+  std::vector<Candidate>::iterator cand, cEnd = candidates.end();
+  for (cand = candidates.begin(); cand != cEnd; ++cand) {
+    File& file = m_Files[cand->file];
+    if (!file.isObject || cand->bad)
+      continue;
+
+    const ELFImage& image = images[cand->file];
+    Placement placement;
+    placement.index = cand->index;
+    placement.placed = false;
+    placement.offset = 0;
+    placement.fixupHash = 0;
+    if (cand->frag != NULL) {
+      const LDSection& out = cand->frag->getParent()->getSection();
+      if (out.type() != llvm::ELF::SHT_NOBITS) {
+        placement.placed = true;
+        placement.offset = out.offset() + cand->frag->getOffset();
+        llvm::StringRef content = image.content(cand->index);
+        if (placement.offset > pOutput.getBufferSize() ||
+            content.size() > pOutput.getBufferSize() - placement.offset)
+          continue;
+
+        RangeList fields;
+        if (!getRelocFields(*inputs[cand->file], cand->index, *cand->frag,
+                            pRelocator, fields))
+          continue;
+        getFixups(content,
+                  pOutput.getBufferStart() + placement.offset,
+                  fields,
+                  placement.fixups);
+        placement.fixupHash = hashFixups(content, placement.fixups);
+      }
+    }
+    patchable[cand->file][cand->index] = true;
+    file.sections.push_back(placement);
+  }
+
+  for (size_t i = 0; i < m_Files.size(); ++i) {
+    if (m_Files[i].isObject)
+      m_Files[i].structHash = images[i].hash(patchable[i]);
+    else
+      m_Files[i].sections.clear();
+  }
+  return true;
+}
+
+bool LinkState::write(llvm::StringRef pOutput) {
+  if (!getStamp(pOutput, m_Output))
+    return false;
+
+  std::string text;
+  llvm::raw_string_ostream os(text);
+  os << kStateMagic << "\n";
+  os << "key " << m_Key << "\n";
+  os << "output " << m_Output.size << " " << m_Output.mtime << " "
+     << m_Output.inode << " " << m_Output.ctime << "\n";
+  FileList::const_iterator file, fEnd = m_Files.end();
+  for (file = m_Files.begin(); file != fEnd; ++file) {
+    os << "file " << file->stamp.size << " " << file->stamp.mtime << " "
+       << file->stamp.inode << " " << file->stamp.ctime << " " << file->hash
+       << " " << file->path << "\n";
+    if (!file->isObject)
+      continue;
+    os << "object " << file->structHash << "\n";
+    PlacementList::const_iterator sect, sEnd = file->sections.end();
+    for (sect = file->sections.begin(); sect != sEnd; ++sect) {
+      if (!sect->placed) {
+        os << "dropped " << sect->index << "\n";
+        continue;
+      }
+      os << "section " << sect->index << " " << sect->offset << " "
+         << sect->fixupHash << " " << sect->fixups.size();
+      RangeList::const_iterator range, rEnd = sect->fixups.end();
+      for (range = sect->fixups.begin(); range != rEnd; ++range)
+        os << " " << range->offset << " " << range->size;
+      os << "\n";
+    }
+  }
+  os.flush();
+
+  // write a new file and then replace the old one, so that a link that is
+  // interrupted leaves no state of a different output
+  std::string path = Path(pOutput);
+  std::string temp = path + ".tmp";
+  FileHandle handle;
+  FileHandle::OpenMode open_mode(
+      FileHandle::ReadWrite | FileHandle::Truncate | FileHandle::Create);
+  if (!handle.open(sys::fs::Path(temp),
+                   open_mode,
+                   FileHandle::Permission(0x644)))
+    return false;
+  bool result = handle.write(text.data(), 0, text.size());
+  handle.close();
+
+  if (!result || llvm::sys::fs::rename(temp, path)) {
+    llvm::sys::fs::remove(temp);
+    return false;
+  }
+  return true;
+}
+
+bool LinkState::read(const std::string& pPath) {
+  llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer> > buffer =
+      llvm::MemoryBuffer::getFile(pPath, -1, false);
+  if (!buffer)
+    return false;
+
+  llvm::SmallVector<llvm::StringRef, 64> lines;
+  buffer.get()->getBuffer().split(lines, "\n", -1, false);
+  if (lines.size() < 3 || lines[0] != kStateMagic)
+    return false;
+
+  m_Files.clear();
+  for (size_t i = 1; i < lines.size(); ++i) {
+    std::pair<llvm::StringRef, llvm::StringRef> line = lines[i].split(' ');
+    llvm::StringRef tag = line.first;
+    llvm::StringRef rest = line.second;
+
+    // readNumber - read the next number of the line
+    bool error = false;
+    auto readNumber = [&rest, &error]() {
+      std::pair<llvm::StringRef, llvm::StringRef> token = rest.split(' ');
+      rest = token.second;
+      uint64_t value = 0;
+      if (token.first.getAsInteger(10, value))
+        error = true;
+      return value;
+    };
+
+    if (tag == "key") {
+      m_Key = readNumber();
+    } else if (tag == "output") {
+      m_Output.size = readNumber();
+      m_Output.mtime = readNumber();
+      m_Output.inode = readNumber();
+      m_Output.ctime = readNumber();
+    } else if (tag == "file") {
+      File file;
+      file.stamp.size = readNumber();
+      file.stamp.mtime = readNumber();
+      file.stamp.inode = readNumber();
+      file.stamp.ctime = readNumber();
+      file.hash = readNumber();
+      file.path = rest.str();
+      file.isObject = false;
+      file.structHash = 0;
+      m_Files.push_back(file);
+    } else if (tag == "object" && !m_Files.empty()) {
+      m_Files.back().isObject = true;
+      m_Files.back().structHash = readNumber();
+    } else if ((tag == "section" || tag == "dropped") && !m_Files.empty() &&
+               m_Files.back().isObject) {
+      Placement placement;
+      placement.index = readNumber();
+      placement.placed = (tag == "section");
+      placement.offset = 0;
+      placement.fixupHash = 0;
+      if (placement.placed) {
+        placement.offset = readNumber();
+        placement.fixupHash = readNumber();
+        uint64_t num = readNumber();
+        for (uint64_t j = 0; j < num && !error; ++j) {
+          Range range;
+          range.offset = readNumber();
+          range.size = readNumber();
+          placement.fixups.push_back(range);
+        }
+      }
+      m_Files.back().sections.push_back(placement);
+    } else {
+      return false;
+    }
+
+    if (error)
+      return false;
+  }
+  return true;
+}
+
+bool LinkState::patch(const LinkerConfig& pConfig, llvm::StringRef pOutput) {
+  if (m_Key != getKey(pConfig)) {
+    debug(diag::debug_patch_relink) << pOutput
+                                          << "the command line has changed";
+    return false;
+  }
+
+  Stamp stamp;
+  if (!getStamp(pOutput, stamp) || !(stamp == m_Output)) {
+    debug(diag::debug_patch_relink) << pOutput
+                                          << "the output has changed";
+    return false;
+  }
+
+  // -----  find the changes of the inputs  ----- //
+  typedef std::pair<File*, std::unique_ptr<llvm::MemoryBuffer> > Change;
+  std::vector<Change> changes;
+  FileList::iterator file, fEnd = m_Files.end();
+  for (file = m_Files.begin(); file != fEnd; ++file) {
+    if (!getStamp(file->path, stamp)) {
+      debug(diag::debug_patch_relink) << pOutput
+                                            << file->path + " is missing";
+      return false;
+    }
+    if (stamp == file->stamp)
+      continue;
+
+    llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer> > buffer =
+        llvm::MemoryBuffer::getFile(file->path, -1, false);
+    if (!buffer)
+      return false;
+    file->stamp = stamp;
+    uint64_t hash = hashBytes(buffer.get()->getBuffer());
+    if (hash == file->hash)
+      continue;
+
+    // the object must link to the same output but its patchable sections
+    ELFImage image;
+    bool patchable = file->isObject && image.parse(buffer.get()->getBuffer());
+    std::vector<bool> mask(image.size(), false);
+    PlacementList::iterator sect, sEnd = file->sections.end();
+    for (sect = file->sections.begin(); patchable && sect != sEnd; ++sect) {
+      if (sect->index >= image.size() || !image.isPatchable(sect->index))
+        patchable = false;
+      else
+        mask[sect->index] = true;
+    }
+    if (patchable)
+      patchable = (image.hash(mask) == file->structHash);
+    for (sect = file->sections.begin(); patchable && sect != sEnd; ++sect) {
+      if (sect->placed &&
+          hashFixups(image.content(sect->index), sect->fixups) !=
+              sect->fixupHash)
+        patchable = false;
+    }
+    if (!patchable) {
+      debug(diag::debug_patch_relink)
+          << pOutput << file->path + " cannot be patched";
+      return false;
+    }
+
+    file->hash = hash;
+    changes.push_back(Change(&*file, std::move(buffer.get())));
+  }
+
+  // -----  patch the output  ----- //
+  // A copy of the output is patched and then replaces it, so that neither a
+  // program running from the output nor the output itself is destroyed by a
+  // patch that fails.
+  FileHandle output;
+  std::string temp;
+  if (!copyOutput(pOutput, output, temp))
+    return false;
+
+  bool result = true;
+  size_t num_sections = 0;
+  std::vector<Change>::iterator change, cEnd = changes.end();
+  for (change = changes.begin(); result && change != cEnd; ++change) {
+    ELFImage image;
+    image.parse(change->second->getBuffer());
+    PlacementList& sections = change->first->sections;
+    PlacementList::iterator sect, sEnd = sections.end();
+    for (sect = sections.begin(); result && sect != sEnd; ++sect) {
+      if (!sect->placed)
+        continue;
+
+      // write the bytes between the fixup ranges
+      llvm::StringRef content = image.content(sect->index);
+      uint64_t pos = 0;
+      RangeList::iterator range, rEnd = sect->fixups.end();
+      for (range = sect->fixups.begin(); result && range != rEnd; ++range) {
+        if (range->offset > pos)
+          result = output.write(content.data() + pos,
+                                sect->offset + pos,
+                                range->offset - pos);
+        pos = std::max(pos, range->offset + range->size);
+      }
+      if (result && pos < content.size())
+        result = output.write(content.data() + pos,
+                              sect->offset + pos,
+                              content.size() - pos);
+      ++num_sections;
+    }
+  }
+  output.close();
+
+  // the caller links in full if the output cannot be patched
+  if (!result || llvm::sys::fs::rename(temp, pOutput)) {
+    llvm::sys::fs::remove(temp);
+    return false;
+  }
+
+  debug(diag::debug_patch_applied) << num_sections << changes.size();
+  if (!write(pOutput))
+    Remove(pOutput);
+  return true;
+}
+
+}  // namespace mcld
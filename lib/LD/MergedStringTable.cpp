@@ -7,36 +7,129 @@
 //
 //===----------------------------------------------------------------------===//
 #include "mcld/LD/MergedStringTable.h"
+#include "mcld/Support/Parallel.h"
+#include "mcld/Support/XXHash.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
 
 namespace mcld {
 
-bool MergedStringTable::insertString(llvm::StringRef pString) {
-  return m_StringMap.insert(std::make_pair(pString, 0)).second;
+//===----------------------------------------------------------------------===//
+// MergedStringTable::Input
+//===----------------------------------------------------------------------===//
+llvm::StringRef MergedStringTable::Input::getString(size_t pIdx) const {
+  uint64_t begin = offsets[pIdx];
+  uint64_t end;
+  if (pIdx + 1 < offsets.size())
+    end = offsets[pIdx + 1] - 1;
+  else if (strings.back() == '\0')
+    end = strings.size() - 1;
+  else
+    end = strings.size();  // the last string is not terminated
+  return strings.substr(begin, end - begin);
 }
 
-uint64_t MergedStringTable::finalizeOffset() {
-  // trverse the string table and set the offset
-  string_map_iterator it, end = m_StringMap.end();
-  size_t offset = 0;
-  for (it = m_StringMap.begin(); it != end; ++it) {
-    it->setValue(offset);
-    offset += it->getKey().size() + 1;
+//===----------------------------------------------------------------------===//
+// MergedStringTable
+//===----------------------------------------------------------------------===//
+size_t MergedStringTable::addStrings(llvm::StringRef pStrings) {
+  m_Inputs.push_back(Input());
+  m_Inputs.back().strings = pStrings;
+  return m_Inputs.size() - 1;
+}
+
+void MergedStringTable::split(Input& pInput) {
+  llvm::StringRef strings = pInput.strings;
+  for (size_t offset = 0; offset < strings.size();) {
+    size_t end = strings.find('\0', offset);
+    if (end == llvm::StringRef::npos)
+      end = strings.size();
+    pInput.offsets.push_back(offset);
+    offset = end + 1;
+  }
+
+  size_t num = pInput.offsets.size();
+  pInput.hashes.resize(num);
+  pInput.outOffsets.resize(num);
+  pInput.shardStrings.resize(NumShards);
+  for (size_t i = 0; i < num; ++i) {
+    llvm::StringRef str = pInput.getString(i);
+    pInput.hashes[i] =
+        xxHash64(reinterpret_cast<const uint8_t*>(str.data()), str.size());
+    pInput.shardStrings[pInput.hashes[i] % NumShards].push_back(i);
   }
-  return offset;
 }
 
-void MergedStringTable::emit(MemoryRegion& pRegion) {
-  char* ptr = reinterpret_cast<char*>(pRegion.begin());
-  string_map_iterator it, end = m_StringMap.end();
-  for (it = m_StringMap.begin(); it != end; ++it) {
-    ::memcpy(ptr, it->getKey().data(), it->getKey().size());
-    ptr += it->getKey().size() + 1;
+void MergedStringTable::insert(size_t pShard) {
+  Shard& shard = m_Shards[pShard];
+  for (Input& input : m_Inputs) {
+    for (uint32_t idx : input.shardStrings[pShard]) {
+      Key key = { input.getString(idx), input.hashes[idx] };
+      auto result = shard.map.insert(std::make_pair(key, shard.size));
+      if (result.second) {
+        shard.strings.push_back(key.str);
+        shard.size += key.str.size() + 1;
+      }
+      input.outOffsets[idx] = result.first->second;
+    }
   }
 }
 
-size_t MergedStringTable::getOutputOffset(llvm::StringRef pStr) {
-  assert(m_StringMap.find(pStr) != m_StringMap.end());
-  return m_StringMap[pStr];
+uint64_t MergedStringTable::finalizeOffset(unsigned pThreads) {
+  // split and hash the strings of each input
+  parallelForEach(pThreads, m_Inputs.begin(), m_Inputs.end(), split);
+
+  // remove the duplicates in each shard and set the offsets in the shard
+  m_Shards.assign(NumShards, Shard());
+  parallelFor(pThreads, 0, NumShards, [this](size_t pShard) {
+    insert(pShard);
+  });
+
+  // lay the shards out one after another
+  m_Size = 0;
+  for (Shard& shard : m_Shards) {
+    shard.base = m_Size;
+    m_Size += shard.size;
+    shard.map.clear();
+  }
+
+  // turn the offsets in the shards into the output offsets
+  parallelForEach(pThreads, m_Inputs.begin(), m_Inputs.end(),
+                  [this](Input& pInput) {
+    for (size_t i = 0, e = pInput.offsets.size(); i != e; ++i)
+      pInput.outOffsets[i] += m_Shards[pInput.hashes[i] % NumShards].base;
+    std::vector<uint64_t>().swap(pInput.hashes);
+    std::vector<std::vector<uint32_t> >().swap(pInput.shardStrings);
+  });
+  return m_Size;
+}
+
+void MergedStringTable::emit(MemoryRegion& pRegion, unsigned pThreads) const {
+  assert(pRegion.size() >= m_Size);
+  char* begin = reinterpret_cast<char*>(pRegion.begin());
+  parallelForEach(pThreads, m_Shards.begin(), m_Shards.end(),
+                  [begin](const Shard& pShard) {
+    char* ptr = begin + pShard.base;
+    for (const llvm::StringRef& str : pShard.strings) {
+      ::memcpy(ptr, str.data(), str.size());
+      ptr[str.size()] = '\0';
+      ptr += str.size() + 1;
+    }
+  });
+}
+
+uint64_t MergedStringTable::getOutputOffset(size_t pInput,
+                                            uint64_t pOffset) const {
+  assert(pInput < m_Inputs.size());
+  const Input& input = m_Inputs[pInput];
+  // find the string that contains pOffset
+  std::vector<uint64_t>::const_iterator it =
+      std::upper_bound(input.offsets.begin(), input.offsets.end(), pOffset);
+  assert(it != input.offsets.begin());
+  size_t idx = (it - input.offsets.begin()) - 1;
+  return input.outOffsets[idx] + (pOffset - input.offsets[idx]);
 }
 
 }  // namespace mcld
@@ -63,15 +63,44 @@ void NamePool::insertSymbol(const llvm::StringRef& pName,
                             ResolveInfo::Visibility pVisibility,
                             ResolveInfo* pOldInfo,
                             Resolver::Result& pResult) {
+  insertSymbol(pName,
+               Hash(pName),
+               pIsDyn,
+               pType,
+               pDesc,
+               pBinding,
+               pSize,
+               pValue,
+               pVisibility,
+               pOldInfo,
+               pResult);
+}
+
+void NamePool::insertSymbol(const llvm::StringRef& pName,
+                            uint32_t pHash,
+                            bool pIsDyn,
+                            ResolveInfo::Type pType,
+                            ResolveInfo::Desc pDesc,
+                            ResolveInfo::Binding pBinding,
+                            ResolveInfo::SizeType pSize,
+                            LDSymbol::ValueType pValue,
+                            ResolveInfo::Visibility pVisibility,
+                            ResolveInfo* pOldInfo,
+                            Resolver::Result& pResult) {
   // We should check if there is any symbol with the same name existed.
   // If it already exists, we should use resolver to decide which symbol
   // should be reserved. Otherwise, we insert the symbol and set up its
   // attributes.
   bool exist = false;
-  ResolveInfo* old_symbol = m_Table.insert(pName, exist);
+  ResolveInfo* old_symbol = m_Table.insert(pName, pHash, exist);
+
+  // The attributes of a symbol that meets an existing one only live through
+  // the resolution. They are kept in a nameless ResolveInfo on the stack;
+  // the resolver takes the name from the existing symbol.
+  ResolveInfo pending;
   ResolveInfo* new_symbol = NULL;
   if (exist && old_symbol->isSymbol()) {
-    new_symbol = m_Table.getEntryFactory().produce(pName);
+    new_symbol = &pending;
   } else {
     exist = false;
     new_symbol = old_symbol;
@@ -87,6 +116,8 @@ void NamePool::insertSymbol(const llvm::StringRef& pName,
 
   if (!exist) {
     // old_symbol is neither existed nor a symbol.
+    if (new_symbol->isUndef() && !new_symbol->isWeak())
+      m_UndefList.push_back(new_symbol);
     pResult.info = new_symbol;
     pResult.existent = false;
     pResult.overriden = true;
@@ -98,6 +129,7 @@ void NamePool::insertSymbol(const llvm::StringRef& pName,
 
   // exist and is a symbol
   // symbol resolution
+  bool was_undef = old_symbol->isUndef() && !old_symbol->isWeak();
   bool override = false;
   unsigned int action = Resolver::LastAction;
   if (m_pResolver->resolve(*old_symbol, *new_symbol, override, pValue)) {
@@ -108,7 +140,9 @@ void NamePool::insertSymbol(const llvm::StringRef& pName,
     m_pResolver->resolveAgain(*this, action, *old_symbol, *new_symbol, pResult);
   }
 
-  m_Table.getEntryFactory().destroy(new_symbol);
+  // a weak undefined reference becomes strong
+  if (!was_undef && pResult.info->isUndef() && !pResult.info->isWeak())
+    m_UndefList.push_back(pResult.info);
   return;
 }
 
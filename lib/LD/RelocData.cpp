@@ -8,15 +8,19 @@
 //===----------------------------------------------------------------------===//
 #include "mcld/LD/RelocData.h"
 
+#include "mcld/Fragment/FragmentRef.h"
+#include "mcld/LD/LDSection.h"
 #include "mcld/Support/GCFactory.h"
+#include "mcld/Support/LinkerContext.h"
+#include "mcld/Support/Parallel.h"
 
-#include <llvm/Support/ManagedStatic.h>
+#include <cassert>
 
 namespace mcld {
 
 typedef GCFactory<RelocData, MCLD_SECTIONS_PER_INPUT> RelocDataFactory;
 
-static llvm::ManagedStatic<RelocDataFactory> g_RelocDataFactory;
+static ContextStatic<RelocDataFactory> g_RelocDataFactory;
 
 //===----------------------------------------------------------------------===//
 // RelocData
@@ -44,14 +48,108 @@ void RelocData::Clear() {
 }
 
 RelocData& RelocData::append(Relocation& pRelocation) {
-  m_Relocations.push_back(&pRelocation);
+  getRelocationList().push_back(&pRelocation);
   return *this;
 }
 
 Relocation& RelocData::remove(Relocation& pRelocation) {
   iterator iter(pRelocation);
-  Relocation* rel = m_Relocations.remove(iter);
+  Relocation* rel = getRelocationList().remove(iter);
   return *rel;
 }
 
+void RelocData::reserve(size_t pSize) {
+  m_Types.reserve(pSize);
+  m_SymInfos.reserve(pSize);
+  m_Offsets.reserve(pSize);
+  m_Addends.reserve(pSize);
+}
+
+void RelocData::addPacked(Relocation::Type pType,
+                          ResolveInfo* pSymInfo,
+                          uint32_t pOffset,
+                          Relocation::Address pAddend) {
+  m_Types.push_back(pType);
+  m_SymInfos.push_back(pSymInfo);
+  m_Offsets.push_back(pOffset);
+  m_Addends.push_back(pAddend);
+}
+
+void RelocData::materialize() {
+  assert(!ParallelWorkerScope::isActive() &&
+         "relocations are materialized in a parallel loop");
+  if (!hasPacked())
+    return;
+
+  assert(m_pSection != NULL && m_pSection->getLink() != NULL);
+  LDSection& target = *m_pSection->getLink();
+  for (size_t i = 0; i < m_Types.size(); ++i) {
+    Relocation* reloc = NULL;
+    if (!isBound()) {
+      reloc =
+          Relocation::Create(m_Types[i], target, m_Offsets[i], m_Addends[i]);
+    } else {
+      // the place has moved, so the bound target data is kept
+      if (m_Frags[i] == NULL) {
+        reloc = Relocation::Create(m_Types[i], *FragmentRef::Null(),
+                                   m_Addends[i]);
+      } else {
+        FragmentRef place(*m_Frags[i], m_Offsets[i]);
+        reloc = Relocation::Create(m_Types[i], place, m_Addends[i]);
+      }
+      reloc->target() = m_Targets[i];
+    }
+    reloc->setSymInfo(m_SymInfos[i]);
+    m_Relocations.push_back(reloc);
+  }
+
+  std::vector<Relocation::Type>().swap(m_Types);
+  std::vector<ResolveInfo*>().swap(m_SymInfos);
+  std::vector<uint32_t>().swap(m_Offsets);
+  std::vector<Relocation::Address>().swap(m_Addends);
+  std::vector<Fragment*>().swap(m_Frags);
+  std::vector<Relocation::DWord>().swap(m_Targets);
+}
+
+void RelocData::bind() {
+  assert(!ParallelWorkerScope::isActive() &&
+         "relocations are bound in a parallel loop");
+  if (!hasPacked() || isBound())
+    return;
+
+  assert(m_pSection != NULL && m_pSection->getLink() != NULL);
+  LDSection& target = *m_pSection->getLink();
+  m_Frags.resize(m_Types.size(), NULL);
+  m_Targets.resize(m_Types.size(), 0x0);
+  for (size_t i = 0; i < m_Types.size(); ++i) {
+    FragmentRef place;
+    if (!FragmentRef::Find(target, m_Offsets[i], place))
+      continue;
+    m_Frags[i] = place.frag();
+    m_Offsets[i] = place.offset();
+    m_Targets[i] = Relocation::ReadTarget(place);
+  }
+}
+
+void RelocData::load(size_t pIdx, Relocation& pReloc) const {
+  assert(isBound());
+  pReloc.setType(m_Types[pIdx]);
+  pReloc.setSymInfo(m_SymInfos[pIdx]);
+  pReloc.setAddend(m_Addends[pIdx]);
+  if (m_Frags[pIdx] != NULL)
+    pReloc.targetRef().assign(*m_Frags[pIdx], m_Offsets[pIdx]);
+  else
+    pReloc.targetRef().assign(*FragmentRef::Null());
+  pReloc.target() = m_Targets[pIdx];
+}
+
+void RelocData::store(size_t pIdx, const Relocation& pReloc) {
+  assert(isBound());
+  assert(pReloc.type() == m_Types[pIdx] &&
+         pReloc.symInfo() == m_SymInfos[pIdx] &&
+         pReloc.addend() == m_Addends[pIdx] &&
+         "a bound relocation is changed");
+  m_Targets[pIdx] = pReloc.target();
+}
+
 }  // namespace mcld
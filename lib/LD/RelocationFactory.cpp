@@ -41,6 +41,20 @@ Relocation* RelocationFactory::produce(RelocationFactory::Type pType,
   // target_data is the place where the relocation applys to.
   // Use TargetDataFactory to generate temporary data, and copy the
   // content of the fragment into this data.
+  DWord target_data = readTarget(pFragRef);
+
+  Relocation* result = allocate();
+  new (result) Relocation(pType, &pFragRef, pAddend, target_data);
+  return result;
+}
+
+RelocationFactory::DWord RelocationFactory::readTarget(
+    const FragmentRef& pFragRef) const {
+  if (m_pConfig == NULL) {
+    fatal(diag::reloc_factory_has_not_config);
+    return 0;
+  }
+
   DWord target_data = 0;
 
   // byte swapping if the host and target have different endian
@@ -62,16 +76,13 @@ Relocation* RelocationFactory::produce(RelocationFactory::Type pType,
       default: {
         fatal(diag::unsupported_bitclass) << m_pConfig->targets().triple().str()
                                           << m_pConfig->targets().bitclass();
-        return NULL;
+        return 0;
       }
     }  // end of switch
   } else {
     pFragRef.memcpy(&target_data, (m_pConfig->targets().bitclass() / 8));
   }
-
-  Relocation* result = allocate();
-  new (result) Relocation(pType, &pFragRef, pAddend, target_data);
-  return result;
+  return target_data;
 }
 
 Relocation* RelocationFactory::produceEmptyEntry() {
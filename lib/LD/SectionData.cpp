@@ -10,14 +10,25 @@
 
 #include "mcld/LD/LDSection.h"
 #include "mcld/Support/GCFactory.h"
+#include "mcld/Support/LinkerContext.h"
 
-#include <llvm/Support/ManagedStatic.h>
+#include <algorithm>
 
 namespace mcld {
 
 typedef GCFactory<SectionData, MCLD_SECTIONS_PER_INPUT> SectDataFactory;
 
-static llvm::ManagedStatic<SectDataFactory> g_SectDataFactory;
+static ContextStatic<SectDataFactory> g_SectDataFactory;
+
+namespace {
+
+/// isEndBefore - whether the fragment of pEntry ends before pOffset
+bool isEndBefore(const std::pair<uint64_t, Fragment*>& pEntry,
+                 uint64_t pOffset) {
+  return pEntry.first < pOffset;
+}
+
+}  // anonymous namespace
 
 //===----------------------------------------------------------------------===//
 // SectionData
@@ -44,4 +55,52 @@ void SectionData::Clear() {
   g_SectDataFactory->clear();
 }
 
+bool SectionData::findFragment(uint64_t pOffset,
+                               Fragment*& pFrag,
+                               uint64_t& pFragOffset) {
+  pFrag = NULL;
+  pFragOffset = 0;
+  if (m_OffsetIndex.empty() && !buildOffsetIndex())
+    return false;
+
+  // the first fragment that ends at or after pOffset
+  OffsetIndex::iterator it = std::lower_bound(
+      m_OffsetIndex.begin(), m_OffsetIndex.end(), pOffset, isEndBefore);
+  if (it == m_OffsetIndex.end())
+    return true;
+
+  uint64_t start = 0;
+  if (it != m_OffsetIndex.begin())
+    start = (it - 1)->first;
+
+  if (start != it->first && it->first == pOffset) {
+    // pOffset is at the end of a non-empty fragment
+    ++it;
+    if (it != m_OffsetIndex.end())
+      pFrag = it->second;
+    return true;
+  }
+  pFrag = it->second;
+  pFragOffset = pOffset - start;
+  return true;
+}
+
+bool SectionData::buildOffsetIndex() {
+  if (m_Fragments.empty())
+    return false;
+
+  uint64_t offset = 0;
+  for (iterator it = m_Fragments.begin(), ie = m_Fragments.end(); it != ie;
+       ++it) {
+    // the size of an alignment depends on its offset
+    if ((*it).getKind() == Fragment::Alignment && !(*it).hasOffset()) {
+      OffsetIndex().swap(m_OffsetIndex);
+      return false;
+    }
+    offset += (*it).size();
+    m_OffsetIndex.push_back(std::make_pair(offset, &*it));
+  }
+  return true;
+}
+
 }  // namespace mcld
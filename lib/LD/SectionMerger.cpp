@@ -0,0 +1,509 @@
+//===- SectionMerger.cpp --------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "mcld/LD/SectionMerger.h"
+
+#include "mcld/GeneralOptions.h"
+#include "mcld/LinkerConfig.h"
+#include "mcld/Module.h"
+#include "mcld/Fragment/FragmentRef.h"
+#include "mcld/Fragment/RegionFragment.h"
+#include "mcld/Fragment/Relocation.h"
+#include "mcld/LD/LDContext.h"
+#include "mcld/LD/LDSection.h"
+#include "mcld/LD/LDSymbol.h"
+#include "mcld/LD/RelocData.h"
+#include "mcld/LD/ResolveInfo.h"
+#include "mcld/LD/SectionData.h"
+#include "mcld/Support/Parallel.h"
+#include "mcld/Support/XXHash.h"
+
+#include <llvm/Support/Casting.h>
+#include <llvm/Support/ELF.h>
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <set>
+#include <tuple>
+
+namespace mcld {
+
+//===----------------------------------------------------------------------===//
+// Helper Functions
+//===----------------------------------------------------------------------===//
+namespace {
+
+/// the number of shards the pieces are deduplicated in with --threads
+const size_t NumShards = 32;
+
+/// PieceKey - the key of a piece in the dedup maps. Only the pieces of the
+/// same group can be folded.
+struct PieceKey {
+  unsigned group;
+  uint64_t hash;
+  llvm::StringRef content;
+
+  bool operator==(const PieceKey& pOther) const {
+    return group == pOther.group && hash == pOther.hash &&
+           content == pOther.content;
+  }
+};
+
+struct PieceKeyHash {
+  size_t operator()(const PieceKey& pKey) const {
+    return static_cast<size_t>(pKey.hash ^ (uint64_t(pKey.group) << 32));
+  }
+};
+
+/// findTerminator - find the offset of the first null character of pEntSize
+/// bytes at or after pOffset
+size_t findTerminator(llvm::StringRef pData, size_t pOffset, size_t pEntSize) {
+  if (pEntSize == 1) {
+    const void* null = ::memchr(pData.data() + pOffset, 0,
+                                pData.size() - pOffset);
+    if (null == NULL)
+      return llvm::StringRef::npos;
+    return static_cast<const char*>(null) - pData.data();
+  }
+
+  for (size_t offset = pOffset; offset + pEntSize <= pData.size();
+       offset += pEntSize) {
+    const char* ch = pData.data() + offset;
+    if (std::all_of(ch, ch + pEntSize, [](char pChar) { return pChar == 0; }))
+      return offset;
+  }
+  return llvm::StringRef::npos;
+}
+
+/// isReversedLess - compare two strings from their ends
+bool isReversedLess(llvm::StringRef pA, llvm::StringRef pB) {
+  size_t size = std::min(pA.size(), pB.size());
+  for (size_t i = 1; i <= size; ++i) {
+    unsigned char a = pA[pA.size() - i];
+    unsigned char b = pB[pB.size() - i];
+    if (a != b)
+      return a < b;
+  }
+  return pA.size() < pB.size();
+}
+
+}  // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// SectionMerger
+//===----------------------------------------------------------------------===//
+SectionMerger::SectionMerger(const LinkerConfig& pConfig, Module& pModule)
+    : m_Config(pConfig), m_Module(pModule) {
+}
+
+SectionMerger::~SectionMerger() {
+  std::vector<MergeableSection*>::iterator sect, sectEnd = m_Sections.end();
+  for (sect = m_Sections.begin(); sect != sectEnd; ++sect) {
+    delete (*sect)->whole;
+    delete *sect;
+  }
+
+  std::vector<Fragment*>::iterator frag, fragEnd = m_Removed.end();
+  for (frag = m_Removed.begin(); frag != fragEnd; ++frag)
+    delete *frag;
+}
+
+bool SectionMerger::isMergeable(const LDSection& pSection) const {
+  switch (pSection.kind()) {
+    case LDFileFormat::TEXT:
+    case LDFileFormat::DATA:
+    case LDFileFormat::MetaData:
+      break;
+    default:
+      return false;
+  }
+
+  if ((pSection.flag() & llvm::ELF::SHF_MERGE) == 0 ||
+      pSection.entSize() == 0 || pSection.size() == 0)
+    return false;
+
+  // the pieces are laid out back to back, so they can only keep an alignment
+  // that is not larger than the entry size
+  if (pSection.align() > pSection.entSize())
+    return false;
+
+  // the region read from the input, followed by the null fragment
+  const SectionData* data = pSection.getSectionData();
+  if (data == NULL || data->empty() ||
+      data->front().getKind() != Fragment::Region ||
+      data->front().size() != pSection.size())
+    return false;
+  SectionData::const_iterator frag, fragEnd = data->end();
+  for (frag = ++data->begin(); frag != fragEnd; ++frag) {
+    if (frag->getKind() != Fragment::Null)
+      return false;
+  }
+  return true;
+}
+
+bool SectionMerger::splitSection(MergeableSection& pSection) const {
+  LDSection& section = *pSection.section;
+  SectionData& data = *section.getSectionData();
+  llvm::StringRef region = llvm::cast<RegionFragment>(data.front()).getRegion();
+  size_t entsize = section.entSize();
+
+  // find the pieces
+  std::vector<std::pair<size_t, size_t> > ranges;
+  if ((section.flag() & llvm::ELF::SHF_STRINGS) != 0) {
+    size_t offset = 0;
+    while (offset < region.size()) {
+      size_t null = findTerminator(region, offset, entsize);
+      if (null == llvm::StringRef::npos)
+        return false;  // the last string is not terminated
+      ranges.push_back(std::make_pair(offset, null + entsize - offset));
+      offset = null + entsize;
+    }
+  } else {
+    if ((region.size() % entsize) != 0)
+      return false;
+    for (size_t offset = 0; offset < region.size(); offset += entsize)
+      ranges.push_back(std::make_pair(offset, entsize));
+  }
+
+  // replace the fragment read from the input by the pieces, in front of the
+  // null fragment
+  SectionData::iterator null = ++data.begin();
+  pSection.whole = data.getFragmentList().remove(data.begin());
+  pSection.pieces.resize(ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    llvm::StringRef content = region.substr(ranges[i].first, ranges[i].second);
+    Piece& piece = pSection.pieces[i];
+    piece.frag = new RegionFragment(content);
+    piece.frag->setParent(&data);
+    data.getFragmentList().insert(null, piece.frag);
+    piece.frag->setOffset(ranges[i].first);
+    piece.offset = ranges[i].first;
+    piece.hash = xxHash64(reinterpret_cast<const uint8_t*>(content.data()),
+                          content.size());
+    piece.leader = &piece;
+    piece.leaderOffset = 0;
+  }
+  return true;
+}
+
+SectionMerger::Piece& SectionMerger::findPiece(MergeableSection& pSection,
+                                               int64_t pOffset) const {
+  std::vector<Piece>& pieces = pSection.pieces;
+  if (pOffset <= 0)
+    return pieces.front();
+
+  // the last piece whose offset is not larger than pOffset
+  size_t low = 0, high = pieces.size();
+  while (high - low > 1) {
+    size_t mid = low + (high - low) / 2;
+    if (pieces[mid].offset <= static_cast<uint64_t>(pOffset))
+      low = mid;
+    else
+      high = mid;
+  }
+  return pieces[low];
+}
+
+void SectionMerger::split() {
+  // find the mergeable sections. The sections with relocations are kept as
+  // they are, since their relocations refer to the input offsets.
+  Module::obj_iterator obj, objEnd = m_Module.obj_end();
+  for (obj = m_Module.obj_begin(); obj != objEnd; ++obj) {
+    LDContext* ctx = (*obj)->context();
+    std::set<const LDSection*> has_relocs;
+    LDContext::sect_iterator rs, rsEnd = ctx->relocSectEnd();
+    for (rs = ctx->relocSectBegin(); rs != rsEnd; ++rs) {
+      if ((*rs)->getLink() != NULL)
+        has_relocs.insert((*rs)->getLink());
+    }
+
+    LDContext::sect_iterator sect, sectEnd = ctx->sectEnd();
+    for (sect = ctx->sectBegin(); sect != sectEnd; ++sect) {
+      if (*sect == NULL || !isMergeable(**sect) || has_relocs.count(*sect))
+        continue;
+      MergeableSection* mergeable = new MergeableSection();
+      mergeable->section = *sect;
+      mergeable->whole = NULL;
+      mergeable->group = 0;
+      mergeable->pinned = false;
+      m_Sections.push_back(mergeable);
+    }
+  }
+
+  // split and hash the sections on the workers
+  std::vector<char> split_ok(m_Sections.size());
+  unsigned threads = m_Config.options().numThreads();
+  parallelFor(threads, 0, m_Sections.size(), [&](size_t pIdx) {
+    split_ok[pIdx] = splitSection(*m_Sections[pIdx]);
+  });
+
+  // drop the sections that are not well-formed; they are linked verbatim
+  size_t kept = 0;
+  for (size_t i = 0; i < m_Sections.size(); ++i) {
+    if (split_ok[i]) {
+      m_Sections[kept++] = m_Sections[i];
+      m_WholeMap[m_Sections[i]->whole] = m_Sections[i];
+    } else {
+      delete m_Sections[i];
+    }
+  }
+  m_Sections.resize(kept);
+
+  collectRelocations();
+}
+
+void SectionMerger::collectRelocations() {
+  if (m_Sections.empty())
+    return;
+
+  Module::obj_iterator obj, objEnd = m_Module.obj_end();
+  for (obj = m_Module.obj_begin(); obj != objEnd; ++obj) {
+    LDContext::sect_iterator rs, rsEnd = (*obj)->context()->relocSectEnd();
+    for (rs = (*obj)->context()->relocSectBegin(); rs != rsEnd; ++rs) {
+      if (LDFileFormat::Ignore == (*rs)->kind() || !(*rs)->hasRelocData())
+        continue;
+      // the relocations of the stripped and folded sections are not applied,
+      // and are left packed
+      LDFileFormat::Kind target_kind = (*rs)->getLink()->kind();
+      if (LDFileFormat::Ignore == target_kind ||
+          LDFileFormat::Folded == target_kind)
+        continue;
+      bool is_rela = (llvm::ELF::SHT_RELA == (*rs)->type());
+      RelocData* reloc_data = (*rs)->getRelocData();
+      if (reloc_data->hasPacked()) {
+        for (size_t i = 0, e = reloc_data->numOfPacked(); i != e; ++i) {
+          SectionSymbolReloc record = {NULL, reloc_data, i, NULL, 0};
+          collectRelocation(record, reloc_data->getSymInfo(i),
+                            reloc_data->getAddend(i), is_rela);
+        }
+        continue;
+      }
+      RelocData::iterator reloc, rEnd = reloc_data->end();
+      for (reloc = reloc_data->begin(); reloc != rEnd; ++reloc) {
+        Relocation* relocation = llvm::cast<Relocation>(reloc);
+        SectionSymbolReloc record = {relocation, NULL, 0, NULL, 0};
+        collectRelocation(record, relocation->symInfo(),
+                          relocation->addend(), is_rela);
+      }
+    }
+  }
+}
+
+void SectionMerger::collectRelocation(SectionSymbolReloc pRecord,
+                                      const ResolveInfo* pInfo,
+                                      int64_t pAddend,
+                                      bool pIsRela) {
+  if (pInfo == NULL || ResolveInfo::Section != pInfo->type() ||
+      pInfo->outSymbol() == NULL || !pInfo->outSymbol()->hasFragRef())
+    return;
+
+  const FragmentRef* ref = pInfo->outSymbol()->fragRef();
+  WholeMapTy::iterator entry = m_WholeMap.find(ref->frag());
+  if (entry == m_WholeMap.end())
+    return;
+
+  if (!pIsRela) {
+    // the implicit addend is encoded in the target place
+    entry->second->pinned = true;
+    return;
+  }
+
+  int64_t offset = ref->offset() + pAddend;
+  Piece& piece = findPiece(*entry->second, offset);
+  pRecord.piece = &piece;
+  pRecord.offset = offset - static_cast<int64_t>(piece.offset);
+  m_Relocs.push_back(pRecord);
+}
+
+void SectionMerger::merge() {
+  if (m_Sections.empty())
+    return;
+
+  // group the sections by output section and by the kind of their pieces
+  typedef std::tuple<const LDSection*, uint64_t, uint32_t, uint32_t> GroupKey;
+  std::map<GroupKey, unsigned> groups;
+  std::vector<MergeableSection*>::iterator sect, sectEnd = m_Sections.end();
+  for (sect = m_Sections.begin(); sect != sectEnd; ++sect) {
+    // the pieces of a discarded section stay in the input section
+    const LDSection& input = *(*sect)->section;
+    if (LDFileFormat::Ignore == input.kind())
+      (*sect)->pinned = true;
+    GroupKey key(&(*sect)->pieces.front().frag->getParent()->getSection(),
+                 input.entSize(),
+                 input.flag() & llvm::ELF::SHF_STRINGS,
+                 input.align());
+    (*sect)->group =
+        groups.insert(std::make_pair(key, groups.size())).first->second;
+  }
+
+  dedupe();
+  if (m_Config.options().tailMergeStrings())
+    tailMerge();
+  removeDuplicates();
+
+  // move the symbols defined in the mergeable sections to the kept pieces
+  Module::obj_iterator obj, objEnd = m_Module.obj_end();
+  for (obj = m_Module.obj_begin(); obj != objEnd; ++obj) {
+    LDContext::sym_iterator sym, symEnd = (*obj)->context()->symTabEnd();
+    for (sym = (*obj)->context()->symTabBegin(); sym != symEnd; ++sym) {
+      if (*sym == NULL)
+        continue;
+      moveSymbol(**sym);
+      ResolveInfo* info = (*sym)->resolveInfo();
+      if (info != NULL && info->outSymbol() != NULL)
+        moveSymbol(*info->outSymbol());
+    }
+  }
+}
+
+void SectionMerger::dedupe() {
+  // Each shard owns the pieces whose hash falls into it, and visits them in
+  // input order, so the first piece of each content is always the leader.
+  unsigned threads = m_Config.options().numThreads();
+  size_t num_shards = (threads > 1) ? NumShards : 1;
+  parallelFor(threads, 0, num_shards, [&](size_t pShard) {
+    std::unordered_map<PieceKey, Piece*, PieceKeyHash> leaders;
+    std::vector<MergeableSection*>::iterator sect, sectEnd = m_Sections.end();
+    for (sect = m_Sections.begin(); sect != sectEnd; ++sect) {
+      std::vector<Piece>::iterator piece, pEnd = (*sect)->pieces.end();
+      for (piece = (*sect)->pieces.begin(); piece != pEnd; ++piece) {
+        if ((piece->hash % num_shards) != pShard)
+          continue;
+        PieceKey key = {(*sect)->group, piece->hash, piece->frag->getRegion()};
+        std::pair<PieceKey, Piece*> entry(key, &*piece);
+        Piece* leader = leaders.insert(entry).first->second;
+        // the pieces of pinned sections stay where they are
+        if (!(*sect)->pinned)
+          piece->leader = leader;
+      }
+    }
+  });
+}
+
+void SectionMerger::tailMerge() {
+  // collect the kept strings of each group
+  typedef std::vector<Piece*> PieceList;
+  std::map<unsigned, PieceList> strings;
+  std::set<const Piece*> pinned;
+  std::vector<MergeableSection*>::iterator sect, sectEnd = m_Sections.end();
+  for (sect = m_Sections.begin(); sect != sectEnd; ++sect) {
+    if (((*sect)->section->flag() & llvm::ELF::SHF_STRINGS) == 0)
+      continue;
+    PieceList& list = strings[(*sect)->group];
+    std::vector<Piece>::iterator piece, pEnd = (*sect)->pieces.end();
+    for (piece = (*sect)->pieces.begin(); piece != pEnd; ++piece) {
+      if (piece->leader != &*piece)
+        continue;
+      list.push_back(&*piece);
+      if ((*sect)->pinned)
+        pinned.insert(&*piece);
+    }
+  }
+
+  std::vector<PieceList*> lists;
+  std::map<unsigned, PieceList>::iterator list, listEnd = strings.end();
+  for (list = strings.begin(); list != listEnd; ++list)
+    lists.push_back(&list->second);
+
+  // Sorted by their reversed contents, a string is a suffix of another
+  // string only if it is a suffix of the next one. Fold it into the string
+  // that the next one is folded into.
+  unsigned threads = m_Config.options().numThreads();
+  parallelForEach(threads, lists.begin(), lists.end(), [&](PieceList* pList) {
+    PieceList& pieces = *pList;
+    std::stable_sort(pieces.begin(), pieces.end(), [](Piece* pA, Piece* pB) {
+      return isReversedLess(pA->frag->getRegion(), pB->frag->getRegion());
+    });
+    for (size_t i = pieces.size() - 1; i-- > 0;) {
+      Piece& cur = *pieces[i];
+      Piece& next = *pieces[i + 1];
+      llvm::StringRef str = cur.frag->getRegion();
+      llvm::StringRef next_str = next.frag->getRegion();
+      if (pinned.count(&cur) || !next_str.endswith(str))
+        continue;
+      cur.leader = next.leader;
+      cur.leaderOffset = next.leaderOffset + (next_str.size() - str.size());
+    }
+  });
+
+  // the duplicates of the folded strings follow them
+  for (sect = m_Sections.begin(); sect != sectEnd; ++sect) {
+    std::vector<Piece>::iterator piece, pEnd = (*sect)->pieces.end();
+    for (piece = (*sect)->pieces.begin(); piece != pEnd; ++piece) {
+      Piece* leader = piece->leader;
+      if (leader != &*piece && leader->leader != leader) {
+        piece->leaderOffset = leader->leaderOffset;
+        piece->leader = leader->leader;
+      }
+    }
+  }
+}
+
+void SectionMerger::removeDuplicates() {
+  std::set<SectionData*> changed;
+  std::vector<MergeableSection*>::iterator sect, sectEnd = m_Sections.end();
+  for (sect = m_Sections.begin(); sect != sectEnd; ++sect) {
+    std::vector<Piece>::iterator piece, pEnd = (*sect)->pieces.end();
+    for (piece = (*sect)->pieces.begin(); piece != pEnd; ++piece) {
+      if (piece->leader == &*piece)
+        continue;
+      SectionData* data = piece->frag->getParent();
+      data->getFragmentList().remove(SectionData::iterator(piece->frag));
+      m_Removed.push_back(piece->frag);
+      changed.insert(data);
+    }
+  }
+
+  // lay out the rest of the fragments again
+  std::set<SectionData*>::iterator data, dataEnd = changed.end();
+  for (data = changed.begin(); data != dataEnd; ++data) {
+    uint64_t offset = 0;
+    SectionData::iterator frag, fragEnd = (*data)->end();
+    for (frag = (*data)->begin(); frag != fragEnd; ++frag) {
+      frag->setOffset(offset);
+      offset += frag->size();
+    }
+    (*data)->getSection().setSize(offset);
+  }
+}
+
+void SectionMerger::moveSymbol(LDSymbol& pSymbol) {
+  if (!pSymbol.hasFragRef())
+    return;
+
+  FragmentRef* ref = pSymbol.fragRef();
+  WholeMapTy::iterator entry = m_WholeMap.find(ref->frag());
+  if (entry == m_WholeMap.end())
+    return;
+
+  Piece& piece = findPiece(*entry->second, ref->offset());
+  ref->assign(*piece.leader->frag,
+              piece.leaderOffset + (ref->offset() - piece.offset));
+}
+
+void SectionMerger::rewriteRelocations() {
+  std::vector<SectionSymbolReloc>::iterator reloc, rEnd = m_Relocs.end();
+  for (reloc = m_Relocs.begin(); reloc != rEnd; ++reloc) {
+    const Piece& piece = *reloc->piece;
+    uint64_t target = piece.leader->frag->getOffset() + piece.leaderOffset +
+                      reloc->offset;
+    if (reloc->reloc != NULL) {
+      const FragmentRef* ref =
+          reloc->reloc->symInfo()->outSymbol()->fragRef();
+      reloc->reloc->setAddend(target - ref->getOutputOffset());
+    } else {
+      const FragmentRef* ref =
+          reloc->data->getSymInfo(reloc->index)->outSymbol()->fragRef();
+      reloc->data->setAddend(reloc->index, target - ref->getOutputOffset());
+    }
+  }
+  m_Relocs.clear();
+}
+
+}  // namespace mcld
@@ -144,7 +144,7 @@ bool StaticResolver::resolve(ResolveInfo& __restrict__ pOld,
       /* Fall through */
       case IND: { /* override by indirect symbol.  */
         if (pNew.link() == NULL) {
-          fatal(diag::indirect_refer_to_inexist) << pNew.name();
+          fatal(diag::indirect_refer_to_inexist) << pOld.name();
           break;
         }
 
@@ -179,13 +179,13 @@ bool StaticResolver::resolve(ResolveInfo& __restrict__ pOld,
             break;
           } else {
             error(diag::multiple_absolute_definitions)
-                << demangleName(pNew.name()) << pOld.outSymbol()->value()
+                << demangleName(pOld.name()) << pOld.outSymbol()->value()
                 << pValue;
             break;
           }
         }
 
-        error(diag::multiple_definitions) << demangleName(pNew.name());
+        error(diag::multiple_definitions) << demangleName(pOld.name());
         break;
       }
       case REFC: { /* Mark indirect symbol referenced and then CYCLE.  */
@@ -201,7 +201,7 @@ bool StaticResolver::resolve(ResolveInfo& __restrict__ pOld,
       }
       default: {
         error(diag::undefined_situation) << action << old->name()
-                                         << pNew.name();
+                                         << pOld.name();
         return false;
       }
     }  // end of the big switch (action)
@@ -0,0 +1,187 @@
+//===- StringTableBuilder.cpp ---------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "mcld/LD/StringTableBuilder.h"
+#include "mcld/Support/Parallel.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace mcld {
+
+namespace {
+
+/// the number of buckets of the names by their last two characters
+const size_t kNumOfBuckets = 1 << 16;
+
+/// charTailAt - the character at pPos from the end of pString, or -1 if
+/// pString is shorter
+int charTailAt(llvm::StringRef pString, size_t pPos) {
+  if (pPos >= pString.size())
+    return -1;
+  return static_cast<unsigned char>(pString[pString.size() - pPos - 1]);
+}
+
+/// getBucket - the bucket of a non-empty string. The buckets are in the
+/// descending order of the last two characters.
+size_t getBucket(llvm::StringRef pString) {
+  size_t last = static_cast<unsigned char>(pString.back());
+  size_t second = 0;
+  if (pString.size() > 1)
+    second = static_cast<unsigned char>(pString[pString.size() - 2]);
+  return (kNumOfBuckets - 1) - ((last << 8) | second);
+}
+
+/// multikeySort - sort the strings in the descending order of their
+/// reversed characters, whose last pPos characters are the same. A string
+/// comes after the longer strings that end with it.
+void multikeySort(llvm::StringRef* pStrings, size_t pSize, size_t pPos) {
+  while (pSize > 1) {
+    std::swap(pStrings[0], pStrings[pSize / 2]);
+    int pivot = charTailAt(pStrings[0], pPos);
+    // [0, lt) > pivot, [lt, k) == pivot, [gt, pSize) < pivot
+    size_t lt = 0, gt = pSize, k = 1;
+    while (k < gt) {
+      int c = charTailAt(pStrings[k], pPos);
+      if (c > pivot)
+        std::swap(pStrings[lt++], pStrings[k++]);
+      else if (c < pivot)
+        std::swap(pStrings[--gt], pStrings[k]);
+      else
+        ++k;
+    }
+    multikeySort(pStrings, lt, pPos);
+    multikeySort(pStrings + gt, pSize - gt, pPos);
+    if (pivot == -1)
+      return;
+    // the strings that are equal at pPos continue with the next character
+    pStrings += lt;
+    pSize = gt - lt;
+    ++pPos;
+  }
+}
+
+}  // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// StringTableBuilder
+//===----------------------------------------------------------------------===//
+StringTableBuilder::StringTableBuilder() : m_Size(1), m_bFinalized(false) {
+}
+
+void StringTableBuilder::add(llvm::StringRef pString) {
+  assert(!m_bFinalized && "add a string to a finalized table");
+  if (!pString.empty())
+    m_Strings.push_back(pString);
+}
+
+size_t StringTableBuilder::finalizeOffset(unsigned pThreads) {
+  assert(!m_bFinalized);
+  // distribute the strings into the buckets by their last two characters
+  std::vector<size_t> bucket_begin(kNumOfBuckets + 1, 0);
+  for (const llvm::StringRef& str : m_Strings)
+    ++bucket_begin[getBucket(str) + 1];
+  for (size_t b = 0; b != kNumOfBuckets; ++b)
+    bucket_begin[b + 1] += bucket_begin[b];
+
+  std::vector<llvm::StringRef> sorted(m_Strings.size());
+  std::vector<size_t> next(bucket_begin.begin(), bucket_begin.end() - 1);
+  for (const llvm::StringRef& str : m_Strings)
+    sorted[next[getBucket(str)]++] = str;
+  std::vector<llvm::StringRef>().swap(m_Strings);
+
+  // sort the buckets on their own
+  const size_t buckets_per_chunk = 256;
+  parallelForRange(pThreads, 0, kNumOfBuckets, buckets_per_chunk,
+                   [&](size_t pChunkBegin, size_t pChunkEnd) {
+    for (size_t b = pChunkBegin; b != pChunkEnd; ++b) {
+      size_t size = bucket_begin[b + 1] - bucket_begin[b];
+      multikeySort(sorted.data() + bucket_begin[b], size, 2);
+    }
+  });
+
+  // A string that ends the previous stored string is stored as its tail.
+  // Otherwise, it is stored after the previous one.
+  m_Offsets.reserve(sorted.size());
+  llvm::StringRef stored;
+  size_t stored_offset = 0;
+  for (const llvm::StringRef& str : sorted) {
+    size_t offset;
+    if (!stored.empty() && stored.endswith(str)) {
+      offset = stored_offset + (stored.size() - str.size());
+    } else {
+      offset = m_Size;
+      m_Emitted.push_back(std::make_pair(str, offset));
+      m_Size += str.size() + 1;
+      stored = str;
+      stored_offset = offset;
+    }
+    m_Offsets.insert(std::make_pair(str, offset));
+  }
+
+  m_bFinalized = true;
+  return m_Size;
+}
+
+size_t StringTableBuilder::append(llvm::StringRef pString) {
+  assert(m_bFinalized && "append a string to a table being built");
+  if (hasString(pString))
+    return getOffset(pString);
+
+  m_Appended.push_back(pString.str());
+  llvm::StringRef copy(m_Appended.back());
+  size_t offset = m_Size;
+  m_Emitted.push_back(std::make_pair(copy, offset));
+  m_Offsets.insert(std::make_pair(copy, offset));
+  m_Size += copy.size() + 1;
+  return offset;
+}
+
+void StringTableBuilder::emit(MemoryRegion& pRegion, unsigned pThreads) const {
+  assert(m_bFinalized);
+  assert(pRegion.size() >= m_Size);
+  char* begin = reinterpret_cast<char*>(pRegion.begin());
+  begin[0] = '\0';
+
+  // every string owns its range of the table
+  const size_t strings_per_chunk = 4096;
+  parallelForRange(pThreads, 0, m_Emitted.size(), strings_per_chunk,
+                   [&](size_t pChunkBegin, size_t pChunkEnd) {
+    for (size_t i = pChunkBegin; i != pChunkEnd; ++i) {
+      const llvm::StringRef& str = m_Emitted[i].first;
+      char* ptr = begin + m_Emitted[i].second;
+      ::memcpy(ptr, str.data(), str.size());
+      ptr[str.size()] = '\0';
+    }
+  });
+}
+
+void StringTableBuilder::clear() {
+  m_Strings.clear();
+  m_Emitted.clear();
+  m_Appended.clear();
+  m_Offsets.clear();
+  m_Size = 1;
+  m_bFinalized = false;
+}
+
+bool StringTableBuilder::hasString(llvm::StringRef pString) const {
+  return pString.empty() || m_Offsets.find(pString) != m_Offsets.end();
+}
+
+size_t StringTableBuilder::getOffset(llvm::StringRef pString) const {
+  assert(m_bFinalized);
+  if (pString.empty())
+    return 0;
+  OffsetMap::const_iterator entry = m_Offsets.find(pString);
+  assert(entry != m_Offsets.end() && "the string is not in the table");
+  return entry->second;
+}
+
+}  // namespace mcld
@@ -46,7 +46,7 @@ LDSection* ObjectBuilder::CreateSection(const std::string& pName,
   if (output_sect == NULL) {
     output_sect = LDSection::Create(pName, pKind, pType, pFlag);
     output_sect->setAlign(pAlign);
-    m_Module.getSectionTable().push_back(output_sect);
+    m_Module.addSection(*output_sect);
   }
   return output_sect;
 }
@@ -72,7 +72,8 @@ LDSection* ObjectBuilder::MergeSection(const Input& pInputFile,
                                pInputSection.type(),
                                pInputSection.flag());
     target->setAlign(pInputSection.align());
-    m_Module.getSectionTable().push_back(target);
+    target->setEntSize(pInputSection.entSize());
+    m_Module.addSection(*target);
   }
 
   switch (target->kind()) {
@@ -31,6 +31,7 @@
 #include "mcld/LD/RelocData.h"
 #include "mcld/LD/ResolveInfo.h"
 #include "mcld/LD/SectionData.h"
+#include "mcld/LD/SectionMerger.h"
 #include "mcld/Object/ObjectBuilder.h"
 #include "mcld/Script/Assignment.h"
 #include "mcld/Script/Operand.h"
@@ -39,6 +40,7 @@
 #include "mcld/Script/ScriptReader.h"
 #include "mcld/Support/FileOutputBuffer.h"
 #include "mcld/Support/MsgHandling.h"
+#include "mcld/Support/Parallel.h"
 #include "mcld/Support/RealPath.h"
 #include "mcld/Target/TargetLDBackend.h"
 
@@ -46,6 +48,7 @@
 #include <llvm/Support/Host.h>
 
 #include <system_error>
+#include <vector>
 
 namespace mcld {
 
@@ -64,7 +67,8 @@ ObjectLinker::ObjectLinker(const LinkerConfig& pConfig,
       m_pGroupReader(NULL),
       m_pBinaryReader(NULL),
       m_pScriptReader(NULL),
-      m_pWriter(NULL) {
+      m_pWriter(NULL),
+      m_pSectionMerger(NULL) {
 }
 
 ObjectLinker::~ObjectLinker() {
@@ -75,6 +79,7 @@ ObjectLinker::~ObjectLinker() {
   delete m_pBinaryReader;
   delete m_pScriptReader;
   delete m_pWriter;
+  delete m_pSectionMerger;
 }
 
 bool ObjectLinker::initialize(Module& pModule, IRBuilder& pBuilder) {
@@ -143,7 +148,41 @@ void ObjectLinker::addUndefinedSymbols() {
   }
 }
 
+/// prepareObjects - decode the relocatable objects in the input tree
+/// concurrently. Only the section header tables and the symbol tables are
+/// decoded here; sections and symbols are still created and resolved by
+/// normalize() one input at a time in command-line order, so the result is
+/// the same as that of a serial link.
+void ObjectLinker::prepareObjects() {
+  unsigned threads = m_Config.options().numThreads();
+  if (threads <= 1)
+    return;
+
+  std::vector<Input*> objects;
+  InputTree::dfs_iterator input, inEnd = m_pModule->getInputTree().dfs_end();
+  for (input = m_pModule->getInputTree().dfs_begin(); input != inEnd;
+       ++input) {
+    if (isGroup(input) || (*input)->type() != Input::Unknown ||
+        !(*input)->hasMemArea())
+      continue;
+
+    // detect the input as normalize() does
+    bool doContinue = false;
+    if (!getBinaryReader()->isMyFormat(**input, doContinue) && doContinue &&
+        getObjectReader()->isMyFormat(**input, doContinue))
+      objects.push_back(*input);
+  }
+
+  parallelForEach(threads, objects.begin(), objects.end(),
+                  [this](Input* pInput) {
+                    getObjectReader()->prepare(*pInput);
+                  });
+}
+
 void ObjectLinker::normalize() {
+  // -----  decode relocatable objects concurrently  ----- //
+  prepareObjects();
+
   // -----  set up inputs  ----- //
   Module::input_iterator input, inEnd = m_pModule->input_end();
   for (input = m_pModule->input_begin(); input != inEnd; ++input) {
@@ -300,6 +339,32 @@ bool ObjectLinker::readRelocations() {
 
 /// mergeSections - put allinput sections into output sections
 bool ObjectLinker::mergeSections() {
+  // Before the fragments move to the output sections, bind the kept
+  // relocations that the backend neither changes nor keeps to their places,
+  // and materialize the others. The relocations of the stripped and folded
+  // sections stay packed and are dropped.
+  const Relocator& relocator = *m_LDBackend.getRelocator();
+  Module::obj_iterator input, inEnd = m_pModule->obj_end();
+  for (input = m_pModule->obj_begin(); input != inEnd; ++input) {
+    LDContext::sect_iterator rs, rsEnd = (*input)->context()->relocSectEnd();
+    for (rs = (*input)->context()->relocSectBegin(); rs != rsEnd; ++rs) {
+      if (LDFileFormat::Ignore == (*rs)->kind() || !(*rs)->hasRelocData())
+        continue;
+      const LDSection& target = *(*rs)->getLink();
+      if (LDFileFormat::Ignore == target.kind() ||
+          LDFileFormat::Folded == target.kind())
+        continue;
+      // partial links move the relocations to the output, and .eh_frame
+      // keeps the relocations of its CIEs
+      if (LinkerConfig::Object != m_Config.codeGenType() &&
+          LDFileFormat::EhFrame != target.kind() &&
+          relocator.mayKeepPacked(target))
+        (*rs)->getRelocData()->bind();
+      else
+        (*rs)->getRelocData()->materialize();
+    }
+  }
+
   // run the target-dependent hooks before merging sections
   m_LDBackend.preMergeSections(*m_pModule);
 
@@ -335,6 +400,12 @@ bool ObjectLinker::mergeSections() {
     }  // for each output section description
   }
 
+  // split the mergeable sections into pieces before moving them to output
+  if (LinkerConfig::Object != m_Config.codeGenType()) {
+    m_pSectionMerger = new SectionMerger(m_Config, *m_pModule);
+    m_pSectionMerger->split();
+  }
+
   ObjectBuilder builder(*m_pModule);
   Module::obj_iterator obj, objEnd = m_pModule->obj_end();
   for (obj = m_pModule->obj_begin(); obj != objEnd; ++obj) {
@@ -434,6 +505,10 @@ bool ObjectLinker::mergeSections() {
     }  // for each output section description
   }
 
+  // fold the duplicate pieces of the mergeable sections
+  if (m_pSectionMerger != NULL)
+    m_pSectionMerger->merge();
+
   // run the target-dependent hooks after merging sections
   m_LDBackend.postMergeSections(*m_pModule);
 
@@ -579,6 +654,9 @@ bool ObjectLinker::addScriptSymbols() {
 }
 
 bool ObjectLinker::scanRelocations() {
+  // the bound relocations are scanned through the scratch
+  Relocation* scratch = Relocation::Create();
+
   // apply all relocations of all inputs
   Module::obj_iterator input, inEnd = m_pModule->obj_end();
   for (input = m_pModule->obj_begin(); input != inEnd; ++input) {
@@ -592,32 +670,43 @@ bool ObjectLinker::scanRelocations() {
       // discarded group sections)
       if (LDFileFormat::Ignore == (*rs)->kind() || !(*rs)->hasRelocData())
         continue;
-      RelocData::iterator reloc, rEnd = (*rs)->getRelocData()->end();
-      for (reloc = (*rs)->getRelocData()->begin(); reloc != rEnd; ++reloc) {
-        Relocation* relocation = llvm::cast<Relocation>(reloc);
-
-        // bypass the reloc if the symbol is in the discarded input section
-        ResolveInfo* info = relocation->symInfo();
-        if (!info->outSymbol()->hasFragRef() &&
-            ResolveInfo::Section == info->type() &&
-            ResolveInfo::Undefined == info->desc())
-          continue;
-
-        // scan relocation
-        if (LinkerConfig::Object != m_Config.codeGenType()) {
-          m_LDBackend.getRelocator()->scanRelocation(
-              *relocation, *m_pBuilder, *m_pModule, **rs, **input);
-        } else {
-          m_LDBackend.getRelocator()->partialScanRelocation(
-              *relocation, *m_pModule);
+      RelocData* reloc_data = (*rs)->getRelocData();
+      if (reloc_data->hasPacked()) {
+        for (size_t i = 0, e = reloc_data->numOfPacked(); i != e; ++i) {
+          reloc_data->load(i, *scratch);
+          scanRelocation(*scratch, **rs, **input);
+          reloc_data->store(i, *scratch);
         }
-      }  // for all relocations
-    }    // for all relocation section
+        continue;
+      }
+      RelocData::iterator reloc, rEnd = reloc_data->end();
+      for (reloc = reloc_data->begin(); reloc != rEnd; ++reloc)
+        scanRelocation(*llvm::cast<Relocation>(reloc), **rs, **input);
+    }  // for all relocation section
     m_LDBackend.getRelocator()->finalizeScan(**input);
   }  // for all inputs
   return true;
 }
 
+void ObjectLinker::scanRelocation(Relocation& pReloc,
+                                  LDSection& pSection,
+                                  Input& pInput) {
+  // bypass the reloc if the symbol is in the discarded input section
+  ResolveInfo* info = pReloc.symInfo();
+  if (!info->outSymbol()->hasFragRef() &&
+      ResolveInfo::Section == info->type() &&
+      ResolveInfo::Undefined == info->desc())
+    return;
+
+  // scan relocation
+  if (LinkerConfig::Object != m_Config.codeGenType()) {
+    m_LDBackend.getRelocator()->scanRelocation(
+        pReloc, *m_pBuilder, *m_pModule, pSection, pInput);
+  } else {
+    m_LDBackend.getRelocator()->partialScanRelocation(pReloc, *m_pModule);
+  }
+}
+
 /// initStubs - initialize stub-related stuff.
 bool ObjectLinker::initStubs() {
   // initialize BranchIslandFactory
@@ -685,7 +774,8 @@ bool ObjectLinker::prelayout() {
   if (LinkerConfig::Object != m_Config.codeGenType()) {
     LDSection* debug_str_sect = m_pModule->getSection(".debug_str");
     if (debug_str_sect && debug_str_sect->hasDebugString())
-      debug_str_sect->getDebugString()->computeOffsetSize();
+      debug_str_sect->getDebugString()->computeOffsetSize(
+          m_Config.options().numThreads());
   }
   return true;
 }
@@ -776,54 +866,161 @@ bool ObjectLinker::finalizeSymbolValue() {
 /// Create relocation section, asking TargetLDBackend to
 /// read the relocation information into RelocationEntry
 /// and push_back into the relocation section
+/// isDiscardedReloc - the reloc refers to a symbol in a discarded input
+/// section
+static bool isDiscardedReloc(const Relocation& pReloc) {
+  const ResolveInfo* info = pReloc.symInfo();
+  return !info->outSymbol()->hasFragRef() &&
+         ResolveInfo::Section == info->type() &&
+         ResolveInfo::Undefined == info->desc();
+}
+
+/// isDebugStringReloc - the reloc refers to a symbol on DebugString
+static bool isDebugStringReloc(const Relocation& pReloc) {
+  const LDSymbol* sym = pReloc.symInfo()->outSymbol();
+  return sym->hasFragRef() &&
+         sym->fragRef()->frag()->getKind() == Fragment::Region &&
+         sym->fragRef()->frag()->getParent()->getSection().kind() ==
+             LDFileFormat::DebugString;
+}
+
+/// isAppliedRelocSect - bypass the reloc section if
+/// 1. its section kind is changed to Ignore. (The target section is a
+/// discarded group section.)
+/// 2. it has no reloc data. (All symbols in the input relocs are in the
+/// discarded group sections)
+static bool isAppliedRelocSect(const LDSection& pSection) {
+  return LDFileFormat::Ignore != pSection.kind() && pSection.hasRelocData();
+}
+
+/// forEachAppliedReloc - call pFunc(relocation, bound) for the relocations
+/// of the applied relocation sections of pInput, in order. A bound
+/// relocation is loaded into pScratch, and its target data is stored back
+/// after pFunc.
+template <typename FuncTy>
+static void forEachAppliedReloc(Input& pInput,
+                                Relocation& pScratch,
+                                FuncTy pFunc) {
+  LDContext::sect_iterator rs, rsEnd = pInput.context()->relocSectEnd();
+  for (rs = pInput.context()->relocSectBegin(); rs != rsEnd; ++rs) {
+    if (!isAppliedRelocSect(**rs))
+      continue;
+    RelocData* reloc_data = (*rs)->getRelocData();
+    if (reloc_data->hasPacked()) {
+      for (size_t i = 0, e = reloc_data->numOfPacked(); i != e; ++i) {
+        reloc_data->load(i, pScratch);
+        pFunc(pScratch, true);
+        reloc_data->store(i, pScratch);
+      }
+      continue;
+    }
+    RelocData::iterator reloc, rEnd = reloc_data->end();
+    for (reloc = reloc_data->begin(); reloc != rEnd; ++reloc)
+      pFunc(*llvm::cast<Relocation>(reloc), false);
+  }
+}
+
 bool ObjectLinker::relocation() {
   // when producing relocatables, no need to apply relocation
   if (LinkerConfig::Object == m_Config.codeGenType())
     return true;
 
-  LDSection* debug_str_sect = m_pModule->getSection(".debug_str");
+  // in streaming mode, relocations are applied by emitOutput()
+  if (streamsRelocations())
+    return true;
 
-  // apply all relocations of all inputs
-  Module::obj_iterator input, inEnd = m_pModule->obj_end();
-  for (input = m_pModule->obj_begin(); input != inEnd; ++input) {
-    m_LDBackend.getRelocator()->initializeApply(**input);
-    LDContext::sect_iterator rs, rsEnd = (*input)->context()->relocSectEnd();
-    for (rs = (*input)->context()->relocSectBegin(); rs != rsEnd; ++rs) {
-      // bypass the reloc section if
-      // 1. its section kind is changed to Ignore. (The target section is a
-      // discarded group section.)
-      // 2. it has no reloc data. (All symbols in the input relocs are in the
-      // discarded group sections)
-      if (LDFileFormat::Ignore == (*rs)->kind() || !(*rs)->hasRelocData())
-        continue;
-      RelocData::iterator reloc, rEnd = (*rs)->getRelocData()->end();
-      for (reloc = (*rs)->getRelocData()->begin(); reloc != rEnd; ++reloc) {
-        Relocation* relocation = llvm::cast<Relocation>(reloc);
+  applyRelocations(NULL);
+  return true;
+}
 
-        // bypass the reloc if the symbol is in the discarded input section
-        ResolveInfo* info = relocation->symInfo();
-        if (!info->outSymbol()->hasFragRef() &&
-            ResolveInfo::Section == info->type() &&
-            ResolveInfo::Undefined == info->desc())
-          continue;
+bool ObjectLinker::streamsRelocations() const {
+  return LinkerConfig::Object != m_Config.codeGenType() &&
+         m_Config.options().streamRelocations();
+}
 
+void ObjectLinker::applyRelocations(FileOutputBuffer* pOutput) {
+  LDSection* debug_str_sect = m_pModule->getSection(".debug_str");
+  Relocator& relocator = *m_LDBackend.getRelocator();
+
+  // the merged pieces have their final offsets now
+  if (m_pSectionMerger != NULL)
+    m_pSectionMerger->rewriteRelocations();
+
+  // With --threads, first apply the relocations that only write their own
+  // target data on the workers. Their results are kept per input and issued
+  // below in the original order, so the diagnostics are the same as in a
+  // serial link. A result is keyed by the position of its relocation in the
+  // input, since the bound relocations share the scratch of their input.
+  typedef std::vector<std::pair<size_t, Relocator::Result> > ResultList;
+  std::vector<Input*> inputs(m_pModule->obj_begin(), m_pModule->obj_end());
+  std::vector<ResultList> failures(inputs.size());
+  std::vector<Relocation*> scratches(inputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i)
+    scratches[i] = Relocation::Create();
+  unsigned threads = m_Config.options().numThreads();
+  bool concurrent = (threads > 1);
+  if (concurrent) {
+    parallelFor(threads, 0, inputs.size(), [&](size_t pIdx) {
+      size_t position = 0;
+      forEachAppliedReloc(*inputs[pIdx], *scratches[pIdx],
+                          [&](Relocation& pReloc, bool) {
+        size_t current = position++;
+        if (isDiscardedReloc(pReloc) || isDebugStringReloc(pReloc) ||
+            !relocator.mayApplyConcurrently(pReloc))
+          return;
+        Relocator::Result result = relocator.applyRelocation(pReloc);
+        if (Relocator::OK != result)
+          failures[pIdx].push_back(std::make_pair(current, result));
+      });
+    });
+  }
+
+  // apply all relocations of all inputs
+  std::vector<Relocation*> applied;
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    relocator.initializeApply(*inputs[i]);
+    applied.clear();
+    ResultList::iterator failure = failures[i].begin();
+    size_t position = 0;
+    forEachAppliedReloc(*inputs[i], *scratches[i],
+                        [&](Relocation& pReloc, bool pBound) {
+      size_t current = position++;
+
+      // bypass the reloc if the symbol is in the discarded input section
+      if (isDiscardedReloc(pReloc))
+        return;
+
+      if (pOutput != NULL && !pBound)
+        applied.push_back(&pReloc);
+
+      if (isDebugStringReloc(pReloc)) {
         // apply the relocation aginst symbol on DebugString
-        if (info->outSymbol()->hasFragRef() &&
-            info->outSymbol()->fragRef()->frag()->getKind()
-                == Fragment::Region &&
-            info->outSymbol()->fragRef()->frag()->getParent()->getSection()
-                .kind() == LDFileFormat::DebugString) {
-          assert(debug_str_sect != NULL);
-          assert(debug_str_sect->hasDebugString());
-          debug_str_sect->getDebugString()->applyOffset(*relocation,
-                                                        m_LDBackend);
-          continue;
+        assert(debug_str_sect != NULL);
+        assert(debug_str_sect->hasDebugString());
+        debug_str_sect->getDebugString()->applyOffset(pReloc, m_LDBackend);
+      } else if (concurrent && relocator.mayApplyConcurrently(pReloc)) {
+        // already applied by a worker, only issue its diagnostic
+        if (failure != failures[i].end() && failure->first == current) {
+          relocator.issueApplyResult(pReloc, failure->second);
+          ++failure;
         }
+      } else {
+        pReloc.apply(relocator);
+      }
 
-        relocation->apply(*m_LDBackend.getRelocator());
-      }  // for all relocations
-    }    // for all relocation section
-    m_LDBackend.getRelocator()->finalizeApply(**input);
+      // the result of a bound relocation is final once it is applied
+      if (pOutput != NULL && pBound)
+        streamRelocationResult(pReloc, pOutput->getBufferStart(), true);
+    });
+    relocator.finalizeApply(*inputs[i]);
+
+    // In streaming mode, write the results of this input while they are
+    // still hot. Some targets (e.g., Mips HI16/LO16) only finish a result in
+    // a later relocation or in finalizeApply(), so this cannot be done right
+    // after each apply. Sections written after the relocations are applied
+    // (.got, .ARM.exidx, ...) get their results in postProcessing().
+    if (pOutput != NULL)
+      streamRelocationResults(applied, pOutput->getBufferStart());
   }  // for all inputs
 
   // apply relocations created by relaxation
@@ -833,22 +1030,33 @@ bool ObjectLinker::relocation() {
     BranchIsland& island = *facIter;
     BranchIsland::reloc_iterator iter, iterEnd = island.reloc_end();
     for (iter = island.reloc_begin(); iter != iterEnd; ++iter)
-      (*iter)->apply(*m_LDBackend.getRelocator());
+      (*iter)->apply(relocator);
   }
 
   // apply relocations created by LD backend
   for (TargetLDBackend::extra_reloc_iterator
        iter = m_LDBackend.extra_reloc_begin(),
        end = m_LDBackend.extra_reloc_end(); iter != end; ++iter) {
-    iter->apply(*m_LDBackend.getRelocator());
+    iter->apply(relocator);
   }
-
-  return true;
 }
 
 /// emitOutput - emit the output file.
 bool ObjectLinker::emitOutput(FileOutputBuffer& pOutput) {
-  return std::error_code() == getWriter()->writeObject(*m_pModule, pOutput);
+  if (!streamsRelocations())
+    return std::error_code() == getWriter()->writeObject(*m_pModule, pOutput);
+
+  // Copy the input contents first, so that each relocation result can be
+  // written over them as soon as it is applied. The sections built by the
+  // linker (.got, .rel.dyn, ...) are written last, since applying the
+  // relocations still updates them.
+  if (std::error_code() != getWriter()->writeInputContents(*m_pModule, pOutput))
+    return false;
+
+  applyRelocations(&pOutput);
+
+  return std::error_code() ==
+         getWriter()->writeLinkerContents(*m_pModule, pOutput);
 }
 
 /// postProcessing - do modification after all processes
@@ -868,41 +1076,36 @@ bool ObjectLinker::postProcessing(FileOutputBuffer& pOutput) {
 void ObjectLinker::normalSyncRelocationResult(FileOutputBuffer& pOutput) {
   uint8_t* data = pOutput.getBufferStart();
 
-  // sync all relocations of all inputs
-  Module::obj_iterator input, inEnd = m_pModule->obj_end();
-  for (input = m_pModule->obj_begin(); input != inEnd; ++input) {
-    LDContext::sect_iterator rs, rsEnd = (*input)->context()->relocSectEnd();
-    for (rs = (*input)->context()->relocSectBegin(); rs != rsEnd; ++rs) {
-      // bypass the reloc section if
-      // 1. its section kind is changed to Ignore. (The target section is a
-      // discarded group section.)
-      // 2. it has no reloc data. (All symbols in the input relocs are in the
-      // discarded group sections)
-      if (LDFileFormat::Ignore == (*rs)->kind() || !(*rs)->hasRelocData())
-        continue;
-      RelocData::iterator reloc, rEnd = (*rs)->getRelocData()->end();
-      for (reloc = (*rs)->getRelocData()->begin(); reloc != rEnd; ++reloc) {
-        Relocation* relocation = llvm::cast<Relocation>(reloc);
-
+  if (streamsRelocations()) {
+    // only the relocations against the sections written after
+    // applyRelocations() are left
+    std::vector<Relocation*>::iterator pending, pEnd = m_PendingRelocs.end();
+    for (pending = m_PendingRelocs.begin(); pending != pEnd; ++pending)
+      writeRelocationResult(**pending, data);
+    m_PendingRelocs.clear();
+  } else {
+    // sync all relocations of all inputs
+    Relocation* scratch = Relocation::Create();
+    Module::obj_iterator input, inEnd = m_pModule->obj_end();
+    for (input = m_pModule->obj_begin(); input != inEnd; ++input) {
+      forEachAppliedReloc(**input, *scratch,
+                          [&](Relocation& pReloc, bool) {
         // bypass the reloc if the symbol is in the discarded input section
-        ResolveInfo* info = relocation->symInfo();
-        if (!info->outSymbol()->hasFragRef() &&
-            ResolveInfo::Section == info->type() &&
-            ResolveInfo::Undefined == info->desc())
-          continue;
-
-        // bypass the relocation with NONE type. This is to avoid overwrite the
-        // target result by NONE type relocation if there is a place which has
-        // two relocations to apply to, and one of it is NONE type. The result
-        // we want is the value of the other relocation result. For example,
-        // in .exidx, there are usually an R_ARM_NONE and R_ARM_PREL31 apply to
-        // the same place
-        if (relocation->type() == 0x0)
-          continue;
-        writeRelocationResult(*relocation, data);
-      }  // for all relocations
-    }    // for all relocation section
-  }      // for all inputs
+        if (isDiscardedReloc(pReloc))
+          return;
+
+        // bypass the relocation with NONE type. This is to avoid overwrite
+        // the target result by NONE type relocation if there is a place
+        // which has two relocations to apply to, and one of it is NONE
+        // type. The result we want is the value of the other relocation
+        // result. For example, in .exidx, there are usually an R_ARM_NONE
+        // and R_ARM_PREL31 apply to the same place
+        if (pReloc.type() == 0x0)
+          return;
+        writeRelocationResult(pReloc, data);
+      });
+    }  // for all inputs
+  }
 
   // sync relocations created by relaxation
   BranchIslandFactory* br_factory = m_LDBackend.getBRIslandFactory();
@@ -951,6 +1154,38 @@ void ObjectLinker::partialSyncRelocationResult(FileOutputBuffer& pOutput) {
   }
 }
 
+void ObjectLinker::streamRelocationResults(
+    const std::vector<Relocation*>& pRelocs,
+    uint8_t* pOutput) {
+  std::vector<Relocation*>::const_iterator reloc, rEnd = pRelocs.end();
+  for (reloc = pRelocs.begin(); reloc != rEnd; ++reloc)
+    streamRelocationResult(**reloc, pOutput, false);
+}
+
+void ObjectLinker::streamRelocationResult(Relocation& pReloc,
+                                          uint8_t* pOutput,
+                                          bool pBound) {
+  // bypass the relocation with NONE type, see normalSyncRelocationResult()
+  if (pReloc.type() == 0x0)
+    return;
+
+  const LDSection& target_sect =
+      pReloc.targetRef().frag()->getParent()->getSection();
+  if (getWriter()->isInputContent(target_sect)) {
+    writeRelocationResult(pReloc, pOutput);
+    return;
+  }
+
+  Relocation* pending = &pReloc;
+  if (pBound) {
+    pending = Relocation::Create(
+        pReloc.type(), pReloc.targetRef(), pReloc.addend());
+    pending->setSymInfo(pReloc.symInfo());
+    pending->target() = pReloc.target();
+  }
+  m_PendingRelocs.push_back(pending);
+}
+
 void ObjectLinker::writeRelocationResult(Relocation& pReloc, uint8_t* pOutput) {
   // get output file offset
   size_t out_offset =
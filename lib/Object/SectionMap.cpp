@@ -11,6 +11,7 @@
 #include "mcld/Fragment/NullFragment.h"
 #include "mcld/LD/LDSection.h"
 #include "mcld/LD/SectionData.h"
+#include "mcld/Object/SectionMatcher.h"
 #include "mcld/Script/Assignment.h"
 #include "mcld/Script/Operand.h"
 #include "mcld/Script/Operator.h"
@@ -23,14 +24,6 @@
 #include <cassert>
 #include <cstring>
 #include <climits>
-#if !defined(MCLD_ON_WIN32)
-#include <fnmatch.h>
-#define fnmatch0(pattern, string) (fnmatch(pattern, string, 0) == 0)
-#else
-#include <windows.h>
-#include <shlwapi.h>
-#define fnmatch0(pattern, string) (PathMatchSpec(string, pattern) == true)
-#endif
 
 namespace mcld {
 
@@ -155,7 +148,11 @@ SectionMap::Output::dot_iterator SectionMap::Output::find_last_explicit_dot() {
 //===----------------------------------------------------------------------===//
 // SectionMap
 //===----------------------------------------------------------------------===//
+SectionMap::SectionMap() : m_pMatcher(NULL) {
+}
+
 SectionMap::~SectionMap() {
+  delete m_pMatcher;
   iterator out, outBegin = begin(), outEnd = end();
   for (out = outBegin; out != outEnd; ++out) {
     if (*out != NULL) {
@@ -172,29 +169,23 @@ SectionMap::~SectionMap() {
 SectionMap::const_mapping SectionMap::find(
     const std::string& pInputFile,
     const std::string& pInputSection) const {
-  const_iterator out, outBegin = begin(), outEnd = end();
-  for (out = outBegin; out != outEnd; ++out) {
-    Output::const_iterator in, inBegin = (*out)->begin(), inEnd = (*out)->end();
-    for (in = inBegin; in != inEnd; ++in) {
-      if (matched(**in, pInputFile, pInputSection))
-        return std::make_pair(*out, *in);
-    }
-  }
-  return std::make_pair((const Output*)NULL, (const Input*)NULL);
+  size_t out, in;
+  std::lock_guard<std::mutex> lock(m_MatcherMutex);
+  if (!getMatcher().find(pInputFile, pInputSection, out, in))
+    return std::make_pair((const Output*)NULL, (const Input*)NULL);
+  const Output* output = m_OutputDescList[out];
+  return std::make_pair(output, *(output->begin() + in));
 }
 
 SectionMap::mapping SectionMap::find(const std::string& pInputFile,
                                      const std::string& pInputSection) {
-  iterator out, outBegin = begin(), outEnd = end();
-  for (out = outBegin; out != outEnd; ++out) {
-    Output::iterator in, inBegin = (*out)->begin(), inEnd = (*out)->end();
-    for (in = inBegin; in != inEnd; ++in) {
-      if (matched(**in, pInputFile, pInputSection))
-        return std::make_pair(*out, *in);
-    }
-  }
-  return std::make_pair(reinterpret_cast<Output*>(NULL),
-                        reinterpret_cast<Input*>(NULL));
+  size_t out, in;
+  std::lock_guard<std::mutex> lock(m_MatcherMutex);
+  if (!getMatcher().find(pInputFile, pInputSection, out, in))
+    return std::make_pair(reinterpret_cast<Output*>(NULL),
+                          reinterpret_cast<Input*>(NULL));
+  Output* output = m_OutputDescList[out];
+  return std::make_pair(output, *(output->begin() + in));
 }
 
 SectionMap::const_iterator SectionMap::find(
@@ -237,6 +228,7 @@ std::pair<SectionMap::mapping, bool> SectionMap::insert(
     } else {
       Input* input = new Input(pInputSection, pPolicy);
       (*out)->append(input);
+      invalidateMatcher();
       return std::make_pair(std::make_pair(*out, input), true);
     }
   }
@@ -245,6 +237,7 @@ std::pair<SectionMap::mapping, bool> SectionMap::insert(
   m_OutputDescList.push_back(output);
   Input* input = new Input(pInputSection, pPolicy);
   output->append(input);
+  invalidateMatcher();
 
   return std::make_pair(std::make_pair(output, input), true);
 }
@@ -273,6 +266,7 @@ std::pair<SectionMap::mapping, bool> SectionMap::insert(
     } else {
       Input* input = new Input(pInputDesc);
       (*out)->append(input);
+      invalidateMatcher();
       return std::make_pair(std::make_pair(*out, input), true);
     }
   }
@@ -281,6 +275,7 @@ std::pair<SectionMap::mapping, bool> SectionMap::insert(
   m_OutputDescList.push_back(output);
   Input* input = new Input(pInputDesc);
   output->append(input);
+  invalidateMatcher();
 
   return std::make_pair(std::make_pair(output, input), true);
 }
@@ -290,45 +285,20 @@ SectionMap::iterator SectionMap::insert(iterator pPosition,
   Output* output = new Output(pSection->name());
   output->append(new Input(pSection->name(), InputSectDesc::NoKeep));
   output->setSection(pSection);
+  invalidateMatcher();
   return m_OutputDescList.insert(pPosition, output);
 }
 
-bool SectionMap::matched(const SectionMap::Input& pInput,
-                         const std::string& pInputFile,
-                         const std::string& pInputSection) const {
-  if (pInput.spec().hasFile() && !matched(pInput.spec().file(), pInputFile))
-    return false;
-
-  if (pInput.spec().hasExcludeFiles()) {
-    StringList::const_iterator file, fileEnd;
-    fileEnd = pInput.spec().excludeFiles().end();
-    for (file = pInput.spec().excludeFiles().begin(); file != fileEnd; ++file) {
-      if (matched(llvm::cast<WildcardPattern>(**file), pInputFile)) {
-        return false;
-      }
-    }
-  }
-
-  if (pInput.spec().hasSections()) {
-    StringList::const_iterator sect, sectEnd = pInput.spec().sections().end();
-    for (sect = pInput.spec().sections().begin(); sect != sectEnd; ++sect) {
-      if (matched(llvm::cast<WildcardPattern>(**sect), pInputSection)) {
-        return true;
-      }
-    }
-  }
-
-  return false;
+SectionMatcher& SectionMap::getMatcher() const {
+  if (m_pMatcher == NULL)
+    m_pMatcher = new SectionMatcher(*this);
+  return *m_pMatcher;
 }
 
-bool SectionMap::matched(const WildcardPattern& pPattern,
-                         const std::string& pName) const {
-  if (pPattern.isPrefix()) {
-    llvm::StringRef name(pName);
-    return name.startswith(pPattern.prefix());
-  } else {
-    return fnmatch0(pPattern.name().c_str(), pName.c_str());
-  }
+void SectionMap::invalidateMatcher() {
+  std::lock_guard<std::mutex> lock(m_MatcherMutex);
+  delete m_pMatcher;
+  m_pMatcher = NULL;
 }
 
 // fixupDotSymbols - ensure the dot symbols are valid
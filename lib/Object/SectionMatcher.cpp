@@ -0,0 +1,371 @@
+//===- SectionMatcher.cpp -------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "mcld/Object/SectionMatcher.h"
+
+#include "mcld/Script/StringList.h"
+#include "mcld/Script/WildcardPattern.h"
+
+#include <llvm/Support/Casting.h>
+
+#include <algorithm>
+#include <cassert>
+#if !defined(MCLD_ON_WIN32)
+#include <fnmatch.h>
+#define fnmatch0(pattern, string) (fnmatch(pattern, string, 0) == 0)
+#else
+#include <windows.h>
+#include <shlwapi.h>
+#define fnmatch0(pattern, string) (PathMatchSpec(string, pattern) == true)
+#endif
+
+namespace mcld {
+
+//===----------------------------------------------------------------------===//
+// SectionMatcher::Glob
+//===----------------------------------------------------------------------===//
+bool SectionMatcher::Glob::compile(const llvm::StringRef& pGlob) {
+#if defined(MCLD_ON_WIN32)
+  // PathMatchSpec has its own syntax
+  return false;
+#endif
+  tokens.clear();
+  size_t size = pGlob.size();
+  for (size_t i = 0; i < size; ++i) {
+    Token token;
+    token.star = false;
+    char c = pGlob[i];
+    if (c == '*') {
+      // consecutive stars are the same as one
+      if (!tokens.empty() && tokens.back().star)
+        continue;
+      token.star = true;
+      token.chars.set();
+    } else if (c == '?') {
+      token.chars.set();
+    } else if (c == '\\') {
+      if (i + 1 == size)
+        return false;
+      token.chars.set(static_cast<unsigned char>(pGlob[++i]));
+    } else if (c == '[') {
+      size_t j = i + 1;
+      bool negate = false;
+      if (j < size && (pGlob[j] == '!' || pGlob[j] == '^')) {
+        negate = true;
+        ++j;
+      }
+      // a ']' right after the '[' is a member of the set
+      std::bitset<256> set;
+      bool closed = false;
+      for (size_t first = j; j < size; ++j) {
+        if (pGlob[j] == ']' && j != first) {
+          closed = true;
+          break;
+        }
+        // leave the character classes and escapes to fnmatch
+        if (pGlob[j] == '\\' || (pGlob[j] == '[' && j + 1 < size &&
+                                 (pGlob[j + 1] == ':' || pGlob[j + 1] == '=' ||
+                                  pGlob[j + 1] == '.')))
+          return false;
+        unsigned char low = pGlob[j];
+        if (j + 2 < size && pGlob[j + 1] == '-' && pGlob[j + 2] != ']') {
+          unsigned char high = pGlob[j + 2];
+          for (unsigned ch = low; ch <= high; ++ch)
+            set.set(ch);
+          j += 2;
+        } else {
+          set.set(low);
+        }
+      }
+      // leave the unterminated '[' to fnmatch as well
+      if (!closed)
+        return false;
+      token.chars = negate ? ~set : set;
+      i = j;
+    } else {
+      token.chars.set(static_cast<unsigned char>(c));
+    }
+    tokens.push_back(token);
+  }
+  return true;
+}
+
+//===----------------------------------------------------------------------===//
+// SectionMatcher::GlobDFA
+//===----------------------------------------------------------------------===//
+const size_t SectionMatcher::GlobDFA::MaxStates;
+
+SectionMatcher::GlobDFA::GlobDFA() {
+}
+
+void SectionMatcher::GlobDFA::add(const Glob& pGlob, uint32_t pRule) {
+  m_Starts.push_back(m_Tokens.size());
+  for (size_t i = 0; i < pGlob.tokens.size(); ++i) {
+    m_Tokens.push_back(pGlob.tokens[i]);
+    m_IsEnd.push_back(false);
+    m_Rules.push_back(pRule);
+  }
+  // the end position
+  m_Tokens.push_back(Glob::Token());
+  m_IsEnd.push_back(true);
+  m_Rules.push_back(pRule);
+
+  // the states are built again for the new glob
+  m_States.clear();
+  m_StateMap.clear();
+}
+
+void SectionMatcher::GlobDFA::closure(PositionSet& pSet) const {
+  // a star may match the empty string
+  for (size_t i = 0; i < pSet.size(); ++i) {
+    uint32_t pos = pSet[i];
+    if (!m_IsEnd[pos] && m_Tokens[pos].star)
+      pSet.push_back(pos + 1);
+  }
+  std::sort(pSet.begin(), pSet.end());
+  pSet.erase(std::unique(pSet.begin(), pSet.end()), pSet.end());
+}
+
+uint32_t SectionMatcher::GlobDFA::getState(PositionSet& pSet) {
+  closure(pSet);
+  std::map<PositionSet, uint32_t>::iterator it = m_StateMap.find(pSet);
+  if (it != m_StateMap.end())
+    return it->second;
+
+  uint32_t id = m_States.size();
+  m_States.push_back(State());
+  State& state = m_States.back();
+  state.positions = pSet;
+  for (size_t i = 0; i < pSet.size(); ++i) {
+    if (m_IsEnd[pSet[i]])
+      state.accepts.push_back(m_Rules[pSet[i]]);
+  }
+  state.next.assign(256, -1);
+  m_StateMap.insert(std::make_pair(pSet, id));
+  return id;
+}
+
+void SectionMatcher::GlobDFA::reset() {
+  m_States.clear();
+  m_StateMap.clear();
+
+  // state 0 is the dead state, and state 1 is the start state
+  PositionSet dead;
+  getState(dead);
+  PositionSet start(m_Starts);
+  getState(start);
+}
+
+uint32_t SectionMatcher::GlobDFA::step(uint32_t pState, unsigned char pChar) {
+  int32_t next = m_States[pState].next[pChar];
+  if (next >= 0)
+    return next;
+
+  PositionSet set;
+  const PositionSet& positions = m_States[pState].positions;
+  for (size_t i = 0; i < positions.size(); ++i) {
+    uint32_t pos = positions[i];
+    if (m_IsEnd[pos])
+      continue;
+    if (m_Tokens[pos].star)
+      set.push_back(pos);
+    else if (m_Tokens[pos].chars.test(pChar))
+      set.push_back(pos + 1);
+  }
+  uint32_t id = getState(set);
+  m_States[pState].next[pChar] = id;
+  return id;
+}
+
+void SectionMatcher::GlobDFA::match(const llvm::StringRef& pName,
+                                    RuleList& pRules) {
+  if (empty())
+    return;
+
+  if (m_States.empty() || m_States.size() > MaxStates)
+    reset();
+
+  uint32_t state = 1;
+  for (size_t i = 0; i < pName.size(); ++i) {
+    state = step(state, pName[i]);
+    if (state == 0)
+      return;
+  }
+  const RuleList& accepts = m_States[state].accepts;
+  pRules.insert(pRules.end(), accepts.begin(), accepts.end());
+}
+
+//===----------------------------------------------------------------------===//
+// SectionMatcher::PrefixTrie
+//===----------------------------------------------------------------------===//
+SectionMatcher::PrefixTrie::PrefixTrie() : m_Nodes(1) {
+}
+
+int64_t SectionMatcher::PrefixTrie::getChild(uint32_t pNode,
+                                             char pChar) const {
+  const std::vector<std::pair<char, uint32_t> >& children =
+      m_Nodes[pNode].children;
+  for (size_t i = 0; i < children.size(); ++i) {
+    if (children[i].first == pChar)
+      return children[i].second;
+  }
+  return -1;
+}
+
+void SectionMatcher::PrefixTrie::add(const llvm::StringRef& pPrefix,
+                                     uint32_t pRule) {
+  uint32_t node = 0;
+  for (size_t i = 0; i < pPrefix.size(); ++i) {
+    int64_t child = getChild(node, pPrefix[i]);
+    if (child < 0) {
+      child = m_Nodes.size();
+      m_Nodes[node].children.push_back(std::make_pair(pPrefix[i], child));
+      m_Nodes.push_back(Node());
+    }
+    node = child;
+  }
+  m_Nodes[node].rules.push_back(pRule);
+}
+
+void SectionMatcher::PrefixTrie::match(const llvm::StringRef& pName,
+                                       RuleList& pRules) const {
+  uint32_t node = 0;
+  for (size_t i = 0;; ++i) {
+    const RuleList& rules = m_Nodes[node].rules;
+    pRules.insert(pRules.end(), rules.begin(), rules.end());
+    if (i == pName.size())
+      return;
+    int64_t child = getChild(node, pName[i]);
+    if (child < 0)
+      return;
+    node = child;
+  }
+}
+
+//===----------------------------------------------------------------------===//
+// SectionMatcher
+//===----------------------------------------------------------------------===//
+SectionMatcher::SectionMatcher(const SectionMap& pSectionMap) {
+  SectionMap::const_iterator out, outBegin = pSectionMap.begin(),
+                                  outEnd = pSectionMap.end();
+  for (out = outBegin; out != outEnd; ++out) {
+    SectionMap::Output::const_iterator in, inBegin = (*out)->begin(),
+                                           inEnd = (*out)->end();
+    for (in = inBegin; in != inEnd; ++in) {
+      uint32_t rule = m_Rules.size();
+      m_Rules.push_back(std::make_pair(out - outBegin, in - inBegin));
+      m_Inputs.push_back(*in);
+
+      if (!(*in)->spec().hasSections())
+        continue;
+      const StringList& sections = (*in)->spec().sections();
+      StringList::const_iterator sect, sectEnd = sections.end();
+      for (sect = sections.begin(); sect != sectEnd; ++sect)
+        addPattern(llvm::cast<WildcardPattern>(**sect), rule);
+    }
+  }
+}
+
+void SectionMatcher::addPattern(const WildcardPattern& pPattern,
+                                uint32_t pRule) {
+  if (pPattern.isPrefix()) {
+    m_Prefixes.add(pPattern.prefix(), pRule);
+    return;
+  }
+
+  if (pPattern.name().find_first_of("*?[\\") == std::string::npos) {
+    m_ExactNames[pPattern.name()].push_back(pRule);
+    return;
+  }
+
+  Glob glob;
+  if (glob.compile(pPattern.name()))
+    m_Globs.add(glob, pRule);
+  else
+    m_OtherGlobs.push_back(std::make_pair(&pPattern, pRule));
+}
+
+bool SectionMatcher::matched(const WildcardPattern& pPattern,
+                             const std::string& pName) {
+  if (pPattern.isPrefix()) {
+    llvm::StringRef name(pName);
+    return name.startswith(pPattern.prefix());
+  } else {
+    return fnmatch0(pPattern.name().c_str(), pName.c_str());
+  }
+}
+
+bool SectionMatcher::isFileMatched(uint32_t pRule,
+                                   const std::string& pInputFile) const {
+  const InputSectDesc::Spec& spec = m_Inputs[pRule]->spec();
+  if (spec.hasFile() && !matched(spec.file(), pInputFile))
+    return false;
+
+  if (spec.hasExcludeFiles()) {
+    StringList::const_iterator file, fileEnd = spec.excludeFiles().end();
+    for (file = spec.excludeFiles().begin(); file != fileEnd; ++file) {
+      if (matched(llvm::cast<WildcardPattern>(**file), pInputFile))
+        return false;
+    }
+  }
+  return true;
+}
+
+int64_t SectionMatcher::lookup(FileEntry& pFile,
+                               const std::string& pInputSection) {
+  // collect the rules whose section patterns match
+  RuleList rules;
+  llvm::StringMap<RuleList>::const_iterator exact =
+      m_ExactNames.find(pInputSection);
+  if (exact != m_ExactNames.end())
+    rules.insert(rules.end(), exact->second.begin(), exact->second.end());
+  m_Prefixes.match(pInputSection, rules);
+  m_Globs.match(pInputSection, rules);
+  for (size_t i = 0; i < m_OtherGlobs.size(); ++i) {
+    if (matched(*m_OtherGlobs[i].first, pInputSection))
+      rules.push_back(m_OtherGlobs[i].second);
+  }
+
+  // the first one whose file patterns match
+  std::sort(rules.begin(), rules.end());
+  for (size_t i = 0; i < rules.size(); ++i) {
+    if (pFile.fileMatched[rules[i]])
+      return rules[i];
+  }
+  return -1;
+}
+
+bool SectionMatcher::find(const std::string& pInputFile,
+                          const std::string& pInputSection,
+                          size_t& pOutIdx,
+                          size_t& pInIdx) {
+  FileEntry& file = m_Cache[pInputFile];
+  if (file.fileMatched.size() != m_Rules.size()) {
+    file.fileMatched.resize(m_Rules.size());
+    for (uint32_t rule = 0; rule < m_Rules.size(); ++rule)
+      file.fileMatched[rule] = isFileMatched(rule, pInputFile);
+  }
+
+  int64_t rule;
+  std::unordered_map<std::string, int64_t>::iterator it =
+      file.sections.find(pInputSection);
+  if (it != file.sections.end()) {
+    rule = it->second;
+  } else {
+    rule = lookup(file, pInputSection);
+    file.sections.insert(std::make_pair(pInputSection, rule));
+  }
+
+  if (rule < 0)
+    return false;
+  pOutIdx = m_Rules[rule].first;
+  pInIdx = m_Rules[rule].second;
+  return true;
+}
+
+}  // namespace mcld
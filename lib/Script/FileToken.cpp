@@ -9,13 +9,12 @@
 #include "mcld/Script/FileToken.h"
 
 #include "mcld/Support/GCFactory.h"
-
-#include <llvm/Support/ManagedStatic.h>
+#include "mcld/Support/LinkerContext.h"
 
 namespace mcld {
 
 typedef GCFactory<FileToken, MCLD_SYMBOLS_PER_INPUT> FileTokenFactory;
-static llvm::ManagedStatic<FileTokenFactory> g_FileTokenFactory;
+static ContextStatic<FileTokenFactory> g_FileTokenFactory;
 
 //===----------------------------------------------------------------------===//
 // FileToken
@@ -9,13 +9,12 @@
 #include "mcld/Script/NameSpec.h"
 
 #include "mcld/Support/GCFactory.h"
-
-#include <llvm/Support/ManagedStatic.h>
+#include "mcld/Support/LinkerContext.h"
 
 namespace mcld {
 
 typedef GCFactory<NameSpec, MCLD_SYMBOLS_PER_INPUT> NameSpecFactory;
-static llvm::ManagedStatic<NameSpecFactory> g_NameSpecFactory;
+static ContextStatic<NameSpecFactory> g_NameSpecFactory;
 
 //===----------------------------------------------------------------------===//
 // NameSpec
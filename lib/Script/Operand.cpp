@@ -12,10 +12,9 @@
 #include "mcld/LD/LDSection.h"
 #include "mcld/LD/SectionData.h"
 #include "mcld/Support/GCFactory.h"
+#include "mcld/Support/LinkerContext.h"
 #include "mcld/Support/raw_ostream.h"
 
-#include <llvm/Support/ManagedStatic.h>
-
 namespace mcld {
 
 //===----------------------------------------------------------------------===//
@@ -31,7 +30,7 @@ Operand::~Operand() {
 // SymOperand
 //===----------------------------------------------------------------------===//
 typedef GCFactory<SymOperand, MCLD_SYMBOLS_PER_INPUT> SymOperandFactory;
-static llvm::ManagedStatic<SymOperandFactory> g_SymOperandFactory;
+static ContextStatic<SymOperandFactory> g_SymOperandFactory;
 
 SymOperand::SymOperand() : Operand(Operand::SYMBOL), m_Value(0) {
 }
@@ -69,7 +68,7 @@ void SymOperand::clear() {
 // IntOperand
 //===----------------------------------------------------------------------===//
 typedef GCFactory<IntOperand, MCLD_SYMBOLS_PER_INPUT> IntOperandFactory;
-static llvm::ManagedStatic<IntOperandFactory> g_IntOperandFactory;
+static ContextStatic<IntOperandFactory> g_IntOperandFactory;
 
 IntOperand::IntOperand() : Operand(Operand::INTEGER), m_Value(0) {
 }
@@ -102,7 +101,7 @@ void IntOperand::clear() {
 // SectOperand
 //===----------------------------------------------------------------------===//
 typedef GCFactory<SectOperand, MCLD_SECTIONS_PER_INPUT> SectOperandFactory;
-static llvm::ManagedStatic<SectOperandFactory> g_SectOperandFactory;
+static ContextStatic<SectOperandFactory> g_SectOperandFactory;
 SectOperand::SectOperand() : Operand(Operand::SECTION) {
 }
 
@@ -135,7 +134,7 @@ void SectOperand::clear() {
 //===----------------------------------------------------------------------===//
 typedef GCFactory<SectDescOperand, MCLD_SECTIONS_PER_INPUT>
     SectDescOperandFactory;
-static llvm::ManagedStatic<SectDescOperandFactory> g_SectDescOperandFactory;
+static ContextStatic<SectDescOperandFactory> g_SectDescOperandFactory;
 SectDescOperand::SectDescOperand()
     : Operand(Operand::SECTION_DESC), m_pOutputDesc(NULL) {
 }
@@ -170,7 +169,7 @@ void SectDescOperand::clear() {
 // FragOperand
 //===----------------------------------------------------------------------===//
 typedef GCFactory<FragOperand, MCLD_SYMBOLS_PER_INPUT> FragOperandFactory;
-static llvm::ManagedStatic<FragOperandFactory> g_FragOperandFactory;
+static ContextStatic<FragOperandFactory> g_FragOperandFactory;
 
 FragOperand::FragOperand() : Operand(Operand::FRAGMENT), m_pFragment(NULL) {
 }
@@ -27,11 +27,11 @@
 #include "mcld/Script/StrToken.h"
 #include "mcld/MC/Input.h"
 #include "mcld/MC/InputBuilder.h"
+#include "mcld/Support/LinkerContext.h"
 #include "mcld/Support/MemoryArea.h"
 #include "mcld/InputTree.h"
 
 #include <llvm/Support/Casting.h>
-#include <llvm/Support/ManagedStatic.h>
 
 #include <cassert>
 
@@ -42,7 +42,7 @@ typedef HashEntry<std::string, void*, hash::StringCompare<std::string> >
 typedef HashTable<ParserStrEntry,
                   hash::StringHash<hash::DJB>,
                   EntryFactory<ParserStrEntry> > ParserStrPool;
-static llvm::ManagedStatic<ParserStrPool> g_ParserStrPool;
+static ContextStatic<ParserStrPool> g_ParserStrPool;
 
 //===----------------------------------------------------------------------===//
 // ScriptFile
@@ -9,13 +9,12 @@
 #include "mcld/Script/StrToken.h"
 
 #include "mcld/Support/GCFactory.h"
-
-#include <llvm/Support/ManagedStatic.h>
+#include "mcld/Support/LinkerContext.h"
 
 namespace mcld {
 
 typedef GCFactory<StrToken, MCLD_SYMBOLS_PER_INPUT> StrTokenFactory;
-static llvm::ManagedStatic<StrTokenFactory> g_StrTokenFactory;
+static ContextStatic<StrTokenFactory> g_StrTokenFactory;
 
 //===----------------------------------------------------------------------===//
 // StrToken
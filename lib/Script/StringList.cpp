@@ -10,14 +10,13 @@
 
 #include "mcld/Script/StrToken.h"
 #include "mcld/Support/GCFactory.h"
+#include "mcld/Support/LinkerContext.h"
 #include "mcld/Support/raw_ostream.h"
 
-#include <llvm/Support/ManagedStatic.h>
-
 namespace mcld {
 
 typedef GCFactory<StringList, MCLD_SYMBOLS_PER_INPUT> StringListFactory;
-static llvm::ManagedStatic<StringListFactory> g_StringListFactory;
+static ContextStatic<StringListFactory> g_StringListFactory;
 
 //===----------------------------------------------------------------------===//
 // StringList
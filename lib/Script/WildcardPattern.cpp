@@ -9,16 +9,16 @@
 #include "mcld/Script/WildcardPattern.h"
 
 #include "mcld/Support/GCFactory.h"
+#include "mcld/Support/LinkerContext.h"
 #include "mcld/Support/raw_ostream.h"
 
-#include <llvm/Support/ManagedStatic.h>
 #include <cassert>
 
 namespace mcld {
 
 typedef GCFactory<WildcardPattern, MCLD_SYMBOLS_PER_INPUT>
     WildcardPatternFactory;
-static llvm::ManagedStatic<WildcardPatternFactory> g_WildcardPatternFactory;
+static ContextStatic<WildcardPatternFactory> g_WildcardPatternFactory;
 
 //===----------------------------------------------------------------------===//
 // WildcardPattern
@@ -60,6 +60,9 @@ inline static int oflag(FileHandle::OpenMode pMode) {
   if (FileHandle::Truncate == (pMode & FileHandle::Truncate))
     result |= O_TRUNC;
 
+  if (FileHandle::Exclusive == (pMode & FileHandle::Exclusive))
+    result |= O_EXCL;
+
   return result;
 }
 
@@ -8,41 +8,115 @@
 //===----------------------------------------------------------------------===//
 #include "mcld/Support/FileOutputBuffer.h"
 #include "mcld/Support/FileHandle.h"
+#include "mcld/Support/FileSystem.h"
 #include "mcld/Support/Path.h"
 
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/Process.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
 namespace mcld {
 
+namespace {
+
+/// the size of a window that commit() writes at once. The windows are
+/// aligned to their size in the file.
+const size_t kWindowSize = 8 * 1024 * 1024;
+
+/// isZero - whether pLength bytes at pData are all zero
+bool isZero(const uint8_t* pData, size_t pLength) {
+  return (pLength == 0) ||
+         (pData[0] == 0 && std::memcmp(pData, pData + 1, pLength - 1) == 0);
+}
+
+/// createStaging - map a new unlinked temporary file of pSize bytes. The
+/// file is sparse, so the pages that are never written cost nothing.
+std::error_code createStaging(
+    size_t pSize,
+    std::unique_ptr<llvm::sys::fs::mapped_file_region>& pResult) {
+  int fd = -1;
+  llvm::SmallString<128> path;
+  std::error_code ec =
+      llvm::sys::fs::createTemporaryFile("mcld-output", "tmp", fd, path);
+  if (ec)
+    return ec;
+  // the mapping keeps the file until it is unmapped
+  llvm::sys::fs::remove(path.str());
+
+  // an empty mapping is invalid
+  size_t size = std::max<size_t>(pSize, 1);
+  ec = llvm::sys::fs::resize_file(fd, size);
+  if (!ec) {
+    pResult.reset(new llvm::sys::fs::mapped_file_region(
+        fd, llvm::sys::fs::mapped_file_region::readwrite, size, 0, ec));
+    if (ec)
+      pResult.reset();
+  }
+  llvm::sys::Process::SafelyCloseFileDescriptor(fd);
+  return ec;
+}
+
+}  // anonymous namespace
+
+//===----------------------------------------------------------------------===//
+// FileOutputBuffer
+//===----------------------------------------------------------------------===//
 FileOutputBuffer::FileOutputBuffer(llvm::sys::fs::mapped_file_region* pRegion,
-                                   FileHandle& pFileHandle)
-    : m_pRegion(pRegion), m_FileHandle(pFileHandle) {
+                                   size_t pSize,
+                                   FileHandle& pFileHandle,
+                                   bool pStreamed)
+    : m_pRegion(pRegion),
+      m_pData(reinterpret_cast<uint8_t*>(pRegion->data())),
+      m_Size(pSize),
+      m_FileHandle(pFileHandle),
+      m_bStreamed(pStreamed),
+      m_bCommitted(false) {
 }
 
 FileOutputBuffer::~FileOutputBuffer() {
-  // Unmap buffer, letting OS flush dirty pages to file on disk.
+  // Unmap buffer, letting OS flush dirty pages to file on disk. The staging
+  // of a streamed buffer is dropped with it, committed or not.
   m_pRegion.reset();
 }
 
 std::error_code
 FileOutputBuffer::create(FileHandle& pFileHandle,
                          size_t pSize,
-                         std::unique_ptr<FileOutputBuffer>& pResult) {
+                         std::unique_ptr<FileOutputBuffer>& pResult,
+                         uint64_t pStreamThreshold) {
   std::error_code ec;
 
-  // Resize the file before mapping the file region.
+  // Resize the file before mapping the file region. The streamed output
+  // leaves the holes of the file unwritten.
   ec = llvm::sys::fs::resize_file(pFileHandle.handler(), pSize);
   if (ec)
     return ec;
 
-  std::unique_ptr<llvm::sys::fs::mapped_file_region> mapped_file(
-      new llvm::sys::fs::mapped_file_region(pFileHandle.handler(),
-          llvm::sys::fs::mapped_file_region::readwrite, pSize, 0, ec));
+  if (pSize < pStreamThreshold) {
+    std::unique_ptr<llvm::sys::fs::mapped_file_region> mapped_file(
+        new llvm::sys::fs::mapped_file_region(pFileHandle.handler(),
+            llvm::sys::fs::mapped_file_region::readwrite, pSize, 0, ec));
+    if (!ec) {
+      pResult.reset(
+          new FileOutputBuffer(mapped_file.get(), pSize, pFileHandle, false));
+      if (pResult)
+        mapped_file.release();
+      return std::error_code();
+    }
+    // the file system does not support shared writable mappings
+  }
+
+  std::unique_ptr<llvm::sys::fs::mapped_file_region> staging;
+  ec = createStaging(pSize, staging);
   if (ec)
     return ec;
 
-  pResult.reset(new FileOutputBuffer(mapped_file.get(), pFileHandle));
+  pResult.reset(new FileOutputBuffer(staging.get(), pSize, pFileHandle, true));
   if (pResult)
-    mapped_file.release();
-
+    staging.release();
   return std::error_code();
 }
 
@@ -56,4 +130,32 @@ llvm::StringRef FileOutputBuffer::getPath() const {
   return m_FileHandle.path().native();
 }
 
+std::error_code FileOutputBuffer::commit() {
+  if (!isStreamed() || m_bCommitted)
+    return std::error_code();
+  m_bCommitted = true;
+
+  for (size_t window = 0; window < m_Size; window += kWindowSize) {
+    size_t length = std::min(kWindowSize, m_Size - window);
+    if (isZero(m_pData + window, length))
+      continue;
+
+    size_t written = 0;
+    while (written < length) {
+      ssize_t result =
+          sys::fs::detail::pwrite(m_FileHandle.handler(),
+                                  m_pData + window + written,
+                                  length - written,
+                                  window + written);
+      if (result < 0) {
+        if (errno == EINTR)
+          continue;
+        return std::error_code(errno, std::generic_category());
+      }
+      written += result;
+    }
+  }
+  return std::error_code();
+}
+
 }  // namespace mcld
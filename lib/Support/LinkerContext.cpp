@@ -0,0 +1,105 @@
+//===- LinkerContext.cpp --------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "mcld/Support/LinkerContext.h"
+
+#include "mcld/LD/DiagnosticEngine.h"
+
+#include <cassert>
+
+namespace mcld {
+
+/// t_pCurrent - the current context of this thread, NULL for the default one
+static thread_local LinkerContext* t_pCurrent = NULL;
+
+//===----------------------------------------------------------------------===//
+// LinkerContext::Scope
+//===----------------------------------------------------------------------===//
+LinkerContext::Scope::Scope(LinkerContext& pContext)
+    : m_pPrevious(t_pCurrent) {
+  t_pCurrent = &pContext;
+}
+
+LinkerContext::Scope::~Scope() {
+  t_pCurrent = m_pPrevious;
+}
+
+//===----------------------------------------------------------------------===//
+// LinkerContext
+//===----------------------------------------------------------------------===//
+LinkerContext::LinkerContext() : m_pDiagEngine(new DiagnosticEngine()) {
+  for (unsigned slot = 0; slot < MaxSlots; ++slot) {
+    m_Objects[slot].object = NULL;
+    m_Objects[slot].deleter = NULL;
+  }
+}
+
+LinkerContext::~LinkerContext() {
+  release();
+  delete m_pDiagEngine;
+}
+
+LinkerContext& LinkerContext::current() {
+  if (t_pCurrent != NULL)
+    return *t_pCurrent;
+  return global();
+}
+
+LinkerContext& LinkerContext::global() {
+  // The default context is never destroyed, as the ManagedStatics it
+  // replaces, so that the objects in it outlive all static destructors.
+  static LinkerContext* context = new LinkerContext();
+  return *context;
+}
+
+unsigned LinkerContext::registerSlot() {
+  static std::atomic<unsigned> num_slots(0);
+  unsigned slot = num_slots++;
+  assert(slot < MaxSlots && "Too many ContextStatics!");
+  return slot;
+}
+
+void* LinkerContext::getObject(unsigned pSlot,
+                               CreatorTy pCreator,
+                               DeleterTy pDeleter) {
+  Entry& entry = m_Objects[pSlot];
+  void* object = entry.object.load(std::memory_order_acquire);
+  if (object != NULL)
+    return object;
+
+  // the workers of parallelFor may race to create the same slot
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+  object = entry.object.load(std::memory_order_relaxed);
+  if (object == NULL) {
+    object = pCreator();
+    entry.deleter = pDeleter;
+    m_Order.push_back(pSlot);
+    entry.object.store(object, std::memory_order_release);
+  }
+  return object;
+}
+
+void LinkerContext::release() {
+  // An object may refer to the objects created before it, so destroy them
+  // in the reverse order. The destructors may still reach the context, so
+  // every entry is reset before its object is destroyed.
+  std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+  while (!m_Order.empty()) {
+    Entry& entry = m_Objects[m_Order.back()];
+    m_Order.pop_back();
+
+    void* object = entry.object.load(std::memory_order_relaxed);
+    DeleterTy deleter = entry.deleter;
+    entry.object.store(NULL, std::memory_order_relaxed);
+    entry.deleter = NULL;
+    assert(deleter != NULL);
+    deleter(object);
+  }
+}
+
+}  // namespace mcld
@@ -7,6 +7,7 @@
 //
 //===----------------------------------------------------------------------===//
 #include "mcld/Support/MemoryAreaFactory.h"
+#include "mcld/LD/InputCache.h"
 #include "mcld/Support/MsgHandling.h"
 #include "mcld/Support/SystemUtils.h"
 
@@ -26,7 +27,11 @@ MemoryArea* MemoryAreaFactory::produce(const sys::fs::Path& pPath,
                                        FileHandle::OpenMode pMode) {
   llvm::StringRef name(pPath.native());
   if (m_AreaMap.find(name) == m_AreaMap.end()) {
-    MemoryArea* result = allocate();
+    MemoryArea* result = produceCached(pPath);
+    if (result != NULL)
+      return result;
+
+    result = allocate();
     new (result) MemoryArea(name);
     m_AreaMap[name] = result;
     return result;
@@ -40,7 +45,11 @@ MemoryArea* MemoryAreaFactory::produce(const sys::fs::Path& pPath,
                                        FileHandle::Permission pPerm) {
   llvm::StringRef name(pPath.native());
   if (m_AreaMap.find(name) == m_AreaMap.end()) {
-    MemoryArea* result = allocate();
+    MemoryArea* result = produceCached(pPath);
+    if (result != NULL)
+      return result;
+
+    result = allocate();
     new (result) MemoryArea(name);
     m_AreaMap[name] = result;
     return result;
@@ -67,7 +76,23 @@ MemoryArea* MemoryAreaFactory::produce(int pFD, FileHandle::OpenMode pMode) {
   return NULL;
 }
 
+MemoryArea* MemoryAreaFactory::produceCached(const sys::fs::Path& pPath) {
+  InputCache* cache = InputCache::Get();
+  if (cache == NULL)
+    return NULL;
+
+  // the area is owned by the cache and outlives this factory
+  MemoryArea* result = cache->getMemoryArea(pPath);
+  if (result != NULL)
+    m_AreaMap[pPath.native()] = result;
+  return result;
+}
+
 void MemoryAreaFactory::destruct(MemoryArea* pArea) {
+  InputCache* cache = InputCache::Get();
+  if (cache != NULL && cache->isCached(pArea))
+    return;
+
   destroy(pArea);
   deallocate(pArea);
 }
@@ -0,0 +1,114 @@
+//===- SHA1.cpp -----------------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "mcld/Support/SHA1.h"
+
+#include <cstring>
+
+namespace mcld {
+
+static inline uint32_t rotl(uint32_t pValue, unsigned pBits) {
+  return (pValue << pBits) | (pValue >> (32 - pBits));
+}
+
+//===----------------------------------------------------------------------===//
+// SHA1
+//===----------------------------------------------------------------------===//
+SHA1::SHA1() : m_Length(0) {
+  m_State[0] = 0x67452301;
+  m_State[1] = 0xEFCDAB89;
+  m_State[2] = 0x98BADCFE;
+  m_State[3] = 0x10325476;
+  m_State[4] = 0xC3D2E1F0;
+}
+
+void SHA1::update(const uint8_t* pData, size_t pSize) {
+  size_t used = m_Length % 64;
+  m_Length += pSize;
+
+  // fill up the pending block first
+  if (used != 0) {
+    size_t fill = 64 - used;
+    if (pSize < fill) {
+      std::memcpy(m_Buffer + used, pData, pSize);
+      return;
+    }
+    std::memcpy(m_Buffer + used, pData, fill);
+    processBlock(m_Buffer);
+    pData += fill;
+    pSize -= fill;
+  }
+
+  for (; pSize >= 64; pData += 64, pSize -= 64)
+    processBlock(pData);
+
+  std::memcpy(m_Buffer, pData, pSize);
+}
+
+void SHA1::final(uint8_t pResult[DigestSize]) {
+  uint64_t bit_length = m_Length * 8;
+
+  // pad with 0x80 and zeros up to 56 bytes mod 64, then the bit length
+  uint8_t padding[72] = { 0x80 };
+  size_t used = m_Length % 64;
+  size_t pad_size = (used < 56) ? (56 - used) : (120 - used);
+  for (unsigned i = 0; i < 8; ++i)
+    padding[pad_size + i] = static_cast<uint8_t>(bit_length >> (56 - 8 * i));
+  update(padding, pad_size + 8);
+
+  for (unsigned i = 0; i < 5; ++i) {
+    pResult[4 * i] = static_cast<uint8_t>(m_State[i] >> 24);
+    pResult[4 * i + 1] = static_cast<uint8_t>(m_State[i] >> 16);
+    pResult[4 * i + 2] = static_cast<uint8_t>(m_State[i] >> 8);
+    pResult[4 * i + 3] = static_cast<uint8_t>(m_State[i]);
+  }
+}
+
+void SHA1::processBlock(const uint8_t* pBlock) {
+  uint32_t w[80];
+  for (unsigned i = 0; i < 16; ++i) {
+    const uint8_t* word = pBlock + 4 * i;
+    w[i] = (uint32_t(word[0]) << 24) | (uint32_t(word[1]) << 16) |
+           (uint32_t(word[2]) << 8) | uint32_t(word[3]);
+  }
+  for (unsigned i = 16; i < 80; ++i)
+    w[i] = rotl(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+  uint32_t a = m_State[0], b = m_State[1], c = m_State[2], d = m_State[3],
+           e = m_State[4];
+  for (unsigned i = 0; i < 80; ++i) {
+    uint32_t f, k;
+    if (i < 20) {
+      f = (b & c) | (~b & d);
+      k = 0x5A827999;
+    } else if (i < 40) {
+      f = b ^ c ^ d;
+      k = 0x6ED9EBA1;
+    } else if (i < 60) {
+      f = (b & c) | (b & d) | (c & d);
+      k = 0x8F1BBCDC;
+    } else {
+      f = b ^ c ^ d;
+      k = 0xCA62C1D6;
+    }
+    uint32_t temp = rotl(a, 5) + f + e + k + w[i];
+    e = d;
+    d = c;
+    c = rotl(b, 30);
+    b = a;
+    a = temp;
+  }
+
+  m_State[0] += a;
+  m_State[1] += b;
+  m_State[2] += c;
+  m_State[3] += d;
+  m_State[4] += e;
+}
+
+}  // namespace mcld
@@ -0,0 +1,103 @@
+//===- XXHash.cpp ---------------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "mcld/Support/XXHash.h"
+
+#include <cstring>
+
+namespace mcld {
+
+static const uint64_t Prime1 = 11400714785074694791ULL;
+static const uint64_t Prime2 = 14029467366897019727ULL;
+static const uint64_t Prime3 = 1609587929392839161ULL;
+static const uint64_t Prime4 = 9650029242287828579ULL;
+static const uint64_t Prime5 = 2870177450012600261ULL;
+
+static inline uint64_t rotl(uint64_t pValue, unsigned pBits) {
+  return (pValue << pBits) | (pValue >> (64 - pBits));
+}
+
+/// read64/read32 - xxHash reads its input as little-endian words
+static inline uint64_t read64(const uint8_t* pData) {
+  uint64_t result = 0;
+  for (unsigned i = 0; i < 8; ++i)
+    result |= uint64_t(pData[i]) << (8 * i);
+  return result;
+}
+
+static inline uint32_t read32(const uint8_t* pData) {
+  return uint32_t(pData[0]) | (uint32_t(pData[1]) << 8) |
+         (uint32_t(pData[2]) << 16) | (uint32_t(pData[3]) << 24);
+}
+
+static inline uint64_t xxRound(uint64_t pAcc, uint64_t pInput) {
+  pAcc += pInput * Prime2;
+  pAcc = rotl(pAcc, 31);
+  return pAcc * Prime1;
+}
+
+static inline uint64_t mergeRound(uint64_t pAcc, uint64_t pValue) {
+  pAcc ^= xxRound(0, pValue);
+  return pAcc * Prime1 + Prime4;
+}
+
+uint64_t xxHash64(const uint8_t* pData, size_t pSize, uint64_t pSeed) {
+  const uint8_t* end = pData + pSize;
+  uint64_t hash;
+
+  if (pSize >= 32) {
+    uint64_t v1 = pSeed + Prime1 + Prime2;
+    uint64_t v2 = pSeed + Prime2;
+    uint64_t v3 = pSeed;
+    uint64_t v4 = pSeed - Prime1;
+    const uint8_t* limit = end - 32;
+    do {
+      v1 = xxRound(v1, read64(pData));
+      v2 = xxRound(v2, read64(pData + 8));
+      v3 = xxRound(v3, read64(pData + 16));
+      v4 = xxRound(v4, read64(pData + 24));
+      pData += 32;
+    } while (pData <= limit);
+
+    hash = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+    hash = mergeRound(hash, v1);
+    hash = mergeRound(hash, v2);
+    hash = mergeRound(hash, v3);
+    hash = mergeRound(hash, v4);
+  } else {
+    hash = pSeed + Prime5;
+  }
+
+  hash += static_cast<uint64_t>(pSize);
+
+  for (; pData + 8 <= end; pData += 8) {
+    hash ^= xxRound(0, read64(pData));
+    hash = rotl(hash, 27) * Prime1 + Prime4;
+  }
+
+  if (pData + 4 <= end) {
+    hash ^= static_cast<uint64_t>(read32(pData)) * Prime1;
+    hash = rotl(hash, 23) * Prime2 + Prime3;
+    pData += 4;
+  }
+
+  for (; pData < end; ++pData) {
+    hash ^= (*pData) * Prime5;
+    hash = rotl(hash, 11) * Prime1;
+  }
+
+  // final avalanche
+  hash ^= hash >> 33;
+  hash *= Prime2;
+  hash ^= hash >> 29;
+  hash *= Prime3;
+  hash ^= hash >> 32;
+  return hash;
+}
+
+}  // namespace mcld
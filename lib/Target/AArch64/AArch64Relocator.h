@@ -10,6 +10,7 @@
 #define TARGET_AARCH64_AARCH64RELOCATOR_H_
 
 #include "mcld/LD/Relocator.h"
+#include "mcld/LD/ResolveInfo.h"
 #include "mcld/Target/GOT.h"
 #include "mcld/Target/KeyEntryMap.h"
 #include "AArch64LDBackend.h"
@@ -96,6 +97,12 @@ class AArch64Relocator : public Relocator {
                       LDSection& pSection,
                       Input& pInput);
 
+  /// mayApplyConcurrently - a relocation whose symbol reserves no GOT, PLT
+  /// or dynamic relocation entry only writes its own target data.
+  bool mayApplyConcurrently(const Relocation& pReloc) const {
+    return pReloc.symInfo()->reserved() == None;
+  }
+
   /// getDebugStringOffset - get the offset from the relocation target. This is
   /// used to get the debug string offset.
   uint32_t getDebugStringOffset(Relocation& pReloc) const;
@@ -45,6 +45,7 @@
 #include <llvm/Support/ELF.h>
 
 #include <cstring>
+#include <vector>
 
 namespace mcld {
 
@@ -506,11 +507,21 @@ void ARMGNULDBackend::setUpReachedSectionsForGC(
         // 1. set up the reference according to relocations
         bool add_first = false;
         GarbageCollection::SectionListTy* reached_sects = NULL;
-        RelocData::iterator reloc_it, rEnd = reloc_sect->getRelocData()->end();
-        for (reloc_it = reloc_sect->getRelocData()->begin(); reloc_it != rEnd;
-             ++reloc_it) {
-          Relocation* reloc = llvm::cast<Relocation>(reloc_it);
-          ResolveInfo* sym = reloc->symInfo();
+        // the relocations are still packed, unless a reader added them
+        const RelocData* reloc_data = reloc_sect->getRelocData();
+        std::vector<const ResolveInfo*> syms;
+        if (reloc_data->hasPacked()) {
+          for (size_t i = 0, e = reloc_data->numOfPacked(); i != e; ++i)
+            syms.push_back(reloc_data->getSymInfo(i));
+        } else {
+          RelocData::const_iterator reloc, rEnd = reloc_data->end();
+          for (reloc = reloc_data->begin(); reloc != rEnd; ++reloc)
+            syms.push_back(reloc->symInfo());
+        }
+
+        std::vector<const ResolveInfo*>::iterator sym_it, sEnd = syms.end();
+        for (sym_it = syms.begin(); sym_it != sEnd; ++sym_it) {
+          const ResolveInfo* sym = *sym_it;
           // only the target symbols defined in the input fragments can make the
           // reference
           if (sym == NULL)
@@ -651,115 +662,81 @@ bool ARMGNULDBackend::doRelax(Module& pModule,
 
   bool isRelaxed = false;
   ELFFileFormat* file_format = getOutputFormat();
-  // check branch relocs and create the related stubs if needed
-  Module::obj_iterator input, inEnd = pModule.obj_end();
-  for (input = pModule.obj_begin(); input != inEnd; ++input) {
-    LDContext::sect_iterator rs, rsEnd = (*input)->context()->relocSectEnd();
-    for (rs = (*input)->context()->relocSectBegin(); rs != rsEnd; ++rs) {
-      if (LDFileFormat::Ignore == (*rs)->kind() || !(*rs)->hasRelocData())
-        continue;
-      RelocData::iterator reloc, rEnd = (*rs)->getRelocData()->end();
-      for (reloc = (*rs)->getRelocData()->begin(); reloc != rEnd; ++reloc) {
-        Relocation* relocation = llvm::cast<Relocation>(reloc);
-
-        switch (relocation->type()) {
-          case llvm::ELF::R_ARM_PC24:
-          case llvm::ELF::R_ARM_CALL:
-          case llvm::ELF::R_ARM_JUMP24:
-          case llvm::ELF::R_ARM_PLT32:
-          case llvm::ELF::R_ARM_THM_CALL:
-          case llvm::ELF::R_ARM_THM_XPC22:
-          case llvm::ELF::R_ARM_THM_JUMP24:
-          case llvm::ELF::R_ARM_THM_JUMP19: {
-            // calculate the possible symbol value
-            uint64_t sym_value = 0x0;
-            LDSymbol* symbol = relocation->symInfo()->outSymbol();
-            if (symbol->hasFragRef()) {
-              uint64_t value = symbol->fragRef()->getOutputOffset();
-              uint64_t addr =
-                  symbol->fragRef()->frag()->getParent()->getSection().addr();
-              sym_value = addr + value;
-            }
-            if ((relocation->symInfo()->reserved() &
-                 ARMRelocator::ReservePLT) != 0x0) {
-              // FIXME: we need to find out the address of the specific plt
-              // entry
-              assert(file_format->hasPLT());
-              sym_value = file_format->getPLT().addr();
-            }
-            Stub* stub = getStubFactory()->create(*relocation,  // relocation
-                                                  sym_value,    // symbol value
-                                                  pBuilder,
-                                                  *getBRIslandFactory());
-            if (stub != NULL) {
-              switch (config().options().getStripSymbolMode()) {
-                case GeneralOptions::StripSymbolMode::StripAllSymbols:
-                case GeneralOptions::StripSymbolMode::StripLocals:
-                  break;
-                default: {
-                  // a stub symbol should be local
-                  assert(stub->symInfo() != NULL && stub->symInfo()->isLocal());
-                  LDSection& symtab = file_format->getSymTab();
-                  LDSection& strtab = file_format->getStrTab();
-
-                  // increase the size of .symtab and .strtab if needed
-                  if (config().targets().is32Bits())
-                    symtab.setSize(symtab.size() +
-                                   sizeof(llvm::ELF::Elf32_Sym));
-                  else
-                    symtab.setSize(symtab.size() +
-                                   sizeof(llvm::ELF::Elf64_Sym));
-                  symtab.setInfo(symtab.getInfo() + 1);
-                  strtab.setSize(strtab.size() + stub->symInfo()->nameSize() +
-                                 1);
-                }
-              }  // end of switch
-              isRelaxed = true;
-            }
-            break;
-          }
-          case llvm::ELF::R_ARM_V4BX:
-            /* FIXME: bypass R_ARM_V4BX relocation now */
-            break;
-          default:
-            break;
-        }  // end of switch
-      }  // for all relocations
-    }  // for all relocation section
-  }  // for all inputs
-
-  // find the first fragment w/ invalid offset due to stub insertion
-  Fragment* invalid = NULL;
-  pFinished = true;
-  for (BranchIslandFactory::iterator island = getBRIslandFactory()->begin(),
-                                     island_end = getBRIslandFactory()->end();
-       island != island_end;
-       ++island) {
-    if ((*island).end() == file_format->getText().getSectionData()->end())
-      break;
-
-    Fragment* exit = (*island).end();
-    if (((*island).offset() + (*island).size()) > exit->getOffset()) {
-      invalid = exit;
-      pFinished = false;
-      break;
+  // check the moved branches and create the related stubs if needed
+  RelaxWorklist& worklist = getRelaxWorklist();
+  for (RelaxWorklist::iterator branch = worklist.begin(),
+                               bEnd = worklist.end();
+       branch != bEnd;
+       ++branch) {
+    Relocation* relocation = (*branch).reloc;
+    // calculate the possible symbol value
+    uint64_t sym_value = 0x0;
+    LDSymbol* symbol = relocation->symInfo()->outSymbol();
+    if (symbol->hasFragRef()) {
+      uint64_t value = symbol->fragRef()->getOutputOffset();
+      uint64_t addr =
+          symbol->fragRef()->frag()->getParent()->getSection().addr();
+      sym_value = addr + value;
     }
-  }
+    if ((relocation->symInfo()->reserved() & ARMRelocator::ReservePLT) !=
+        0x0) {
+      // FIXME: we need to find out the address of the specific plt entry
+      assert(file_format->hasPLT());
+      sym_value = file_format->getPLT().addr();
+    }
+    if (!isBranchMoved(*branch, sym_value))
+      continue;
+
+    Stub* stub = getStubFactory()->create(*relocation,  // relocation
+                                          sym_value,    // symbol value
+                                          pBuilder,
+                                          *getBRIslandFactory());
+    if (stub != NULL) {
+      switch (config().options().getStripSymbolMode()) {
+        case GeneralOptions::StripSymbolMode::StripAllSymbols:
+        case GeneralOptions::StripSymbolMode::StripLocals:
+          break;
+        default: {
+          // a stub symbol should be local
+          assert(stub->symInfo() != NULL && stub->symInfo()->isLocal());
+          LDSection& symtab = file_format->getSymTab();
+          LDSection& strtab = file_format->getStrTab();
+
+          // increase the size of .symtab and .strtab if needed
+          if (config().targets().is32Bits())
+            symtab.setSize(symtab.size() + sizeof(llvm::ELF::Elf32_Sym));
+          else
+            symtab.setSize(symtab.size() + sizeof(llvm::ELF::Elf64_Sym));
+          symtab.setInfo(symtab.getInfo() + 1);
+          strtab.setSize(strtab.size() + stub->symInfo()->nameSize() + 1);
+        }
+      }  // end of switch
+      isRelaxed = true;
+    }
+  }  // for all moved branches
 
-  // reset the offset of invalid fragments
-  while (invalid != NULL) {
-    invalid->setOffset(invalid->getPrevNode()->getOffset() +
-                       invalid->getPrevNode()->size());
-    invalid = invalid->getNextNode();
-  }
+  // re-lay out the sections after the islands that have outgrown
+  relayoutIslands(isRelaxed, pFinished);
+  return isRelaxed;
+}
 
-  // reset the size of .text
-  if (isRelaxed) {
-    file_format->getText().setSize(
-        file_format->getText().getSectionData()->back().getOffset() +
-        file_format->getText().getSectionData()->back().size());
+/// mayRelaxBranch
+bool ARMGNULDBackend::mayRelaxBranch(const Relocation& pReloc) const {
+  switch (pReloc.type()) {
+    case llvm::ELF::R_ARM_PC24:
+    case llvm::ELF::R_ARM_CALL:
+    case llvm::ELF::R_ARM_JUMP24:
+    case llvm::ELF::R_ARM_PLT32:
+    case llvm::ELF::R_ARM_THM_CALL:
+    case llvm::ELF::R_ARM_THM_XPC22:
+    case llvm::ELF::R_ARM_THM_JUMP24:
+    case llvm::ELF::R_ARM_THM_JUMP19:
+      return true;
+    case llvm::ELF::R_ARM_V4BX:
+      /* FIXME: bypass R_ARM_V4BX relocation now */
+    default:
+      return false;
   }
-  return isRelaxed;
 }
 
 /// initTargetStubs
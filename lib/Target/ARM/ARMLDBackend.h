@@ -155,6 +155,9 @@ class ARMGNULDBackend : public GNULDBackend {
   /// otherwise set it to false.
   bool doRelax(Module& pModule, IRBuilder& pBuilder, bool& pFinished);
 
+  /// mayRelaxBranch - return true if pReloc is a branch that may need a stub
+  bool mayRelaxBranch(const Relocation& pReloc) const;
+
   /// initTargetStubs
   bool initTargetStubs();
 
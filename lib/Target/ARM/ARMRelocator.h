@@ -10,6 +10,7 @@
 #define TARGET_ARM_ARMRELOCATOR_H_
 
 #include "mcld/LD/Relocator.h"
+#include "mcld/LD/ResolveInfo.h"
 #include "mcld/Target/GOT.h"
 #include "mcld/Target/KeyEntryMap.h"
 #include "ARMLDBackend.h"
@@ -92,6 +93,12 @@ class ARMRelocator : public Relocator {
                       LDSection& pSection,
                       Input& pInput);
 
+  /// mayApplyConcurrently - a relocation whose symbol reserves no GOT, PLT
+  /// or dynamic relocation entry only writes its own target data.
+  bool mayApplyConcurrently(const Relocation& pReloc) const {
+    return pReloc.symInfo()->reserved() == None;
+  }
+
   /// mayHaveFunctionPointerAccess - check if the given reloc would possibly
   /// access a function pointer.
   virtual bool mayHaveFunctionPointerAccess(const Relocation& pReloc) const;
@@ -14,9 +14,11 @@
 #include "mcld/LinkerScript.h"
 #include "mcld/Module.h"
 #include "mcld/ADT/SizeTraits.h"
+#include "mcld/ADT/StringHash.h"
 #include "mcld/Config/Config.h"
 #include "mcld/Fragment/FillFragment.h"
 #include "mcld/LD/BranchIslandFactory.h"
+#include "mcld/LD/BuildID.h"
 #include "mcld/LD/EhFrame.h"
 #include "mcld/LD/EhFrameHdr.h"
 #include "mcld/LD/ELFDynObjFileFormat.h"
@@ -29,6 +31,7 @@
 #include "mcld/LD/LDSymbol.h"
 #include "mcld/LD/RelocData.h"
 #include "mcld/LD/RelocationFactory.h"
+#include "mcld/LD/StringTableBuilder.h"
 #include "mcld/LD/StubFactory.h"
 #include "mcld/MC/Attribute.h"
 #include "mcld/Object/ObjectBuilder.h"
@@ -38,17 +41,20 @@
 #include "mcld/Script/RpnEvaluator.h"
 #include "mcld/Support/FileOutputBuffer.h"
 #include "mcld/Support/MsgHandling.h"
+#include "mcld/Support/Parallel.h"
 #include "mcld/Target/ELFAttribute.h"
 #include "mcld/Target/ELFDynamic.h"
 #include "mcld/Target/GNUInfo.h"
 
 #include <llvm/ADT/StringRef.h>
+#include <llvm/Support/Casting.h>
 #include <llvm/Support/Host.h>
 
 #include <algorithm>
 #include <cstring>
 #include <cassert>
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -87,9 +93,12 @@ GNULDBackend::GNULDBackend(const LinkerConfig& pConfig, GNUInfo* pInfo)
       m_pBRIslandFactory(NULL),
       m_pStubFactory(NULL),
       m_pEhFrameHdr(NULL),
+      m_pBuildID(NULL),
       m_pAttribute(NULL),
       m_bHasTextRel(false),
       m_bHasStaticTLS(false),
+      m_GNUHashBucketCount(0),
+      m_SysVHashBucketCount(0),
       f_pPreInitArrayStart(NULL),
       f_pPreInitArrayEnd(NULL),
       f_pInitArrayStart(NULL),
@@ -111,6 +120,9 @@ GNULDBackend::GNULDBackend(const LinkerConfig& pConfig, GNUInfo* pInfo)
       f_p_End(NULL) {
   m_pELFSegmentTable = new ELFSegmentFactory();
   m_pSymIndexMap = new HashTableType(1024);
+  m_pStrTab = new StringTableBuilder();
+  m_pDynStrTab = new StringTableBuilder();
+  m_pShStrTab = new StringTableBuilder();
   m_pAttribute = new ELFAttribute(*this, pConfig);
 }
 
@@ -121,7 +133,11 @@ GNULDBackend::~GNULDBackend() {
   delete m_pExecFileFormat;
   delete m_pObjectFileFormat;
   delete m_pSymIndexMap;
+  delete m_pStrTab;
+  delete m_pDynStrTab;
+  delete m_pShStrTab;
   delete m_pEhFrameHdr;
+  delete m_pBuildID;
   delete m_pAttribute;
   delete m_pBRIslandFactory;
   delete m_pStubFactory;
@@ -697,13 +713,14 @@ const ELFFileFormat* GNULDBackend::getOutputFormat() const {
 
 /// sizeShstrtab - compute the size of .shstrtab
 void GNULDBackend::sizeShstrtab(Module& pModule) {
-  size_t shstrtab = 0;
   // compute the size of .shstrtab section.
+  m_pShStrTab->clear();
   Module::const_iterator sect, sectEnd = pModule.end();
   for (sect = pModule.begin(); sect != sectEnd; ++sect) {
-    shstrtab += (*sect)->name().size() + 1;
+    m_pShStrTab->add((*sect)->name());
   }  // end of for
-  getOutputFormat()->getShStrTab().setSize(shstrtab);
+  getOutputFormat()->getShStrTab().setSize(
+      m_pShStrTab->finalizeOffset(config().options().numThreads()));
 }
 
 /// sizeNamePools - compute the size of regular name pools
@@ -721,6 +738,7 @@ void GNULDBackend::sizeNamePools(Module& pModule) {
   // first byte
   size_t strtab = 1;
   size_t dynstr = config().isCodeStatic() ? 0 : 1;
+  unsigned num_threads = config().options().numThreads();
   size_t hash = 0;
   size_t gnuhash = 0;
 
@@ -730,6 +748,9 @@ void GNULDBackend::sizeNamePools(Module& pModule) {
 
   Module::SymbolTable& symbols = pModule.getSymbolTable();
   Module::const_sym_iterator symbol, symEnd;
+  m_pStrTab->clear();
+  m_pDynStrTab->clear();
+
   /// Compute the size of .symtab, .strtab, and symtab_local_cnt
   /// @{
   /* TODO:
@@ -746,8 +767,9 @@ void GNULDBackend::sizeNamePools(Module& pModule) {
       for (symbol = symbols.begin(); symbol != symEnd; ++symbol) {
         ++symtab;
         if (hasEntryInStrTab(**symbol))
-          strtab += (*symbol)->nameSize() + 1;
+          m_pStrTab->add((*symbol)->str());
       }
+      strtab = m_pStrTab->finalizeOffset(num_threads);
       symtab_local_cnt = 1 + symbols.numOfFiles() + symbols.numOfLocals() +
                          symbols.numOfLocalDyns();
       break;
@@ -757,46 +779,57 @@ void GNULDBackend::sizeNamePools(Module& pModule) {
   ELFFileFormat* file_format = getOutputFormat();
 
   switch (config().codeGenType()) {
-    case LinkerConfig::DynObj: {
-      // soname
-      dynstr += config().options().soname().size() + 1;
-    }
-    /** fall through **/
+    case LinkerConfig::DynObj:
     case LinkerConfig::Exec:
     case LinkerConfig::Binary: {
       if (!config().isCodeStatic()) {
-        /// Compute the size of .dynsym, .dynstr, and dynsym_local_cnt
+        /// Compute the size of .dynsym, .dynstr, and dynsym_local_cnt, and
+        /// collect the hash values of the symbols in .hash and .gnu.hash
+        hashDynamicSymbols(pModule);
+        bool has_gnu_hash = config().options().hasGNUHash();
+        bool has_sysv_hash = config().options().hasSysVHash();
+        std::vector<uint32_t> gnu_hashes;
+        std::vector<uint32_t> sysv_hashes;
+        if (has_gnu_hash)
+          gnu_hashes.reserve(symbols.numOfDynamics());
+        if (has_sysv_hash)
+          sysv_hashes.reserve(symbols.numOfLocalDyns() +
+                              symbols.numOfDynamics());
+
+        Module::const_sym_iterator dynBegin = symbols.dynamicBegin();
         symEnd = symbols.dynamicEnd();
         for (symbol = symbols.localDynBegin(); symbol != symEnd; ++symbol) {
           ++dynsym;
           if (hasEntryInStrTab(**symbol))
-            dynstr += (*symbol)->nameSize() + 1;
+            m_pDynStrTab->add((*symbol)->str());
+          if (has_sysv_hash)
+            sysv_hashes.push_back((*symbol)->sysvHash());
+          if (has_gnu_hash && symbol >= dynBegin &&
+              DynsymCompare().needGNUHash(**symbol))
+            gnu_hashes.push_back((*symbol)->gnuHash());
         }
         dynsym_local_cnt = 1 + symbols.numOfLocalDyns();
 
         // compute .gnu.hash
-        if (config().options().hasGNUHash()) {
-          // count the number of dynsym to hash
-          size_t hashed_sym_cnt = 0;
-          symEnd = symbols.dynamicEnd();
-          for (symbol = symbols.dynamicBegin(); symbol != symEnd; ++symbol) {
-            if (DynsymCompare().needGNUHash(**symbol))
-              ++hashed_sym_cnt;
-          }
+        if (has_gnu_hash) {
+          size_t hashed_sym_cnt = gnu_hashes.size();
           // Special case for empty .dynsym
           if (hashed_sym_cnt == 0)
             gnuhash = 5 * 4 + config().targets().bitclass() / 8;
           else {
-            size_t nbucket = getHashBucketCount(hashed_sym_cnt, true);
-            gnuhash = (4 + nbucket + hashed_sym_cnt) * 4;
+            m_GNUHashBucketCount = getHashBucketCount(
+                gnu_hashes, true, config().options().numThreads());
+            gnuhash = (4 + m_GNUHashBucketCount + hashed_sym_cnt) * 4;
             gnuhash += (1U << getGNUHashMaskbitslog2(hashed_sym_cnt)) / 8;
           }
         }
 
         // compute .hash
-        if (config().options().hasSysVHash()) {
+        if (has_sysv_hash) {
+          m_SysVHashBucketCount = getHashBucketCount(
+              sysv_hashes, false, config().options().numThreads());
           // Both Elf32_Word and Elf64_Word are 4 bytes
-          hash = (2 + getHashBucketCount(dynsym, false) + dynsym) *
+          hash = (2 + m_SysVHashBucketCount + dynsym) *
                  sizeof(llvm::ELF::Elf32_Word);
         }
 
@@ -804,20 +837,22 @@ void GNULDBackend::sizeNamePools(Module& pModule) {
         Module::const_lib_iterator lib, libEnd = pModule.lib_end();
         for (lib = pModule.lib_begin(); lib != libEnd; ++lib) {
           if (!(*lib)->attribute()->isAsNeeded() || (*lib)->isNeeded()) {
-            dynstr += (*lib)->name().size() + 1;
+            m_pDynStrTab->add((*lib)->name());
             dynamic().reserveNeedEntry();
           }
         }
 
+        // soname
+        if (LinkerConfig::DynObj == config().codeGenType())
+          m_pDynStrTab->add(config().options().soname());
+        m_pDynStrTab->finalizeOffset(num_threads);
+
         // add DT_RPATH
         if (!config().options().getRpathList().empty()) {
           dynamic().reserveNeedEntry();
-          GeneralOptions::const_rpath_iterator rpath,
-              rpathEnd = config().options().rpath_end();
-          for (rpath = config().options().rpath_begin(); rpath != rpathEnd;
-               ++rpath)
-            dynstr += (*rpath).size() + 1;
+          m_pDynStrTab->append(getRpath());
         }
+        dynstr = m_pDynStrTab->size();
 
         // set size
         if (config().targets().is32Bits()) {
@@ -865,20 +900,42 @@ void GNULDBackend::sizeNamePools(Module& pModule) {
   }  // end of switch
 }
 
+/// hashDynamicSymbols - compute the hash values in .gnu.hash and .hash of
+/// the symbols in .dynsym. Every symbol is hashed once, when sizeNamePools()
+/// sees it in the dynamic categories, and the emitters of .gnu.hash and .hash
+/// reuse the values.
+void GNULDBackend::hashDynamicSymbols(Module& pModule) {
+  Module::SymbolTable& symbols = pModule.getSymbolTable();
+  Module::sym_iterator dynBegin = symbols.localDynBegin();
+  size_t num_syms = symbols.dynamicEnd() - dynBegin;
+
+  const size_t symbols_per_chunk = 4096;
+  parallelForRange(config().options().numThreads(), 0, num_syms,
+                   symbols_per_chunk,
+                   [&](size_t pChunkBegin, size_t pChunkEnd) {
+    hash::StringHash<hash::DJB> gnu_hasher;
+    hash::StringHash<hash::ELF> sysv_hasher;
+    for (size_t i = pChunkBegin; i != pChunkEnd; ++i) {
+      LDSymbol* sym = dynBegin[i];
+      if (sym->hasDynHashes())
+        continue;
+      llvm::StringRef name(sym->name());
+      sym->setDynHashes(gnu_hasher(name), sysv_hasher(name));
+    }
+  });
+}
+
 /// emitSymbol32 - emit an ELF32 symbol
 void GNULDBackend::emitSymbol32(llvm::ELF::Elf32_Sym& pSym,
                                 LDSymbol& pSymbol,
-                                char* pStrtab,
-                                size_t pStrtabsize,
+                                size_t pStrOffset,
                                 size_t pSymtabIdx) {
   // FIXME: check the endian between host and target
   // write out symbol
-  if (hasEntryInStrTab(pSymbol)) {
-    pSym.st_name = pStrtabsize;
-    ::memcpy((pStrtab + pStrtabsize), pSymbol.name(), pSymbol.nameSize());
-  } else {
+  if (hasEntryInStrTab(pSymbol))
+    pSym.st_name = pStrOffset;
+  else
     pSym.st_name = 0;
-  }
   pSym.st_value = pSymbol.value();
   pSym.st_size = getSymbolSize(pSymbol);
   pSym.st_info = getSymbolInfo(pSymbol);
@@ -889,17 +946,14 @@ void GNULDBackend::emitSymbol32(llvm::ELF::Elf32_Sym& pSym,
 /// emitSymbol64 - emit an ELF64 symbol
 void GNULDBackend::emitSymbol64(llvm::ELF::Elf64_Sym& pSym,
                                 LDSymbol& pSymbol,
-                                char* pStrtab,
-                                size_t pStrtabsize,
+                                size_t pStrOffset,
                                 size_t pSymtabIdx) {
   // FIXME: check the endian between host and target
   // write out symbol
-  if (hasEntryInStrTab(pSymbol)) {
-    pSym.st_name = pStrtabsize;
-    ::memcpy((pStrtab + pStrtabsize), pSymbol.name(), pSymbol.nameSize());
-  } else {
+  if (hasEntryInStrTab(pSymbol))
+    pSym.st_name = pStrOffset;
+  else
     pSym.st_name = 0;
-  }
   pSym.st_value = pSymbol.value();
   pSym.st_size = getSymbolSize(pSymbol);
   pSym.st_info = getSymbolInfo(pSymbol);
@@ -907,6 +961,38 @@ void GNULDBackend::emitSymbol64(llvm::ELF::Elf64_Sym& pSym,
   pSym.st_shndx = getSymbolShndx(pSymbol);
 }
 
+/// emitSymbols - emit a range of symbols into .symtab/.dynsym
+void GNULDBackend::emitSymbols(Module::const_sym_iterator pBegin,
+                               Module::const_sym_iterator pEnd,
+                               llvm::ELF::Elf32_Sym* pSymtab32,
+                               llvm::ELF::Elf64_Sym* pSymtab64,
+                               StringTableBuilder& pStrTab,
+                               size_t pSymtabIdx) {
+  // The symbols created after sizeNamePools(), e.g., the stubs, are not in
+  // the string table yet. Their names are appended to the end of the table,
+  // which the backends have reserved.
+  size_t num_syms = pEnd - pBegin;
+  std::vector<size_t> str_offsets(num_syms, 0);
+  for (size_t i = 0; i != num_syms; ++i) {
+    if (hasEntryInStrTab(*pBegin[i]))
+      str_offsets[i] = pStrTab.append(pBegin[i]->str());
+  }
+
+  // every symbol owns its entry
+  const size_t symbols_per_chunk = 4096;
+  parallelForRange(config().options().numThreads(), 0, num_syms,
+                   symbols_per_chunk,
+                   [&](size_t pChunkBegin, size_t pChunkEnd) {
+    for (size_t i = pChunkBegin; i != pChunkEnd; ++i) {
+      size_t idx = pSymtabIdx + i;
+      if (pSymtab32 != NULL)
+        emitSymbol32(pSymtab32[idx], *pBegin[i], str_offsets[i], idx);
+      else
+        emitSymbol64(pSymtab64[idx], *pBegin[i], str_offsets[i], idx);
+    }
+  });
+}
+
 /// emitRegNamePools - emit regular name pools - .symtab, .strtab
 ///
 /// the size of these tables should be computed before layout
@@ -914,7 +1000,8 @@ void GNULDBackend::emitSymbol64(llvm::ELF::Elf64_Sym& pSym,
 void GNULDBackend::emitRegNamePools(const Module& pModule,
                                     FileOutputBuffer& pOutput) {
   ELFFileFormat* file_format = getOutputFormat();
-  if (!file_format->hasSymTab())
+  // .strtab is not built if all symbols are stripped
+  if (!file_format->hasSymTab() || !m_pStrTab->isFinalized())
     return;
 
   LDSection& symtab_sect = file_format->getSymTab();
@@ -937,14 +1024,11 @@ void GNULDBackend::emitRegNamePools(const Module& pModule,
                                       << config().targets().bitclass();
   }
 
-  // set up strtab_region
-  char* strtab = reinterpret_cast<char*>(strtab_region.begin());
-
   // emit the first ELF symbol
   if (config().targets().is32Bits())
-    emitSymbol32(symtab32[0], *LDSymbol::Null(), strtab, 0, 0);
+    emitSymbol32(symtab32[0], *LDSymbol::Null(), 0, 0);
   else
-    emitSymbol64(symtab64[0], *LDSymbol::Null(), strtab, 0, 0);
+    emitSymbol64(symtab64[0], *LDSymbol::Null(), 0, 0);
 
   bool sym_exist = false;
   HashTableType::entry_type* entry = NULL;
@@ -953,26 +1037,23 @@ void GNULDBackend::emitRegNamePools(const Module& pModule,
     entry->setValue(0);
   }
 
-  size_t symIdx = 1;
-  size_t strtabsize = 1;
-
   const Module::SymbolTable& symbols = pModule.getSymbolTable();
   Module::const_sym_iterator symbol, symEnd;
 
   symEnd = symbols.end();
-  for (symbol = symbols.begin(); symbol != symEnd; ++symbol) {
-    if (LinkerConfig::Object == config().codeGenType()) {
+  if (LinkerConfig::Object == config().codeGenType()) {
+    size_t symIdx = 1;
+    for (symbol = symbols.begin(); symbol != symEnd; ++symbol) {
       entry = m_pSymIndexMap->insert(*symbol, sym_exist);
       entry->setValue(symIdx);
+      ++symIdx;
     }
-    if (config().targets().is32Bits())
-      emitSymbol32(symtab32[symIdx], **symbol, strtab, strtabsize, symIdx);
-    else
-      emitSymbol64(symtab64[symIdx], **symbol, strtab, strtabsize, symIdx);
-    ++symIdx;
-    if (hasEntryInStrTab(**symbol))
-      strtabsize += (*symbol)->nameSize() + 1;
   }
+
+  emitSymbols(symbols.begin(), symEnd, symtab32, symtab64, *m_pStrTab, 1);
+
+  // emit .strtab after the names of the stubs are appended
+  m_pStrTab->emit(strtab_region, config().options().numThreads());
 }
 
 /// emitDynNamePools - emit dynamic name pools - .dyntab, .dynstr, .hash
@@ -983,7 +1064,7 @@ void GNULDBackend::emitDynNamePools(Module& pModule,
                                     FileOutputBuffer& pOutput) {
   ELFFileFormat* file_format = getOutputFormat();
   if (!file_format->hasDynSymTab() || !file_format->hasDynStrTab() ||
-      !file_format->hasDynamic())
+      !file_format->hasDynamic() || !m_pDynStrTab->isFinalized())
     return;
 
   bool sym_exist = false;
@@ -1010,19 +1091,18 @@ void GNULDBackend::emitDynNamePools(Module& pModule,
                                       << config().targets().bitclass();
   }
 
-  // set up strtab_region
-  char* strtab = reinterpret_cast<char*>(strtab_region.begin());
-
   // emit the first ELF symbol
   if (config().targets().is32Bits())
-    emitSymbol32(symtab32[0], *LDSymbol::Null(), strtab, 0, 0);
+    emitSymbol32(symtab32[0], *LDSymbol::Null(), 0, 0);
   else
-    emitSymbol64(symtab64[0], *LDSymbol::Null(), strtab, 0, 0);
+    emitSymbol64(symtab64[0], *LDSymbol::Null(), 0, 0);
 
   size_t symIdx = 1;
-  size_t strtabsize = 1;
 
   Module::SymbolTable& symbols = pModule.getSymbolTable();
+  // hash the symbols added to .dynsym after sizeNamePools()
+  hashDynamicSymbols(pModule);
+
   // emit .gnu.hash
   if (config().options().hasGNUHash())
     emitGNUHashTab(symbols, pOutput);
@@ -1033,66 +1113,60 @@ void GNULDBackend::emitDynNamePools(Module& pModule,
 
   // emit .dynsym, and .dynstr (emit LocalDyn and Dynamic category)
   Module::const_sym_iterator symbol, symEnd = symbols.dynamicEnd();
+  emitSymbols(symbols.localDynBegin(), symEnd, symtab32, symtab64,
+              *m_pDynStrTab, symIdx);
   for (symbol = symbols.localDynBegin(); symbol != symEnd; ++symbol) {
-    if (config().targets().is32Bits())
-      emitSymbol32(symtab32[symIdx], **symbol, strtab, strtabsize, symIdx);
-    else
-      emitSymbol64(symtab64[symIdx], **symbol, strtab, strtabsize, symIdx);
     // maintain output's symbol and index map
     entry = m_pSymIndexMap->insert(*symbol, sym_exist);
     entry->setValue(symIdx);
-    // sum up counters
     ++symIdx;
-    if (hasEntryInStrTab(**symbol))
-      strtabsize += (*symbol)->nameSize() + 1;
   }
 
   // emit DT_NEED
-  // add DT_NEED strings into .dynstr
+  // the DT_NEED strings are in .dynstr
   ELFDynamic::iterator dt_need = dynamic().needBegin();
   Module::const_lib_iterator lib, libEnd = pModule.lib_end();
   for (lib = pModule.lib_begin(); lib != libEnd; ++lib) {
     if (!(*lib)->attribute()->isAsNeeded() || (*lib)->isNeeded()) {
-      ::memcpy((strtab + strtabsize),
-               (*lib)->name().c_str(),
-               (*lib)->name().size());
-      (*dt_need)->setValue(llvm::ELF::DT_NEEDED, strtabsize);
-      strtabsize += (*lib)->name().size() + 1;
+      (*dt_need)->setValue(llvm::ELF::DT_NEEDED,
+                           m_pDynStrTab->getOffset((*lib)->name()));
       ++dt_need;
     }
   }
 
   if (!config().options().getRpathList().empty()) {
+    size_t rpath = m_pDynStrTab->getOffset(getRpath());
     if (!config().options().hasNewDTags())
-      (*dt_need)->setValue(llvm::ELF::DT_RPATH, strtabsize);
+      (*dt_need)->setValue(llvm::ELF::DT_RPATH, rpath);
     else
-      (*dt_need)->setValue(llvm::ELF::DT_RUNPATH, strtabsize);
+      (*dt_need)->setValue(llvm::ELF::DT_RUNPATH, rpath);
     ++dt_need;
-
-    GeneralOptions::const_rpath_iterator rpath,
-        rpathEnd = config().options().rpath_end();
-    for (rpath = config().options().rpath_begin(); rpath != rpathEnd; ++rpath) {
-      memcpy((strtab + strtabsize), (*rpath).data(), (*rpath).size());
-      strtabsize += (*rpath).size();
-      strtab[strtabsize++] = (rpath + 1 == rpathEnd ? '\0' : ':');
-    }
   }
 
   // initialize value of ELF .dynamic section
   if (LinkerConfig::DynObj == config().codeGenType()) {
     // set pointer to SONAME entry in dynamic string table.
-    dynamic().applySoname(strtabsize);
+    dynamic().applySoname(
+        m_pDynStrTab->getOffset(config().options().soname()));
   }
   dynamic().applyEntries(*file_format);
   dynamic().emit(dyn_sect, dyn_region);
 
-  // emit soname
-  if (LinkerConfig::DynObj == config().codeGenType()) {
-    ::memcpy((strtab + strtabsize),
-             config().options().soname().c_str(),
-             config().options().soname().size());
-    strtabsize += config().options().soname().size() + 1;
+  // emit .dynstr
+  m_pDynStrTab->emit(strtab_region, config().options().numThreads());
+}
+
+/// getRpath - the search paths of DT_RPATH or DT_RUNPATH separated by colons
+std::string GNULDBackend::getRpath() const {
+  std::string result;
+  GeneralOptions::const_rpath_iterator rpath,
+      rpathEnd = config().options().rpath_end();
+  for (rpath = config().options().rpath_begin(); rpath != rpathEnd; ++rpath) {
+    if (rpath != config().options().rpath_begin())
+      result += ':';
+    result += *rpath;
   }
+  return result;
 }
 
 /// emitELFHashTab - emit .hash
@@ -1111,25 +1185,35 @@ void GNULDBackend::emitELFHashTab(const Module::SymbolTable& pSymtab,
   uint32_t& nchain = word_array[1];
 
   size_t dynsymSize = 1 + pSymtab.numOfLocalDyns() + pSymtab.numOfDynamics();
-  nbucket = getHashBucketCount(dynsymSize, false);
+  assert(m_SysVHashBucketCount != 0 && "sizeNamePools() sizes .hash");
+  nbucket = m_SysVHashBucketCount;
   nchain = dynsymSize;
 
   uint32_t* bucket = (word_array + 2);
   uint32_t* chain = (bucket + nbucket);
 
-  // initialize bucket
-  memset(reinterpret_cast<void*>(bucket), 0, nbucket);
+  // initialize bucket and the chain of STN_UNDEF
+  memset(reinterpret_cast<void*>(bucket), 0,
+         (nbucket + 1) * sizeof(uint32_t));
 
-  hash::StringHash<hash::ELF> hash_func;
+  // find the bucket of every symbol
+  Module::const_sym_iterator dynBegin = pSymtab.localDynBegin();
+  size_t num_syms = dynsymSize - 1;
+  std::vector<uint32_t> bucket_pos(num_syms);
+  const size_t symbols_per_chunk = 4096;
+  parallelForRange(config().options().numThreads(), 0, num_syms,
+                   symbols_per_chunk,
+                   [&](size_t pChunkBegin, size_t pChunkEnd) {
+    uint32_t num_buckets = nbucket;
+    for (size_t i = pChunkBegin; i != pChunkEnd; ++i)
+      bucket_pos[i] = dynBegin[i]->sysvHash() % num_buckets;
+  });
 
-  size_t idx = 1;
-  Module::const_sym_iterator symbol, symEnd = pSymtab.dynamicEnd();
-  for (symbol = pSymtab.localDynBegin(); symbol != symEnd; ++symbol) {
-    llvm::StringRef name((*symbol)->name());
-    size_t bucket_pos = hash_func(name) % nbucket;
-    chain[idx] = bucket[bucket_pos];
-    bucket[bucket_pos] = idx;
-    ++idx;
+  // link the symbols into the chains. The later symbols come first.
+  for (size_t i = 0; i != num_syms; ++i) {
+    size_t idx = i + 1;
+    chain[idx] = bucket[bucket_pos[i]];
+    bucket[bucket_pos[i]] = idx;
   }
 }
 
@@ -1192,7 +1276,8 @@ void GNULDBackend::emitGNUHashTab(Module::SymbolTable& pSymtab,
   uint32_t shift1 = config().targets().is32Bits() ? 5 : 6;
   uint32_t mask = (1u << shift1) - 1;
 
-  nbucket = getHashBucketCount(hashed_sym_cnt, true);
+  assert(m_GNUHashBucketCount != 0 && "sizeNamePools() sizes .gnu.hash");
+  nbucket = m_GNUHashBucketCount;
   symidx = 1 + unhashed_sym_cnt;
   maskwords = 1 << (maskbitslog2 - shift1);
   shift2 = maskbitslog2;
@@ -1201,60 +1286,75 @@ void GNULDBackend::emitGNUHashTab(Module::SymbolTable& pSymtab,
   bucket = reinterpret_cast<uint32_t*>(bitmask + maskbits / 8);
   chain = (bucket + nbucket);
 
-  // build the gnu style hash table
-  typedef std::multimap<uint32_t, std::pair<LDSymbol*, uint32_t> > SymMapType;
-  SymMapType symmap;
-  symEnd = pSymtab.dynamicEnd();
-  for (symbol = pSymtab.localDynBegin() + symidx - 1; symbol != symEnd;
-       ++symbol) {
-    hash::StringHash<hash::DJB> hasher;
-    uint32_t djbhash = hasher((*symbol)->name());
-    uint32_t hash = djbhash % nbucket;
-    symmap.insert(std::make_pair(hash, std::make_pair(*symbol, djbhash)));
+  // find the bucket of every hashed symbol
+  Module::sym_iterator hashedBegin = pSymtab.localDynBegin() + symidx - 1;
+  std::vector<uint32_t> hashes(hashed_sym_cnt);
+  std::vector<uint32_t> bucket_pos(hashed_sym_cnt);
+  const size_t symbols_per_chunk = 4096;
+  parallelForRange(config().options().numThreads(), 0, hashed_sym_cnt,
+                   symbols_per_chunk,
+                   [&](size_t pChunkBegin, size_t pChunkEnd) {
+    uint32_t num_buckets = nbucket;
+    for (size_t i = pChunkBegin; i != pChunkEnd; ++i)
+      hashes[i] = hashedBegin[i]->gnuHash();
+    for (size_t i = pChunkBegin; i != pChunkEnd; ++i)
+      bucket_pos[i] = hashes[i] % num_buckets;
+  });
+
+  // sort the hashed symbols by bucket. Counting sort keeps the order of the
+  // symbols in the same bucket.
+  std::vector<uint32_t> bucket_begin(nbucket + 1, 0);
+  for (size_t i = 0; i != hashed_sym_cnt; ++i)
+    ++bucket_begin[bucket_pos[i] + 1];
+  for (size_t idx = 0; idx != nbucket; ++idx)
+    bucket_begin[idx + 1] += bucket_begin[idx];
+
+  std::vector<uint32_t> next(bucket_begin.begin(), bucket_begin.end() - 1);
+  std::vector<LDSymbol*> sorted_syms(hashed_sym_cnt);
+  std::vector<uint32_t> sorted_hashes(hashed_sym_cnt);
+  for (size_t i = 0; i != hashed_sym_cnt; ++i) {
+    uint32_t pos = next[bucket_pos[i]]++;
+    sorted_syms[pos] = hashedBegin[i];
+    sorted_hashes[pos] = hashes[i];
+  }
+  // rearrange the hashed symbol ordering
+  std::copy(sorted_syms.begin(), sorted_syms.end(), hashedBegin);
+
+  // compute bucket and chain. The lowest bit of the last hash value in a
+  // chain is set.
+  for (size_t idx = 0; idx != nbucket; ++idx) {
+    if (bucket_begin[idx] == bucket_begin[idx + 1])
+      bucket[idx] = 0;
+    else
+      bucket[idx] = symidx + bucket_begin[idx];
+  }
+  for (size_t i = 0; i != hashed_sym_cnt; ++i)
+    chain[i] = sorted_hashes[i] & ~1u;
+  for (size_t idx = 0; idx != nbucket; ++idx) {
+    if (bucket_begin[idx] != bucket_begin[idx + 1])
+      chain[bucket_begin[idx + 1] - 1] |= 1u;
   }
 
-  // compute bucket, chain, and bitmask
+  // compute the bloom filter. Every hash value sets two bits in one word.
   std::vector<uint64_t> bitmasks(maskwords);
-  size_t hashedidx = symidx;
-  for (size_t idx = 0; idx < nbucket; ++idx) {
-    size_t count = 0;
-    std::pair<SymMapType::iterator, SymMapType::iterator> ret;
-    ret = symmap.equal_range(idx);
-    for (SymMapType::iterator it = ret.first; it != ret.second;) {
-      // rearrange the hashed symbol ordering
-      *(pSymtab.localDynBegin() + hashedidx - 1) = it->second.first;
-      uint32_t djbhash = it->second.second;
-      uint32_t val = ((djbhash >> shift1) & ((maskbits >> shift1) - 1));
-      bitmasks[val] |= 1u << (djbhash & mask);
-      bitmasks[val] |= 1u << ((djbhash >> shift2) & mask);
-      val = djbhash & ~1u;
-      // advance the iterator and check if we're dealing w/ the last elment
-      if (++it == ret.second) {
-        // last element terminates the chain
-        val |= 1;
-      }
-      chain[hashedidx - symidx] = val;
-
-      ++hashedidx;
-      ++count;
-    }
-
-    if (count == 0)
-      bucket[idx] = 0;
-    else
-      bucket[idx] = hashedidx - count;
+  uint32_t word_mask = maskwords - 1;
+  for (size_t i = 0; i != hashed_sym_cnt; ++i) {
+    uint32_t djbhash = hashes[i];
+    uint64_t bits = (uint64_t(1) << (djbhash & mask)) |
+                    (uint64_t(1) << ((djbhash >> shift2) & mask));
+    bitmasks[(djbhash >> shift1) & word_mask] |= bits;
   }
 
   // write the bitmasks
   if (config().targets().is32Bits()) {
     uint32_t* maskval = reinterpret_cast<uint32_t*>(bitmask);
     for (size_t i = 0; i < maskwords; ++i)
-      std::memcpy(maskval + i, &bitmasks[i], 4);
+      maskval[i] = static_cast<uint32_t>(bitmasks[i]);
   } else {
     // must be 64
     uint64_t* maskval = reinterpret_cast<uint64_t*>(bitmask);
     for (size_t i = 0; i < maskwords; ++i)
-      std::memcpy(maskval + i, &bitmasks[i], 8);
+      maskval[i] = bitmasks[i];
   }
 }
 
@@ -1609,6 +1709,12 @@ bool GNULDBackend::updateSectionFlags(LDSection& pTo, const LDSection& pFrom) {
   if (0 == (pFrom.flag() & llvm::ELF::SHF_STRINGS))
     flags &= ~llvm::ELF::SHF_STRINGS;
 
+  // if the entries of the input sections differ in size, clean SHF_MERGE
+  if (pFrom.entSize() != pTo.entSize()) {
+    flags &= ~llvm::ELF::SHF_MERGE;
+    pTo.setEntSize(0);
+  }
+
   pTo.setFlag(flags);
   return true;
 }
@@ -2441,7 +2547,7 @@ void GNULDBackend::layout(Module& pModule) {
 
   // 2. update output sections in Module
   SectionMap& sectionMap = pModule.getScript().sectionMap();
-  pModule.getSectionTable().clear();
+  pModule.clearSections();
   for (SectionMap::iterator out = sectionMap.begin(), outEnd = sectionMap.end();
        out != outEnd;
        ++out) {
@@ -2450,7 +2556,7 @@ void GNULDBackend::layout(Module& pModule) {
         (*out)->getSection()->kind() == LDFileFormat::StackNote ||
         config().codeGenType() == LinkerConfig::Object) {
       (*out)->getSection()->setIndex(pModule.size());
-      pModule.getSectionTable().push_back((*out)->getSection());
+      pModule.addSection(*(*out)->getSection());
     }
   }  // for each output section description
 
@@ -2519,7 +2625,7 @@ void GNULDBackend::preLayout(Module& pModule, IRBuilder& pBuilder) {
               (*rs)->name(), (*rs)->kind(), (*rs)->type(), (*rs)->flag());
 
           output_sect->setAlign((*rs)->align());
-          pModule.getSectionTable().push_back(output_sect);
+          pModule.addSection(*output_sect);
         }
 
         // set output relocation section link
@@ -2538,7 +2644,9 @@ void GNULDBackend::preLayout(Module& pModule, IRBuilder& pBuilder) {
 
         RelocData* out_reloc_data = output_sect->getRelocData();
 
-        // move relocations from input's to output's RelcoationData
+        // move relocations from input's to output's RelcoationData. The
+        // relocations of the discarded sections are still packed.
+        (*rs)->getRelocData()->materialize();
         RelocData::RelocationListType& out_list =
             out_reloc_data->getRelocationList();
         RelocData::RelocationListType& in_list =
@@ -2560,6 +2668,13 @@ void GNULDBackend::preLayout(Module& pModule, IRBuilder& pBuilder) {
 
   // set up the section flag of .note.GNU-stack section
   setupGNUStackInfo(pModule);
+
+  // init BuildID and size the output section
+  if (LinkerConfig::Object != config().codeGenType() &&
+      config().options().hasBuildID()) {
+    m_pBuildID = new BuildID(getOutputFormat()->getNoteGNUBuildID(), config());
+    m_pBuildID->sizeOutput();
+  }
 }
 
 /// postLayout - Backend can do any needed modification after layout
@@ -2580,28 +2695,67 @@ void GNULDBackend::postProcessing(FileOutputBuffer& pOutput) {
     // emit eh_frame_hdr
     m_pEhFrameHdr->emitOutput<32>(pOutput);
   }
+
+  // emit .note.gnu.build-id last, since the build ID is computed over the
+  // whole output
+  if (m_pBuildID != NULL)
+    m_pBuildID->emitOutput(pOutput);
 }
 
-/// getHashBucketCount - calculate hash bucket count.
-unsigned GNULDBackend::getHashBucketCount(unsigned pNumOfSymbols,
-                                          bool pIsGNUStyle) {
+/// getHashBucketCount - choose the bucket count of the hash table of pHashes.
+/// Every candidate count is tried, and the one that costs the fewest words to
+/// store the buckets and to walk the chains is chosen. A lookup of a symbol in
+/// a chain of length c walks (c + 1) / 2 entries on average. .gnu.hash rejects
+/// most lookups of the other symbols by the bloom filter, but such a lookup in
+/// .hash walks the whole chain.
+unsigned GNULDBackend::getHashBucketCount(const std::vector<uint32_t>& pHashes,
+                                          bool pIsGNUStyle,
+                                          unsigned pNumThreads) {
   static const unsigned int buckets[] = {
       1, 3, 17, 37, 67, 97, 131, 197, 263, 521, 1031, 2053, 4099, 8209, 16411,
-      32771, 65537, 131101, 262147
+      32771, 65537, 131101, 262147, 524309, 1048583, 2097169, 4194319, 8388617,
+      16777259
   };
   const unsigned buckets_count = sizeof buckets / sizeof buckets[0];
+  const unsigned min_count = pIsGNUStyle ? 2 : 1;
+  size_t num_hashes = pHashes.size();
 
-  unsigned int result = 1;
+  // the candidates are the counts from 1/8 to twice the number of symbols
+  std::vector<unsigned> candidates;
   for (unsigned i = 0; i < buckets_count; ++i) {
-    if (pNumOfSymbols < buckets[i])
+    if (buckets[i] * 8ULL < num_hashes)
+      continue;
+    if (buckets[i] > num_hashes * 2 && !candidates.empty())
       break;
-    result = buckets[i];
-  }
-
-  if (pIsGNUStyle && result < 2)
-    result = 2;
+    candidates.push_back(buckets[i] < min_count ? min_count : buckets[i]);
+  }
+  if (candidates.empty())
+    candidates.push_back(buckets[buckets_count - 1]);
+
+  std::vector<uint64_t> costs(candidates.size());
+  parallelFor(pNumThreads, 0, candidates.size(), [&](size_t pIdx) {
+    unsigned num_buckets = candidates[pIdx];
+    std::vector<uint32_t> chains(num_buckets, 0);
+    for (size_t i = 0; i != num_hashes; ++i)
+      ++chains[pHashes[i] % num_buckets];
+
+    // the cost of looking up every symbol once, twice to stay in integers
+    uint64_t cost = 2 * uint64_t(num_buckets);
+    for (unsigned b = 0; b != num_buckets; ++b) {
+      uint64_t length = chains[b];
+      cost += length * (length + 1);
+      if (!pIsGNUStyle)
+        cost += 2 * length * length;
+    }
+    costs[pIdx] = cost;
+  });
 
-  return result;
+  size_t best = 0;
+  for (size_t idx = 1; idx < candidates.size(); ++idx) {
+    if (costs[idx] < costs[best])
+      best = idx;
+  }
+  return candidates[best];
 }
 
 /// getGNUHashMaskbitslog2 - calculate the number of mask bits in log2
@@ -2897,7 +3051,46 @@ bool GNULDBackend::relax(Module& pModule, IRBuilder& pBuilder) {
   if (!mayRelax())
     return true;
 
-  getBRIslandFactory()->group(pModule);
+  // collect the branches once, each pass of doRelax only checks the branches
+  // that have moved in the previous pass
+  m_RelaxWorklist.clear();
+  Module::obj_iterator input, inEnd = pModule.obj_end();
+  for (input = pModule.obj_begin(); input != inEnd; ++input) {
+    LDContext::sect_iterator rs, rsEnd = (*input)->context()->relocSectEnd();
+    for (rs = (*input)->context()->relocSectBegin(); rs != rsEnd; ++rs) {
+      if (LDFileFormat::Ignore == (*rs)->kind() || !(*rs)->hasRelocData())
+        continue;
+      // the backend keeps no bound relocation, so they are never relaxed
+      if ((*rs)->getRelocData()->hasPacked())
+        continue;
+      RelocData::iterator reloc, rEnd = (*rs)->getRelocData()->end();
+      for (reloc = (*rs)->getRelocData()->begin(); reloc != rEnd; ++reloc) {
+        Relocation* relocation = llvm::cast<Relocation>(reloc);
+        if (mayRelaxBranch(*relocation))
+          m_RelaxWorklist.push_back(RelaxBranch(*relocation));
+      }
+    }
+  }
+
+  // create the islands in the executable sections that have such branches
+  std::set<const SectionData*> branch_sects;
+  for (RelaxWorklist::iterator it = m_RelaxWorklist.begin(),
+                               ie = m_RelaxWorklist.end();
+       it != ie;
+       ++it) {
+    branch_sects.insert((*it).reloc->targetRef().frag()->getParent());
+  }
+  for (Module::iterator sect = pModule.begin(), sectEnd = pModule.end();
+       sect != sectEnd;
+       ++sect) {
+    if ((*sect)->kind() != LDFileFormat::TEXT ||
+        ((*sect)->flag() & llvm::ELF::SHF_EXECINSTR) == 0x0 ||
+        !(*sect)->hasSectionData())
+      continue;
+    SectionData* data = (*sect)->getSectionData();
+    if (branch_sects.find(data) != branch_sects.end())
+      getBRIslandFactory()->group(*data);
+  }
 
   bool finished = true;
   do {
@@ -2906,9 +3099,61 @@ bool GNULDBackend::relax(Module& pModule, IRBuilder& pBuilder) {
     }
   } while (!finished);
 
+  RelaxWorklist().swap(m_RelaxWorklist);
   return true;
 }
 
+bool GNULDBackend::isBranchMoved(RelaxBranch& pBranch, uint64_t pTargetValue) {
+  uint64_t place = pBranch.reloc->place();
+  if (pBranch.checked && pBranch.place == place &&
+      pBranch.target == pTargetValue)
+    return false;
+  pBranch.place = place;
+  pBranch.target = pTargetValue;
+  pBranch.checked = true;
+  return true;
+}
+
+void GNULDBackend::relayoutIslands(bool pRelaxed, bool& pFinished) {
+  // find the first fragment w/ invalid offset due to stub insertion in each
+  // section. The islands of a section are produced one after another.
+  std::vector<std::pair<SectionData*, Fragment*> > sects;
+  pFinished = true;
+  for (BranchIslandFactory::iterator island = getBRIslandFactory()->begin(),
+                                     island_end = getBRIslandFactory()->end();
+       island != island_end;
+       ++island) {
+    SectionData* data = (*island).getParent();
+    if (sects.empty() || sects.back().first != data)
+      sects.push_back(std::make_pair(data, static_cast<Fragment*>(NULL)));
+    if (sects.back().second != NULL || (*island).end() == data->end())
+      continue;
+
+    Fragment* exit = (*island).end();
+    if (((*island).offset() + (*island).size()) > exit->getOffset()) {
+      sects.back().second = exit;
+      pFinished = false;
+    }
+  }
+
+  for (size_t i = 0; i < sects.size(); ++i) {
+    // reset the offset of invalid fragments
+    Fragment* invalid = sects[i].second;
+    while (invalid != NULL) {
+      invalid->setOffset(invalid->getPrevNode()->getOffset() +
+                         invalid->getPrevNode()->size());
+      invalid = invalid->getNextNode();
+    }
+
+    // reset the size of the section
+    if (pRelaxed) {
+      SectionData* data = sects[i].first;
+      data->getSection().setSize(data->back().getOffset() +
+                                 data->back().size());
+    }
+  }
+}
+
 bool GNULDBackend::DynsymCompare::needGNUHash(const LDSymbol& X) const {
   // FIXME: in bfd and gold linker, an undefined symbol might be hashed
   // when the ouput is not PIC, if the symbol is referred by a non pc-relative
@@ -547,84 +547,56 @@ bool HexagonLDBackend::doRelax(Module& pModule,
   assert(getStubFactory() != NULL && getBRIslandFactory() != NULL);
   bool isRelaxed = false;
   ELFFileFormat* file_format = getOutputFormat();
-  // check branch relocs and create the related stubs if needed
-  Module::obj_iterator input, inEnd = pModule.obj_end();
-  for (input = pModule.obj_begin(); input != inEnd; ++input) {
-    LDContext::sect_iterator rs, rsEnd = (*input)->context()->relocSectEnd();
-    for (rs = (*input)->context()->relocSectBegin(); rs != rsEnd; ++rs) {
-      if (LDFileFormat::Ignore == (*rs)->kind() || !(*rs)->hasRelocData())
-        continue;
-      RelocData::iterator reloc, rEnd = (*rs)->getRelocData()->end();
-      for (reloc = (*rs)->getRelocData()->begin(); reloc != rEnd; ++reloc) {
-        switch (reloc->type()) {
-          case llvm::ELF::R_HEX_B22_PCREL:
-          case llvm::ELF::R_HEX_B15_PCREL:
-          case llvm::ELF::R_HEX_B7_PCREL:
-          case llvm::ELF::R_HEX_B13_PCREL:
-          case llvm::ELF::R_HEX_B9_PCREL: {
-            Relocation* relocation = llvm::cast<Relocation>(reloc);
-            uint64_t sym_value = 0x0;
-            LDSymbol* symbol = relocation->symInfo()->outSymbol();
-            if (symbol->hasFragRef()) {
-              uint64_t value = symbol->fragRef()->getOutputOffset();
-              uint64_t addr =
-                  symbol->fragRef()->frag()->getParent()->getSection().addr();
-              sym_value = addr + value;
-            }
-            Stub* stub = getStubFactory()->create(*relocation,  // relocation
-                                                  sym_value,  // symbol value
-                                                  pBuilder,
-                                                  *getBRIslandFactory());
-            if (stub != NULL) {
-              assert(stub->symInfo() != NULL);
-              // increase the size of .symtab and .strtab
-              LDSection& symtab = file_format->getSymTab();
-              LDSection& strtab = file_format->getStrTab();
-              symtab.setSize(symtab.size() + sizeof(llvm::ELF::Elf32_Sym));
-              strtab.setSize(strtab.size() + stub->symInfo()->nameSize() + 1);
-              isRelaxed = true;
-            }
-          } break;
-
-          default:
-            break;
-        }
-      }
+  // check the moved branches and create the related stubs if needed
+  RelaxWorklist& worklist = getRelaxWorklist();
+  for (RelaxWorklist::iterator branch = worklist.begin(),
+                               bEnd = worklist.end();
+       branch != bEnd;
+       ++branch) {
+    Relocation* relocation = (*branch).reloc;
+    uint64_t sym_value = 0x0;
+    LDSymbol* symbol = relocation->symInfo()->outSymbol();
+    if (symbol->hasFragRef()) {
+      uint64_t value = symbol->fragRef()->getOutputOffset();
+      uint64_t addr =
+          symbol->fragRef()->frag()->getParent()->getSection().addr();
+      sym_value = addr + value;
     }
-  }
-
-  // find the first fragment w/ invalid offset due to stub insertion
-  Fragment* invalid = NULL;
-  pFinished = true;
-  for (BranchIslandFactory::iterator island = getBRIslandFactory()->begin(),
-                                     island_end = getBRIslandFactory()->end();
-       island != island_end;
-       ++island) {
-    if ((*island).end() == file_format->getText().getSectionData()->end())
-      break;
+    if (!isBranchMoved(*branch, sym_value))
+      continue;
 
-    Fragment* exit = (*island).end();
-    if (((*island).offset() + (*island).size()) > exit->getOffset()) {
-      invalid = exit;
-      pFinished = false;
-      break;
+    Stub* stub = getStubFactory()->create(*relocation,  // relocation
+                                          sym_value,    // symbol value
+                                          pBuilder,
+                                          *getBRIslandFactory());
+    if (stub != NULL) {
+      assert(stub->symInfo() != NULL);
+      // increase the size of .symtab and .strtab
+      LDSection& symtab = file_format->getSymTab();
+      LDSection& strtab = file_format->getStrTab();
+      symtab.setSize(symtab.size() + sizeof(llvm::ELF::Elf32_Sym));
+      strtab.setSize(strtab.size() + stub->symInfo()->nameSize() + 1);
+      isRelaxed = true;
     }
   }
 
-  // reset the offset of invalid fragments
-  while (invalid != NULL) {
-    invalid->setOffset(invalid->getPrevNode()->getOffset() +
-                       invalid->getPrevNode()->size());
-    invalid = invalid->getNextNode();
-  }
+  // re-lay out the sections after the islands that have outgrown
+  relayoutIslands(isRelaxed, pFinished);
+  return isRelaxed;
+}
 
-  // reset the size of .text
-  if (isRelaxed) {
-    file_format->getText().setSize(
-        file_format->getText().getSectionData()->back().getOffset() +
-        file_format->getText().getSectionData()->back().size());
+/// mayRelaxBranch
+bool HexagonLDBackend::mayRelaxBranch(const Relocation& pReloc) const {
+  switch (pReloc.type()) {
+    case llvm::ELF::R_HEX_B22_PCREL:
+    case llvm::ELF::R_HEX_B15_PCREL:
+    case llvm::ELF::R_HEX_B7_PCREL:
+    case llvm::ELF::R_HEX_B13_PCREL:
+    case llvm::ELF::R_HEX_B9_PCREL:
+      return true;
+    default:
+      return false;
   }
-  return isRelaxed;
 }
 
 /// finalizeSymbol - finalize the symbol value
@@ -104,6 +104,8 @@ class HexagonLDBackend : public GNULDBackend {
 
   bool doRelax(Module& pModule, IRBuilder& pBuilder, bool& pFinished);
 
+  bool mayRelaxBranch(const Relocation& pReloc) const;
+
   bool initTargetStubs();
 
   OutputRelocSection& getRelaDyn();
@@ -10,6 +10,7 @@
 #define TARGET_HEXAGON_HEXAGONRELOCATOR_H_
 
 #include "mcld/LD/Relocator.h"
+#include "mcld/LD/ResolveInfo.h"
 #include "mcld/Target/GOT.h"
 #include "mcld/Target/PLT.h"
 #include "mcld/Target/KeyEntryMap.h"
@@ -105,6 +106,12 @@ class HexagonRelocator : public Relocator {
   const RelRelMap& getRelRelMap() const { return m_RelRelMap; }
   RelRelMap& getRelRelMap() { return m_RelRelMap; }
 
+  /// mayApplyConcurrently - a relocation whose symbol reserves no GOT, PLT
+  /// or dynamic relocation entry only writes its own target data.
+  bool mayApplyConcurrently(const Relocation& pReloc) const {
+    return pReloc.symInfo()->reserved() == None;
+  }
+
   /// getDebugStringOffset - get the offset from the relocation target. This is
   /// used to get the debug string offset.
   uint32_t getDebugStringOffset(Relocation& pReloc) const { return 0; }
@@ -623,18 +623,23 @@ void MipsGNULDBackend::doCreateProgramHdrs(Module& pModule) {
   // TODO
 }
 
-bool MipsGNULDBackend::relaxRelocation(IRBuilder& pBuilder, Relocation& pRel) {
+bool MipsGNULDBackend::relaxRelocation(IRBuilder& pBuilder,
+                                       RelaxBranch& pBranch) {
+  Relocation& rel = *pBranch.reloc;
   uint64_t sym_value = 0x0;
 
-  LDSymbol* symbol = pRel.symInfo()->outSymbol();
+  LDSymbol* symbol = rel.symInfo()->outSymbol();
   if (symbol->hasFragRef()) {
     uint64_t value = symbol->fragRef()->getOutputOffset();
     uint64_t addr = symbol->fragRef()->frag()->getParent()->getSection().addr();
     sym_value = addr + value;
   }
 
+  if (!isBranchMoved(pBranch, sym_value))
+    return false;
+
   Stub* stub = getStubFactory()->create(
-      pRel, sym_value, pBuilder, *getBRIslandFactory());
+      rel, sym_value, pBuilder, *getBRIslandFactory());
 
   if (stub == NULL)
     return false;
@@ -656,67 +661,24 @@ bool MipsGNULDBackend::doRelax(Module& pModule,
 
   bool isRelaxed = false;
 
-  for (Module::obj_iterator input = pModule.obj_begin();
-       input != pModule.obj_end();
-       ++input) {
-    LDContext* context = (*input)->context();
-
-    for (LDContext::sect_iterator rs = context->relocSectBegin();
-         rs != context->relocSectEnd();
-         ++rs) {
-      LDSection* sec = *rs;
-
-      if (LDFileFormat::Ignore == sec->kind() || !sec->hasRelocData())
-        continue;
-
-      for (RelocData::iterator reloc = sec->getRelocData()->begin();
-           reloc != sec->getRelocData()->end();
-           ++reloc) {
-        if (llvm::ELF::R_MIPS_26 != reloc->type())
-          continue;
-
-        if (relaxRelocation(pBuilder, *llvm::cast<Relocation>(reloc)))
-          isRelaxed = true;
-      }
-    }
-  }
-
-  SectionData* textData = getOutputFormat()->getText().getSectionData();
-
-  // find the first fragment w/ invalid offset due to stub insertion
-  Fragment* invalid = NULL;
-  pFinished = true;
-  for (BranchIslandFactory::iterator ii = getBRIslandFactory()->begin(),
-                                     ie = getBRIslandFactory()->end();
-       ii != ie;
-       ++ii) {
-    BranchIsland& island = *ii;
-    if (island.end() == textData->end())
-      break;
-
-    Fragment* exit = island.end();
-    if ((island.offset() + island.size()) > exit->getOffset()) {
-      invalid = exit;
-      pFinished = false;
-      break;
-    }
-  }
-
-  // reset the offset of invalid fragments
-  while (invalid != NULL) {
-    invalid->setOffset(invalid->getPrevNode()->getOffset() +
-                       invalid->getPrevNode()->size());
-    invalid = invalid->getNextNode();
+  RelaxWorklist& worklist = getRelaxWorklist();
+  for (RelaxWorklist::iterator branch = worklist.begin(),
+                               bEnd = worklist.end();
+       branch != bEnd;
+       ++branch) {
+    if (relaxRelocation(pBuilder, *branch))
+      isRelaxed = true;
   }
 
-  // reset the size of .text
-  if (isRelaxed)
-    getOutputFormat()->getText().setSize(textData->back().getOffset() +
-                                         textData->back().size());
-
+  // re-lay out the sections after the islands that have outgrown
+  relayoutIslands(isRelaxed, pFinished);
   return isRelaxed;
 }
 
+bool MipsGNULDBackend::mayRelaxBranch(const Relocation& pReloc) const {
+  return (llvm::ELF::R_MIPS_26 == pReloc.type());
+}
+
 bool MipsGNULDBackend::initTargetStubs() {
   if (getStubFactory() == NULL)
     return false;
@@ -131,13 +131,12 @@ class MipsGNULDBackend : public GNULDBackend {
   void defineGOTSymbol(IRBuilder& pBuilder);
   void defineGOTPLTSymbol(IRBuilder& pBuilder);
 
-  bool relaxRelocation(IRBuilder& pBuilder, Relocation& pRel);
+  bool relaxRelocation(IRBuilder& pBuilder, RelaxBranch& pBranch);
 
   /// emitSymbol32 - emit an ELF32 symbol, override parent's function
   void emitSymbol32(llvm::ELF::Elf32_Sym& pSym32,
                     LDSymbol& pSymbol,
-                    char* pStrtab,
-                    size_t pStrtabsize,
+                    size_t pStrOffset,
                     size_t pSymtabIdx);
 
   /// doCreateProgramHdrs - backend can implement this function to create the
@@ -153,6 +152,9 @@ class MipsGNULDBackend : public GNULDBackend {
   /// otherwise set it to false.
   bool doRelax(Module& pModule, IRBuilder& pBuilder, bool& pFinished);
 
+  /// mayRelaxBranch - return true if pReloc is a branch that may need a stub
+  bool mayRelaxBranch(const Relocation& pReloc) const;
+
   /// initTargetStubs
   bool initTargetStubs();
 
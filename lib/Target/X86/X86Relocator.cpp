@@ -272,7 +272,7 @@ LDSymbol& X86Relocator::defineSymbolforCopyReloc(IRBuilder& pBuilder,
 //===----------------------------------------------------------------------===//
 X86_32Relocator::X86_32Relocator(X86_32GNULDBackend& pParent,
                                  const LinkerConfig& pConfig)
-    : X86Relocator(pConfig), m_Target(pParent) {
+    : X86Relocator(pConfig), m_Target(pParent), m_pTLSModuleID(NULL) {
 }
 
 Relocator::Result X86_32Relocator::applyRelocation(Relocation& pRelocation) {
@@ -763,17 +763,16 @@ void X86_32Relocator::scanGlobalReloc(Relocation& pReloc,
 
 // Create a GOT entry for the TLS module index
 X86_32GOTEntry& X86_32Relocator::getTLSModuleID() {
-  static X86_32GOTEntry* got_entry = NULL;
-  if (got_entry != NULL)
-    return *got_entry;
+  if (m_pTLSModuleID != NULL)
+    return *m_pTLSModuleID;
 
   // Allocate 2 got entries and 1 dynamic reloc for R_386_TLS_LDM
-  got_entry = getTarget().getGOT().create();
+  m_pTLSModuleID = getTarget().getGOT().create();
   getTarget().getGOT().create()->setValue(0x0);
 
   helper_DynRel_init(
-      NULL, *got_entry, 0x0, llvm::ELF::R_386_TLS_DTPMOD32, *this);
-  return *got_entry;
+      NULL, *m_pTLSModuleID, 0x0, llvm::ELF::R_386_TLS_DTPMOD32, *this);
+  return *m_pTLSModuleID;
 }
 
 /// convert R_386_TLS_IE to R_386_TLS_LE
@@ -10,6 +10,7 @@
 #define TARGET_X86_X86RELOCATOR_H_
 
 #include "mcld/LD/Relocator.h"
+#include "mcld/LD/ResolveInfo.h"
 #include "mcld/Target/GOT.h"
 #include "mcld/Target/PLT.h"
 #include "mcld/Target/KeyEntryMap.h"
@@ -68,6 +69,18 @@ class X86Relocator : public Relocator {
 
   virtual const char* getName(Relocation::Type pType) const = 0;
 
+  /// mayApplyConcurrently - a relocation whose symbol reserves no GOT, PLT
+  /// or dynamic relocation entry only writes its own target data.
+  bool mayApplyConcurrently(const Relocation& pReloc) const {
+    return pReloc.symInfo()->reserved() == None;
+  }
+
+  /// mayKeepPacked - the relocations applied to a section that is not
+  /// allocated are not scanned, and are applied statically.
+  bool mayKeepPacked(const LDSection& pSection) const {
+    return (pSection.flag() & llvm::ELF::SHF_ALLOC) == 0x0;
+  }
+
   const SymPLTMap& getSymPLTMap() const { return m_SymPLTMap; }
   SymPLTMap& getSymPLTMap() { return m_SymPLTMap; }
 
@@ -175,6 +188,8 @@ class X86_32Relocator : public X86Relocator {
   X86_32GNULDBackend& m_Target;
   SymGOTMap m_SymGOTMap;
   SymGOTPLTMap m_SymGOTPLTMap;
+  /// the GOT entry of the TLS module index, created at the first use
+  X86_32GOTEntry* m_pTLSModuleID;
 };
 
 /** \class X86_64Relocator
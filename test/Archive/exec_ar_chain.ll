@@ -0,0 +1,41 @@
+; RUN: sed -e 's/SELF/main/' -e 's/NEXT/m1/' %s > %t.main.ll
+; RUN: sed -e 's/SELF/m1/' -e 's/NEXT/m2/' %s > %t.m1.ll
+; RUN: sed -e 's/SELF/m2/' -e 's/NEXT/m3/' %s > %t.m2.ll
+; RUN: sed -e 's/SELF/m3/' -e 's/NEXT/main/' %s > %t.m3.ll
+; RUN: sed -e 's/SELF/unused/' -e 's/NEXT/m1/' %s > %t.unused.ll
+; RUN: %LLC -mtriple="x86_64-pc-linux-gnu" -filetype=obj %t.main.ll -o %t.main.o
+; RUN: %LLC -mtriple="x86_64-pc-linux-gnu" -filetype=obj %t.m1.ll -o %t.m1.o
+; RUN: %LLC -mtriple="x86_64-pc-linux-gnu" -filetype=obj %t.m2.ll -o %t.m2.o
+; RUN: %LLC -mtriple="x86_64-pc-linux-gnu" -filetype=obj %t.m3.ll -o %t.m3.o
+; RUN: %LLC -mtriple="x86_64-pc-linux-gnu" -filetype=obj %t.unused.ll \
+; RUN: -o %t.unused.o
+
+; m1 is included for main, m2 for m1 and m3 for m2, although they come
+; before m1 in the archive. unused is referred by no one.
+; RUN: rm -f %t.a
+; RUN: ar rcs %t.a %t.m3.o %t.m2.o %t.unused.o %t.m1.o
+; RUN: %MCLinker -mtriple="x86_64-pc-linux-gnu" -e main %t.main.o %t.a \
+; RUN: -o %t.out
+; RUN: readelf -s %t.out | awk '{print $8}' | FileCheck %s
+; CHECK-NOT: unused
+; CHECK-DAG: m1
+; CHECK-DAG: m2
+; CHECK-DAG: m3
+; CHECK-NOT: unused
+
+; In a group, m3 is included from the first archive for m2 of the second
+; one.
+; RUN: rm -f %t.1.a %t.2.a
+; RUN: ar rcs %t.1.a %t.m1.o %t.m3.o %t.unused.o
+; RUN: ar rcs %t.2.a %t.m2.o
+; RUN: %MCLinker -mtriple="x86_64-pc-linux-gnu" -e main %t.main.o \
+; RUN: --start-group %t.1.a %t.2.a --end-group -o %t.group.out
+; RUN: readelf -s %t.group.out | awk '{print $8}' | FileCheck %s
+
+declare i32 @NEXT(i32)
+
+define i32 @SELF(i32 %x) nounwind {
+entry:
+  %v = call i32 @NEXT(i32 %x)
+  ret i32 %v
+}
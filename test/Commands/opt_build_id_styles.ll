@@ -0,0 +1,41 @@
+; RUN: %LLC -mtriple="arm-none-linux-gnueabi" -march=arm \
+; RUN: -filetype=obj -relocation-model=pic %s -o %t.o
+; RUN: %MCLinker -mtriple="arm-none-linux-gnueabi" \
+; RUN: --build-id=sha1 --threads=4 -o %t.sha1.exe %t.o -pie
+; RUN: readelf -n %t.sha1.exe | FileCheck %s -check-prefix=SHA1
+; RUN: %MCLinker -mtriple="arm-none-linux-gnueabi" \
+; RUN: --build-id=md5 -o %t.md5.exe %t.o -pie
+; RUN: readelf -n %t.md5.exe | FileCheck %s -check-prefix=MD5
+; RUN: %MCLinker -mtriple="arm-none-linux-gnueabi" \
+; RUN: --build-id=0x0123456789abcdef -o %t.hex.exe %t.o -pie
+; RUN: readelf -n %t.hex.exe | FileCheck %s -check-prefix=HEX
+; RUN: not %MCLinker -mtriple="arm-none-linux-gnueabi" \
+; RUN: --build-id=bogus -o %t.bad.exe %t.o -pie
+
+; SHA1: .note.gnu.build-id
+; SHA1: GNU 0x00000014 NT_GNU_BUILD_ID
+; SHA1-NEXT: Build ID: {{[0-9a-f]{40}$}}
+
+; MD5: .note.gnu.build-id
+; MD5: GNU 0x00000010 NT_GNU_BUILD_ID
+; MD5-NEXT: Build ID: {{[0-9a-f]{32}$}}
+
+; HEX: .note.gnu.build-id
+; HEX: GNU 0x00000008 NT_GNU_BUILD_ID
+; HEX-NEXT: Build ID: 0123456789abcdef{{$}}
+
+target triple = "arm-none-linux-gnueabi"
+
+@.str = private unnamed_addr constant [911 x i8] c"\0A                      /\5C   _ /     \0A                  \5C._\5C`.\5C`-./      \0A             -._ /  `. `   (       \0A             _`/`< _  `-. __\5C      \0A             `.  /  )    ( @)(     \0A             / ) `-./`_.-`._  `._  \0A             _/< __( (      `-._ ) \0A             `._)   \5C `.        v \0A              / \5C__  \5C  \5C       \0A            _/_ / `` -\5C -\5C       \0A             \5C   \5C-..._\5C  \5C    \0A           . | _ /_     \5C.-\5C     \0A          / `.\5C  \5C ``-.. :  :    \0A         /`. `---+|_    `|-.|      \0A         | / _.._/  ``-. |  |      \0A         |`. .-/ /-.._  ` - :      \0A          \5C/..`\5C      `..._/     \0A           `.   |--.._( +-.        \0A                |    (`/           \0A               /__.-:`/-.-._       \0A               )    |:.._.. `.     \0A               :_.-.||.. `... \5C   \0A                )_.-::`...\5C/-.(   \0A                 )  .`:._..`. /    \0A                  `:   /  \5C  /    \0A                    `-/----.\00", align 1
+@str = global i8* getelementptr inbounds ([911 x i8], [911 x i8]* @.str, i32 0, i32 0), align 8
+
+define i8* @f(i32 %c) nounwind uwtable ssp {
+entry:
+  %c.addr = alloca i32, align 4
+  store i32 %c, i32* %c.addr, align 4
+  %0 = load i8*, i8** @str, align 8
+  %1 = load i32, i32* %c.addr, align 4
+  %idx.ext = zext i32 %1 to i64
+  %add.ptr = getelementptr inbounds i8, i8* %0, i64 %idx.ext
+  ret i8* %add.ptr
+}
@@ -0,0 +1,348 @@
+; RUN: %LLC -mtriple="x86_64-pc-linux-gnu" -filetype=obj %s -o %t.o
+; RUN: %MCLinker -mtriple="x86_64-pc-linux-gnu" -shared --hash-style=both \
+; RUN: %t.o -o %t.so
+
+; Every exported function is found through the buckets and the chains of
+; .hash and .gnu.hash.
+; RUN: readelf -I %t.so | FileCheck %s -check-prefix=HIST
+; HIST: Histogram for bucket list length
+; HIST: 100.0%
+; HIST: Histogram for `.gnu.hash' bucket list length
+; HIST: 100.0%
+; RUN: readelf -sD %t.so | FileCheck %s -check-prefix=SYM
+; SYM-DAG: FUNC{{[ ]+}}GLOBAL{{[ ]+}}DEFAULT{{[ ]+}}{{[0-9]+}}{{[ ]+}}f0
+; SYM-DAG: FUNC{{[ ]+}}GLOBAL{{[ ]+}}DEFAULT{{[ ]+}}{{[0-9]+}}{{[ ]+}}f37
+; SYM-DAG: FUNC{{[ ]+}}GLOBAL{{[ ]+}}DEFAULT{{[ ]+}}{{[0-9]+}}{{[ ]+}}f331
+
+; The 64 to 95 hashed symbols need a bloom filter of eight 64-bit words, which
+; follow the four-word header. The names are chosen so that every half of
+; every word has a bit set by the functions.
+; RUN: readelf -x .gnu.hash %t.so | FileCheck %s -check-prefix=BLOOM
+; BLOOM: Hex dump of section '.gnu.hash'
+; BLOOM-NEXT: 0x{{[0-9a-f]+}} {{[0-9a-f]+}} {{[0-9a-f]+}} 08000000 09000000
+; BLOOM-NEXT: 0x{{[0-9a-f]+}} {{0*[1-9a-f][0-9a-f]*}} {{0*[1-9a-f][0-9a-f]*}} {{0*[1-9a-f][0-9a-f]*}} {{0*[1-9a-f][0-9a-f]*}}
+; BLOOM-NEXT: 0x{{[0-9a-f]+}} {{0*[1-9a-f][0-9a-f]*}} {{0*[1-9a-f][0-9a-f]*}} {{0*[1-9a-f][0-9a-f]*}} {{0*[1-9a-f][0-9a-f]*}}
+; BLOOM-NEXT: 0x{{[0-9a-f]+}} {{0*[1-9a-f][0-9a-f]*}} {{0*[1-9a-f][0-9a-f]*}} {{0*[1-9a-f][0-9a-f]*}} {{0*[1-9a-f][0-9a-f]*}}
+; BLOOM-NEXT: 0x{{[0-9a-f]+}} {{0*[1-9a-f][0-9a-f]*}} {{0*[1-9a-f][0-9a-f]*}} {{0*[1-9a-f][0-9a-f]*}} {{0*[1-9a-f][0-9a-f]*}}
+
+target triple = "x86_64-pc-linux-gnu"
+
+define i32 @f0() nounwind {
+entry:
+  ret i32 0
+}
+
+define i32 @f37() nounwind {
+entry:
+  ret i32 1
+}
+
+define i32 @f74() nounwind {
+entry:
+  ret i32 2
+}
+
+define i32 @f111() nounwind {
+entry:
+  ret i32 3
+}
+
+define i32 @f148() nounwind {
+entry:
+  ret i32 4
+}
+
+define i32 @f185() nounwind {
+entry:
+  ret i32 5
+}
+
+define i32 @f222() nounwind {
+entry:
+  ret i32 6
+}
+
+define i32 @f259() nounwind {
+entry:
+  ret i32 7
+}
+
+define i32 @f296() nounwind {
+entry:
+  ret i32 8
+}
+
+define i32 @f333() nounwind {
+entry:
+  ret i32 9
+}
+
+define i32 @f370() nounwind {
+entry:
+  ret i32 10
+}
+
+define i32 @f407() nounwind {
+entry:
+  ret i32 11
+}
+
+define i32 @f444() nounwind {
+entry:
+  ret i32 12
+}
+
+define i32 @f481() nounwind {
+entry:
+  ret i32 13
+}
+
+define i32 @f518() nounwind {
+entry:
+  ret i32 14
+}
+
+define i32 @f555() nounwind {
+entry:
+  ret i32 15
+}
+
+define i32 @f592() nounwind {
+entry:
+  ret i32 16
+}
+
+define i32 @f629() nounwind {
+entry:
+  ret i32 17
+}
+
+define i32 @f666() nounwind {
+entry:
+  ret i32 18
+}
+
+define i32 @f703() nounwind {
+entry:
+  ret i32 19
+}
+
+define i32 @f740() nounwind {
+entry:
+  ret i32 20
+}
+
+define i32 @f777() nounwind {
+entry:
+  ret i32 21
+}
+
+define i32 @f814() nounwind {
+entry:
+  ret i32 22
+}
+
+define i32 @f851() nounwind {
+entry:
+  ret i32 23
+}
+
+define i32 @f888() nounwind {
+entry:
+  ret i32 24
+}
+
+define i32 @f925() nounwind {
+entry:
+  ret i32 25
+}
+
+define i32 @f962() nounwind {
+entry:
+  ret i32 26
+}
+
+define i32 @f999() nounwind {
+entry:
+  ret i32 27
+}
+
+define i32 @f36() nounwind {
+entry:
+  ret i32 28
+}
+
+define i32 @f73() nounwind {
+entry:
+  ret i32 29
+}
+
+define i32 @f110() nounwind {
+entry:
+  ret i32 30
+}
+
+define i32 @f147() nounwind {
+entry:
+  ret i32 31
+}
+
+define i32 @f184() nounwind {
+entry:
+  ret i32 32
+}
+
+define i32 @f221() nounwind {
+entry:
+  ret i32 33
+}
+
+define i32 @f258() nounwind {
+entry:
+  ret i32 34
+}
+
+define i32 @f295() nounwind {
+entry:
+  ret i32 35
+}
+
+define i32 @f332() nounwind {
+entry:
+  ret i32 36
+}
+
+define i32 @f369() nounwind {
+entry:
+  ret i32 37
+}
+
+define i32 @f406() nounwind {
+entry:
+  ret i32 38
+}
+
+define i32 @f443() nounwind {
+entry:
+  ret i32 39
+}
+
+define i32 @f480() nounwind {
+entry:
+  ret i32 40
+}
+
+define i32 @f517() nounwind {
+entry:
+  ret i32 41
+}
+
+define i32 @f554() nounwind {
+entry:
+  ret i32 42
+}
+
+define i32 @f591() nounwind {
+entry:
+  ret i32 43
+}
+
+define i32 @f628() nounwind {
+entry:
+  ret i32 44
+}
+
+define i32 @f665() nounwind {
+entry:
+  ret i32 45
+}
+
+define i32 @f702() nounwind {
+entry:
+  ret i32 46
+}
+
+define i32 @f739() nounwind {
+entry:
+  ret i32 47
+}
+
+define i32 @f776() nounwind {
+entry:
+  ret i32 48
+}
+
+define i32 @f813() nounwind {
+entry:
+  ret i32 49
+}
+
+define i32 @f850() nounwind {
+entry:
+  ret i32 50
+}
+
+define i32 @f887() nounwind {
+entry:
+  ret i32 51
+}
+
+define i32 @f924() nounwind {
+entry:
+  ret i32 52
+}
+
+define i32 @f961() nounwind {
+entry:
+  ret i32 53
+}
+
+define i32 @f998() nounwind {
+entry:
+  ret i32 54
+}
+
+define i32 @f35() nounwind {
+entry:
+  ret i32 55
+}
+
+define i32 @f72() nounwind {
+entry:
+  ret i32 56
+}
+
+define i32 @f109() nounwind {
+entry:
+  ret i32 57
+}
+
+define i32 @f146() nounwind {
+entry:
+  ret i32 58
+}
+
+define i32 @f183() nounwind {
+entry:
+  ret i32 59
+}
+
+define i32 @f220() nounwind {
+entry:
+  ret i32 60
+}
+
+define i32 @f257() nounwind {
+entry:
+  ret i32 61
+}
+
+define i32 @f294() nounwind {
+entry:
+  ret i32 62
+}
+
+define i32 @f331() nounwind {
+entry:
+  ret i32 63
+}
@@ -0,0 +1,51 @@
+; RUN: %LLC -mtriple="arm-none-linux-gnueabi" -march=arm \
+; RUN: -filetype=obj -relocation-model=pic %s -o %t.o
+; RUN: rm -f %t.so %t.old.so
+; RUN: %MCLinker -mtriple="arm-none-linux-gnueabi" --threads=1 \
+; RUN: -shared %t.o -o %t.1.so
+
+; The output replaces the old file instead of writing over it, and is closed
+; on another thread with more than one thread.
+; RUN: %MCLinker -mtriple="arm-none-linux-gnueabi" --threads=4 \
+; RUN: -shared -soname=old %t.o -o %t.so
+; RUN: cp %t.so %t.copy.so
+; RUN: ln %t.so %t.old.so
+; RUN: %MCLinker -mtriple="arm-none-linux-gnueabi" --threads=4 \
+; RUN: -shared %t.o -o %t.so
+; RUN: cmp %t.1.so %t.so
+; RUN: cmp %t.copy.so %t.old.so
+
+; A failed link leaves the last output as it is, and no temporary file.
+; RUN: not %MCLinker -mtriple="arm-none-linux-gnueabi" --threads=4 \
+; RUN: -shared %t.o %t.missing.o -o %t.so
+; RUN: cmp %t.1.so %t.so
+; RUN: sh -c 'ls %t.so.* 2> /dev/null | wc -l' | grep '^0$'
+
+; A file that can not be replaced is written in place.
+; RUN: %MCLinker -mtriple="arm-none-linux-gnueabi" --threads=4 \
+; RUN: -shared %t.o -o /dev/null
+
+; The server closes the output of a link through its descriptor, and waits
+; for it after releasing the link.
+; RUN: rm -f %t.sock
+; RUN: sh -c '%MCLinker --server=%t.sock > /dev/null 2>&1 & echo $! > %t.pid'
+; RUN: sh -c 'for i in 1 2 3 4 5 6 7 8 9 10; do \
+; RUN:   test -S %t.sock && exit 0; sleep 1; done; exit 1'
+; RUN: %MCLinker --connect=%t.sock -mtriple="arm-none-linux-gnueabi" \
+; RUN: --threads=4 -shared %t.o -o %t.first.so
+; RUN: %MCLinker --connect=%t.sock -mtriple="arm-none-linux-gnueabi" \
+; RUN: --threads=4 -shared %t.o -o %t.second.so
+; RUN: sh -c 'kill `cat %t.pid`'
+; RUN: cmp %t.1.so %t.first.so
+; RUN: cmp %t.1.so %t.second.so
+
+target triple = "arm-none-linux-gnueabi"
+
+@str = global [6 x i8] c"hello\00", align 1
+
+define i8* @f(i32 %c) nounwind {
+entry:
+  %idx.ext = zext i32 %c to i64
+  %add.ptr = getelementptr inbounds [6 x i8], [6 x i8]* @str, i64 0, i64 %idx.ext
+  ret i8* %add.ptr
+}
@@ -0,0 +1,46 @@
+; RUN: sed -e 's/ADDEND/42/' %s > %t.ll
+; RUN: %LLC -mtriple="arm-none-linux-gnueabi" -march=arm \
+; RUN: -filetype=obj -relocation-model=pic %t.ll -o %t.old.o
+; RUN: sed -e 's/ADDEND/43/' %s > %t.ll
+; RUN: %LLC -mtriple="arm-none-linux-gnueabi" -march=arm \
+; RUN: -filetype=obj -relocation-model=pic %t.ll -o %t.new.o
+; RUN: %MCLinker -mtriple="arm-none-linux-gnueabi" \
+; RUN: -shared %t.new.o -o %t.full.so
+
+; The first link is a full link, which writes the link state.
+; RUN: rm -f %t.inc.so %t.inc.so.mcld-state
+; RUN: cp %t.old.o %t.o
+; RUN: touch -r %s %t.o
+; RUN: %MCLinker --patch-identical-layout -mtriple="arm-none-linux-gnueabi" \
+; RUN: -shared %t.o -o %t.inc.so
+; RUN: test -f %t.inc.so.mcld-state
+
+; Only the code of f changes, so the output is patched. The change is found
+; even though the object keeps its size and modification time, and the old
+; output is replaced rather than written over.
+; RUN: cp %t.new.o %t.o
+; RUN: touch -r %s %t.o
+; RUN: ln -f %t.inc.so %t.inc.old.so
+; RUN: %MCLinker --patch-identical-layout -mtriple="arm-none-linux-gnueabi" \
+; RUN: -shared %t.o -o %t.inc.so
+; RUN: cmp %t.full.so %t.inc.so
+; RUN: not cmp %t.full.so %t.inc.old.so
+
+; Another command line links in full.
+; RUN: %MCLinker --patch-identical-layout -mtriple="arm-none-linux-gnueabi" \
+; RUN: -shared -soname=inc %t.o -o %t.inc.so
+; RUN: %MCLinker --patch-identical-layout -mtriple="arm-none-linux-gnueabi" \
+; RUN: -shared %t.o -o %t.inc.so
+; RUN: cmp %t.full.so %t.inc.so
+
+target triple = "arm-none-linux-gnueabi"
+
+@str = global [64 x i8] zeroinitializer, align 1
+
+define i8* @f(i32 %c) nounwind {
+entry:
+  %idx = add i32 %c, ADDEND
+  %idx.ext = zext i32 %idx to i64
+  %add.ptr = getelementptr inbounds [64 x i8], [64 x i8]* @str, i64 0, i64 %idx.ext
+  ret i8* %add.ptr
+}
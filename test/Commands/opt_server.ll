@@ -0,0 +1,50 @@
+; RUN: %LLC -mtriple="arm-none-linux-gnueabi" -march=arm \
+; RUN: -filetype=obj -relocation-model=pic %s -o %t.o
+; RUN: %MCLinker -mtriple="arm-none-linux-gnueabi" \
+; RUN: -shared %t.o -o %t.lib.so
+; RUN: %MCLinker -mtriple="arm-none-linux-gnueabi" \
+; RUN: -shared %t.o %t.lib.so -o %t.cold.so
+
+; An unreachable server falls back to a local link.
+; RUN: rm -f %t.sock
+; RUN: %MCLinker --connect=%t.sock -mtriple="arm-none-linux-gnueabi" \
+; RUN: -shared %t.o %t.lib.so -o %t.local.so
+; RUN: cmp %t.cold.so %t.local.so
+
+; A server never replaces a file that is not a socket.
+; RUN: echo keep > %t.file
+; RUN: not %MCLinker --server=%t.file
+; RUN: grep keep %t.file
+
+; The second link reuses the inputs cached by the first one.
+; RUN: sh -c '%MCLinker --server=%t.sock > /dev/null 2>&1 & echo $! > %t.pid'
+; RUN: sh -c 'for i in 1 2 3 4 5 6 7 8 9 10; do \
+; RUN:   test -S %t.sock && exit 0; sleep 1; done; exit 1'
+; RUN: %MCLinker --connect=%t.sock -mtriple="arm-none-linux-gnueabi" \
+; RUN: -shared %t.o %t.lib.so -o %t.first.so
+; RUN: %MCLinker --connect=%t.sock -mtriple="arm-none-linux-gnueabi" \
+; RUN: -shared %t.o %t.lib.so -o %t.second.so
+; RUN: not %MCLinker --connect=%t.sock -mtriple="arm-none-linux-gnueabi" \
+; RUN: -shared %t.o %t.missing.so -o %t.bad.so
+; RUN: %MCLinker --connect=%t.sock -mtriple="arm-none-linux-gnueabi" \
+; RUN: -shared %t.o %t.lib.so -o %t.third.so
+; RUN: ls -l %t.sock | grep '^srw------- '
+; RUN: sh -c 'kill `cat %t.pid`'
+
+; The server takes its worker down and removes the socket when it is killed.
+; RUN: sh -c 'for i in 1 2 3 4 5 6 7 8 9 10; do \
+; RUN:   test -S %t.sock || exit 0; sleep 1; done; exit 1'
+; RUN: cmp %t.cold.so %t.first.so
+; RUN: cmp %t.cold.so %t.second.so
+; RUN: cmp %t.cold.so %t.third.so
+
+target triple = "arm-none-linux-gnueabi"
+
+@str = global [6 x i8] c"hello\00", align 1
+
+define i8* @f(i32 %c) nounwind {
+entry:
+  %idx.ext = zext i32 %c to i64
+  %add.ptr = getelementptr inbounds [6 x i8], [6 x i8]* @str, i64 0, i64 %idx.ext
+  ret i8* %add.ptr
+}
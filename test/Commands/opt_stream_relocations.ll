@@ -0,0 +1,47 @@
+; RUN: %LLC -mtriple="x86_64-pc-linux-gnu" -filetype=obj \
+; RUN: -relocation-model=pic %s -o %t.x86_64.o
+; RUN: %MCLinker -mtriple="x86_64-pc-linux-gnu" -shared \
+; RUN: %t.x86_64.o -o %t.x86_64.so
+; RUN: %MCLinker -mtriple="x86_64-pc-linux-gnu" -shared --stream-relocations \
+; RUN: %t.x86_64.o -o %t.x86_64.stream.so
+; RUN: %MCLinker -mtriple="x86_64-pc-linux-gnu" -shared --stream-relocations \
+; RUN: --threads=4 %t.x86_64.o -o %t.x86_64.stream4.so
+; RUN: cmp %t.x86_64.so %t.x86_64.stream.so
+; RUN: cmp %t.x86_64.so %t.x86_64.stream4.so
+
+; The relocations in .ARM.exidx are written after the other input
+; contents.
+; RUN: %LLC -mtriple="arm-none-linux-gnueabi" -march=arm -filetype=obj \
+; RUN: -relocation-model=pic %s -o %t.arm.o
+; RUN: %MCLinker -mtriple="arm-none-linux-gnueabi" -march=arm -shared \
+; RUN: %t.arm.o -o %t.arm.so
+; RUN: %MCLinker -mtriple="arm-none-linux-gnueabi" -march=arm -shared \
+; RUN: --stream-relocations %t.arm.o -o %t.arm.stream.so
+; RUN: cmp %t.arm.so %t.arm.stream.so
+; RUN: readelf -S %t.arm.stream.so | FileCheck %s
+; CHECK: .ARM.exidx
+
+@table = global [8 x i32] zeroinitializer, align 4
+@table_ptr = global i32* getelementptr inbounds ([8 x i32], [8 x i32]* @table, i32 0, i32 4), align 4
+@ext_var = external global i32
+
+declare i32 @ext_func(i32)
+
+define internal i32 @helper(i32 %x) nounwind noinline {
+entry:
+  %idx = and i32 %x, 7
+  %p = getelementptr inbounds [8 x i32], [8 x i32]* @table, i32 0, i32 %idx
+  %v = load i32, i32* %p, align 4
+  %sum = add i32 %v, %x
+  store i32 %sum, i32* %p, align 4
+  ret i32 %sum
+}
+
+define i32 @entry(i32 %x) {
+entry:
+  %a = call i32 @helper(i32 %x)
+  %b = call i32 @ext_func(i32 %a)
+  %e = load i32, i32* @ext_var, align 4
+  %s = add i32 %b, %e
+  ret i32 %s
+}
@@ -0,0 +1,2324 @@
+; RUN: %LLC -mtriple="x86_64-pc-linux-gnu" -filetype=obj -function-sections \
+; RUN: -data-sections -relocation-model=pic %s -o %t.o
+
+; .text gathers more than 256 fragments and most of the input contents, so
+; it is split into chunks of fragments. The other sections and the symbol
+; tables are written on the workers as well.
+; RUN: %MCLinker -mtriple="x86_64-pc-linux-gnu" -shared --threads=1 \
+; RUN: %t.o -o %t.1.so
+; RUN: %MCLinker -mtriple="x86_64-pc-linux-gnu" -shared --threads=4 \
+; RUN: %t.o -o %t.4.so
+; RUN: cmp %t.1.so %t.4.so
+
+; RUN: readelf -s %t.4.so | FileCheck %s
+; CHECK: Symbol table '.dynsym'
+; CHECK: func0
+; CHECK: Symbol table '.symtab'
+; CHECK: func319
+
+target triple = "x86_64-pc-linux-gnu"
+
+@data0 = global i32 0, align 4
+@data1 = global i32 1, align 4
+@data2 = global i32 2, align 4
+@data3 = global i32 3, align 4
+@data4 = global i32 4, align 4
+@data5 = global i32 5, align 4
+@data6 = global i32 6, align 4
+@data7 = global i32 7, align 4
+@data8 = global i32 8, align 4
+@data9 = global i32 9, align 4
+@data10 = global i32 10, align 4
+@data11 = global i32 11, align 4
+@data12 = global i32 12, align 4
+@data13 = global i32 13, align 4
+@data14 = global i32 14, align 4
+@data15 = global i32 15, align 4
+@data16 = global i32 16, align 4
+@data17 = global i32 17, align 4
+@data18 = global i32 18, align 4
+@data19 = global i32 19, align 4
+@data20 = global i32 20, align 4
+@data21 = global i32 21, align 4
+@data22 = global i32 22, align 4
+@data23 = global i32 23, align 4
+@data24 = global i32 24, align 4
+@data25 = global i32 25, align 4
+@data26 = global i32 26, align 4
+@data27 = global i32 27, align 4
+@data28 = global i32 28, align 4
+@data29 = global i32 29, align 4
+@data30 = global i32 30, align 4
+@data31 = global i32 31, align 4
+@data32 = global i32 32, align 4
+@data33 = global i32 33, align 4
+@data34 = global i32 34, align 4
+@data35 = global i32 35, align 4
+@data36 = global i32 36, align 4
+@data37 = global i32 37, align 4
+@data38 = global i32 38, align 4
+@data39 = global i32 39, align 4
+@data40 = global i32 40, align 4
+@data41 = global i32 41, align 4
+@data42 = global i32 42, align 4
+@data43 = global i32 43, align 4
+@data44 = global i32 44, align 4
+@data45 = global i32 45, align 4
+@data46 = global i32 46, align 4
+@data47 = global i32 47, align 4
+@data48 = global i32 48, align 4
+@data49 = global i32 49, align 4
+@data50 = global i32 50, align 4
+@data51 = global i32 51, align 4
+@data52 = global i32 52, align 4
+@data53 = global i32 53, align 4
+@data54 = global i32 54, align 4
+@data55 = global i32 55, align 4
+@data56 = global i32 56, align 4
+@data57 = global i32 57, align 4
+@data58 = global i32 58, align 4
+@data59 = global i32 59, align 4
+@data60 = global i32 60, align 4
+@data61 = global i32 61, align 4
+@data62 = global i32 62, align 4
+@data63 = global i32 63, align 4
+
+define i32 @func0(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data0, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func1(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data1, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func2(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data2, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func3(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data3, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func4(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data4, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func5(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data5, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func6(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data6, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func7(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data7, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func8(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data8, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func9(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data9, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func10(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data10, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func11(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data11, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func12(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data12, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func13(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data13, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func14(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data14, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func15(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data15, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func16(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data16, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func17(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data17, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func18(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data18, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func19(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data19, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func20(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data20, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func21(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data21, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func22(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data22, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func23(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data23, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func24(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data24, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func25(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data25, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func26(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data26, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func27(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data27, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func28(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data28, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func29(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data29, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func30(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data30, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func31(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data31, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func32(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data32, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func33(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data33, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func34(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data34, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func35(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data35, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func36(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data36, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func37(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data37, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func38(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data38, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func39(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data39, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func40(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data40, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func41(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data41, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func42(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data42, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func43(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data43, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func44(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data44, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func45(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data45, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func46(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data46, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func47(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data47, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func48(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data48, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func49(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data49, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func50(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data50, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func51(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data51, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func52(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data52, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func53(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data53, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func54(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data54, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func55(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data55, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func56(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data56, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func57(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data57, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func58(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data58, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func59(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data59, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func60(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data60, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func61(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data61, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func62(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data62, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func63(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data63, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func64(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data0, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func65(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data1, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func66(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data2, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func67(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data3, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func68(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data4, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func69(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data5, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func70(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data6, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func71(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data7, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func72(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data8, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func73(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data9, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func74(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data10, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func75(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data11, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func76(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data12, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func77(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data13, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func78(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data14, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func79(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data15, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func80(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data16, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func81(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data17, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func82(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data18, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func83(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data19, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func84(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data20, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func85(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data21, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func86(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data22, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func87(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data23, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func88(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data24, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func89(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data25, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func90(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data26, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func91(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data27, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func92(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data28, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func93(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data29, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func94(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data30, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func95(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data31, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func96(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data32, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func97(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data33, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func98(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data34, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func99(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data35, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func100(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data36, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func101(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data37, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func102(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data38, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func103(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data39, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func104(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data40, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func105(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data41, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func106(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data42, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func107(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data43, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func108(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data44, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func109(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data45, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func110(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data46, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func111(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data47, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func112(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data48, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func113(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data49, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func114(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data50, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func115(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data51, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func116(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data52, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func117(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data53, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func118(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data54, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func119(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data55, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func120(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data56, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func121(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data57, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func122(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data58, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func123(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data59, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func124(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data60, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func125(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data61, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func126(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data62, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func127(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data63, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func128(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data0, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func129(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data1, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func130(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data2, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func131(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data3, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func132(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data4, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func133(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data5, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func134(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data6, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func135(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data7, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func136(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data8, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func137(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data9, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func138(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data10, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func139(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data11, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func140(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data12, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func141(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data13, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func142(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data14, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func143(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data15, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func144(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data16, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func145(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data17, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func146(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data18, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func147(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data19, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func148(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data20, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func149(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data21, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func150(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data22, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func151(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data23, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func152(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data24, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func153(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data25, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func154(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data26, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func155(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data27, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func156(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data28, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func157(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data29, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func158(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data30, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func159(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data31, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func160(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data32, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func161(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data33, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func162(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data34, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func163(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data35, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func164(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data36, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func165(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data37, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func166(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data38, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func167(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data39, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func168(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data40, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func169(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data41, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func170(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data42, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func171(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data43, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func172(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data44, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func173(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data45, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func174(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data46, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func175(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data47, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func176(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data48, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func177(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data49, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func178(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data50, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func179(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data51, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func180(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data52, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func181(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data53, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func182(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data54, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func183(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data55, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func184(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data56, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func185(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data57, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func186(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data58, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func187(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data59, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func188(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data60, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func189(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data61, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func190(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data62, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func191(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data63, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func192(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data0, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func193(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data1, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func194(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data2, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func195(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data3, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func196(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data4, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func197(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data5, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func198(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data6, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func199(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data7, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func200(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data8, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func201(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data9, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func202(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data10, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func203(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data11, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func204(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data12, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func205(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data13, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func206(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data14, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func207(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data15, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func208(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data16, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func209(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data17, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func210(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data18, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func211(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data19, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func212(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data20, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func213(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data21, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func214(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data22, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func215(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data23, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func216(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data24, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func217(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data25, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func218(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data26, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func219(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data27, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func220(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data28, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func221(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data29, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func222(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data30, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func223(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data31, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func224(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data32, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func225(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data33, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func226(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data34, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func227(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data35, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func228(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data36, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func229(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data37, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func230(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data38, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func231(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data39, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func232(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data40, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func233(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data41, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func234(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data42, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func235(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data43, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func236(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data44, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func237(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data45, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func238(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data46, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func239(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data47, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func240(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data48, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func241(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data49, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func242(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data50, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func243(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data51, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func244(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data52, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func245(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data53, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func246(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data54, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func247(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data55, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func248(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data56, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func249(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data57, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func250(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data58, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func251(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data59, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func252(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data60, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func253(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data61, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func254(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data62, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func255(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data63, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func256(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data0, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func257(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data1, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func258(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data2, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func259(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data3, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func260(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data4, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func261(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data5, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func262(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data6, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func263(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data7, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func264(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data8, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func265(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data9, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func266(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data10, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func267(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data11, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func268(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data12, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func269(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data13, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func270(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data14, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func271(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data15, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func272(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data16, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func273(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data17, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func274(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data18, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func275(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data19, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func276(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data20, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func277(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data21, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func278(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data22, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func279(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data23, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func280(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data24, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func281(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data25, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func282(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data26, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func283(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data27, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func284(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data28, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func285(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data29, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func286(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data30, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func287(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data31, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func288(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data32, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func289(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data33, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func290(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data34, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func291(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data35, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func292(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data36, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func293(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data37, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func294(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data38, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func295(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data39, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func296(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data40, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func297(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data41, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func298(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data42, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func299(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data43, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func300(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data44, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func301(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data45, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func302(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data46, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func303(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data47, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func304(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data48, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func305(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data49, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func306(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data50, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func307(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data51, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func308(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data52, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func309(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data53, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func310(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data54, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func311(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data55, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func312(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data56, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func313(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data57, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func314(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data58, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func315(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data59, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func316(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data60, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func317(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data61, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func318(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data62, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
+
+define i32 @func319(i32 %x) nounwind {
+entry:
+  %v = load i32, i32* @data63, align 4
+  %s = add i32 %v, %x
+  ret i32 %s
+}
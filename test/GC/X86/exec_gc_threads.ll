@@ -0,0 +1,1828 @@
+; RUN: %LLC -mtriple="x86_64-pc-linux-gnu" -filetype=obj -function-sections \
+; RUN: %s -o %t.o
+; RUN: %MCLinker -mtriple="x86_64-pc-linux-gnu" -e main --gc-sections \
+; RUN: --print-gc-sections --threads=1 %t.o -o %t.1.out 2> %t.1.log
+; RUN: %MCLinker -mtriple="x86_64-pc-linux-gnu" -e main --gc-sections \
+; RUN: --print-gc-sections --threads=4 %t.o -o %t.4.out 2> %t.4.log
+
+; main reaches more sections than a worker keeps to itself, so the others
+; steal them. Every thread count strips the same sections.
+; RUN: sort %t.1.log > %t.1.sorted
+; RUN: sort %t.4.log > %t.4.sorted
+; RUN: diff %t.1.sorted %t.4.sorted
+; RUN: cmp %t.1.out %t.4.out
+
+; RUN: readelf -s %t.4.out | FileCheck %s
+; CHECK-NOT: dead
+; CHECK-DAG: live0
+; CHECK-DAG: live99
+; CHECK-DAG: leaf0
+; CHECK-DAG: leaf99
+; CHECK-NOT: dead
+
+target triple = "x86_64-pc-linux-gnu"
+
+define i32 @main() nounwind {
+entry:
+  call void @live0()
+  call void @live1()
+  call void @live2()
+  call void @live3()
+  call void @live4()
+  call void @live5()
+  call void @live6()
+  call void @live7()
+  call void @live8()
+  call void @live9()
+  call void @live10()
+  call void @live11()
+  call void @live12()
+  call void @live13()
+  call void @live14()
+  call void @live15()
+  call void @live16()
+  call void @live17()
+  call void @live18()
+  call void @live19()
+  call void @live20()
+  call void @live21()
+  call void @live22()
+  call void @live23()
+  call void @live24()
+  call void @live25()
+  call void @live26()
+  call void @live27()
+  call void @live28()
+  call void @live29()
+  call void @live30()
+  call void @live31()
+  call void @live32()
+  call void @live33()
+  call void @live34()
+  call void @live35()
+  call void @live36()
+  call void @live37()
+  call void @live38()
+  call void @live39()
+  call void @live40()
+  call void @live41()
+  call void @live42()
+  call void @live43()
+  call void @live44()
+  call void @live45()
+  call void @live46()
+  call void @live47()
+  call void @live48()
+  call void @live49()
+  call void @live50()
+  call void @live51()
+  call void @live52()
+  call void @live53()
+  call void @live54()
+  call void @live55()
+  call void @live56()
+  call void @live57()
+  call void @live58()
+  call void @live59()
+  call void @live60()
+  call void @live61()
+  call void @live62()
+  call void @live63()
+  call void @live64()
+  call void @live65()
+  call void @live66()
+  call void @live67()
+  call void @live68()
+  call void @live69()
+  call void @live70()
+  call void @live71()
+  call void @live72()
+  call void @live73()
+  call void @live74()
+  call void @live75()
+  call void @live76()
+  call void @live77()
+  call void @live78()
+  call void @live79()
+  call void @live80()
+  call void @live81()
+  call void @live82()
+  call void @live83()
+  call void @live84()
+  call void @live85()
+  call void @live86()
+  call void @live87()
+  call void @live88()
+  call void @live89()
+  call void @live90()
+  call void @live91()
+  call void @live92()
+  call void @live93()
+  call void @live94()
+  call void @live95()
+  call void @live96()
+  call void @live97()
+  call void @live98()
+  call void @live99()
+  ret i32 0
+}
+
+define void @live0() nounwind {
+entry:
+  call void @leaf0()
+  ret void
+}
+
+define void @leaf0() nounwind {
+entry:
+  ret void
+}
+
+define void @dead0() nounwind {
+entry:
+  call void @leaf0()
+  ret void
+}
+
+define void @live1() nounwind {
+entry:
+  call void @leaf1()
+  ret void
+}
+
+define void @leaf1() nounwind {
+entry:
+  ret void
+}
+
+define void @dead1() nounwind {
+entry:
+  call void @leaf1()
+  ret void
+}
+
+define void @live2() nounwind {
+entry:
+  call void @leaf2()
+  ret void
+}
+
+define void @leaf2() nounwind {
+entry:
+  ret void
+}
+
+define void @dead2() nounwind {
+entry:
+  call void @leaf2()
+  ret void
+}
+
+define void @live3() nounwind {
+entry:
+  call void @leaf3()
+  ret void
+}
+
+define void @leaf3() nounwind {
+entry:
+  ret void
+}
+
+define void @dead3() nounwind {
+entry:
+  call void @leaf3()
+  ret void
+}
+
+define void @live4() nounwind {
+entry:
+  call void @leaf4()
+  ret void
+}
+
+define void @leaf4() nounwind {
+entry:
+  ret void
+}
+
+define void @dead4() nounwind {
+entry:
+  call void @leaf4()
+  ret void
+}
+
+define void @live5() nounwind {
+entry:
+  call void @leaf5()
+  ret void
+}
+
+define void @leaf5() nounwind {
+entry:
+  ret void
+}
+
+define void @dead5() nounwind {
+entry:
+  call void @leaf5()
+  ret void
+}
+
+define void @live6() nounwind {
+entry:
+  call void @leaf6()
+  ret void
+}
+
+define void @leaf6() nounwind {
+entry:
+  ret void
+}
+
+define void @dead6() nounwind {
+entry:
+  call void @leaf6()
+  ret void
+}
+
+define void @live7() nounwind {
+entry:
+  call void @leaf7()
+  ret void
+}
+
+define void @leaf7() nounwind {
+entry:
+  ret void
+}
+
+define void @dead7() nounwind {
+entry:
+  call void @leaf7()
+  ret void
+}
+
+define void @live8() nounwind {
+entry:
+  call void @leaf8()
+  ret void
+}
+
+define void @leaf8() nounwind {
+entry:
+  ret void
+}
+
+define void @dead8() nounwind {
+entry:
+  call void @leaf8()
+  ret void
+}
+
+define void @live9() nounwind {
+entry:
+  call void @leaf9()
+  ret void
+}
+
+define void @leaf9() nounwind {
+entry:
+  ret void
+}
+
+define void @dead9() nounwind {
+entry:
+  call void @leaf9()
+  ret void
+}
+
+define void @live10() nounwind {
+entry:
+  call void @leaf10()
+  ret void
+}
+
+define void @leaf10() nounwind {
+entry:
+  ret void
+}
+
+define void @dead10() nounwind {
+entry:
+  call void @leaf10()
+  ret void
+}
+
+define void @live11() nounwind {
+entry:
+  call void @leaf11()
+  ret void
+}
+
+define void @leaf11() nounwind {
+entry:
+  ret void
+}
+
+define void @dead11() nounwind {
+entry:
+  call void @leaf11()
+  ret void
+}
+
+define void @live12() nounwind {
+entry:
+  call void @leaf12()
+  ret void
+}
+
+define void @leaf12() nounwind {
+entry:
+  ret void
+}
+
+define void @dead12() nounwind {
+entry:
+  call void @leaf12()
+  ret void
+}
+
+define void @live13() nounwind {
+entry:
+  call void @leaf13()
+  ret void
+}
+
+define void @leaf13() nounwind {
+entry:
+  ret void
+}
+
+define void @dead13() nounwind {
+entry:
+  call void @leaf13()
+  ret void
+}
+
+define void @live14() nounwind {
+entry:
+  call void @leaf14()
+  ret void
+}
+
+define void @leaf14() nounwind {
+entry:
+  ret void
+}
+
+define void @dead14() nounwind {
+entry:
+  call void @leaf14()
+  ret void
+}
+
+define void @live15() nounwind {
+entry:
+  call void @leaf15()
+  ret void
+}
+
+define void @leaf15() nounwind {
+entry:
+  ret void
+}
+
+define void @dead15() nounwind {
+entry:
+  call void @leaf15()
+  ret void
+}
+
+define void @live16() nounwind {
+entry:
+  call void @leaf16()
+  ret void
+}
+
+define void @leaf16() nounwind {
+entry:
+  ret void
+}
+
+define void @dead16() nounwind {
+entry:
+  call void @leaf16()
+  ret void
+}
+
+define void @live17() nounwind {
+entry:
+  call void @leaf17()
+  ret void
+}
+
+define void @leaf17() nounwind {
+entry:
+  ret void
+}
+
+define void @dead17() nounwind {
+entry:
+  call void @leaf17()
+  ret void
+}
+
+define void @live18() nounwind {
+entry:
+  call void @leaf18()
+  ret void
+}
+
+define void @leaf18() nounwind {
+entry:
+  ret void
+}
+
+define void @dead18() nounwind {
+entry:
+  call void @leaf18()
+  ret void
+}
+
+define void @live19() nounwind {
+entry:
+  call void @leaf19()
+  ret void
+}
+
+define void @leaf19() nounwind {
+entry:
+  ret void
+}
+
+define void @dead19() nounwind {
+entry:
+  call void @leaf19()
+  ret void
+}
+
+define void @live20() nounwind {
+entry:
+  call void @leaf20()
+  ret void
+}
+
+define void @leaf20() nounwind {
+entry:
+  ret void
+}
+
+define void @dead20() nounwind {
+entry:
+  call void @leaf20()
+  ret void
+}
+
+define void @live21() nounwind {
+entry:
+  call void @leaf21()
+  ret void
+}
+
+define void @leaf21() nounwind {
+entry:
+  ret void
+}
+
+define void @dead21() nounwind {
+entry:
+  call void @leaf21()
+  ret void
+}
+
+define void @live22() nounwind {
+entry:
+  call void @leaf22()
+  ret void
+}
+
+define void @leaf22() nounwind {
+entry:
+  ret void
+}
+
+define void @dead22() nounwind {
+entry:
+  call void @leaf22()
+  ret void
+}
+
+define void @live23() nounwind {
+entry:
+  call void @leaf23()
+  ret void
+}
+
+define void @leaf23() nounwind {
+entry:
+  ret void
+}
+
+define void @dead23() nounwind {
+entry:
+  call void @leaf23()
+  ret void
+}
+
+define void @live24() nounwind {
+entry:
+  call void @leaf24()
+  ret void
+}
+
+define void @leaf24() nounwind {
+entry:
+  ret void
+}
+
+define void @dead24() nounwind {
+entry:
+  call void @leaf24()
+  ret void
+}
+
+define void @live25() nounwind {
+entry:
+  call void @leaf25()
+  ret void
+}
+
+define void @leaf25() nounwind {
+entry:
+  ret void
+}
+
+define void @dead25() nounwind {
+entry:
+  call void @leaf25()
+  ret void
+}
+
+define void @live26() nounwind {
+entry:
+  call void @leaf26()
+  ret void
+}
+
+define void @leaf26() nounwind {
+entry:
+  ret void
+}
+
+define void @dead26() nounwind {
+entry:
+  call void @leaf26()
+  ret void
+}
+
+define void @live27() nounwind {
+entry:
+  call void @leaf27()
+  ret void
+}
+
+define void @leaf27() nounwind {
+entry:
+  ret void
+}
+
+define void @dead27() nounwind {
+entry:
+  call void @leaf27()
+  ret void
+}
+
+define void @live28() nounwind {
+entry:
+  call void @leaf28()
+  ret void
+}
+
+define void @leaf28() nounwind {
+entry:
+  ret void
+}
+
+define void @dead28() nounwind {
+entry:
+  call void @leaf28()
+  ret void
+}
+
+define void @live29() nounwind {
+entry:
+  call void @leaf29()
+  ret void
+}
+
+define void @leaf29() nounwind {
+entry:
+  ret void
+}
+
+define void @dead29() nounwind {
+entry:
+  call void @leaf29()
+  ret void
+}
+
+define void @live30() nounwind {
+entry:
+  call void @leaf30()
+  ret void
+}
+
+define void @leaf30() nounwind {
+entry:
+  ret void
+}
+
+define void @dead30() nounwind {
+entry:
+  call void @leaf30()
+  ret void
+}
+
+define void @live31() nounwind {
+entry:
+  call void @leaf31()
+  ret void
+}
+
+define void @leaf31() nounwind {
+entry:
+  ret void
+}
+
+define void @dead31() nounwind {
+entry:
+  call void @leaf31()
+  ret void
+}
+
+define void @live32() nounwind {
+entry:
+  call void @leaf32()
+  ret void
+}
+
+define void @leaf32() nounwind {
+entry:
+  ret void
+}
+
+define void @dead32() nounwind {
+entry:
+  call void @leaf32()
+  ret void
+}
+
+define void @live33() nounwind {
+entry:
+  call void @leaf33()
+  ret void
+}
+
+define void @leaf33() nounwind {
+entry:
+  ret void
+}
+
+define void @dead33() nounwind {
+entry:
+  call void @leaf33()
+  ret void
+}
+
+define void @live34() nounwind {
+entry:
+  call void @leaf34()
+  ret void
+}
+
+define void @leaf34() nounwind {
+entry:
+  ret void
+}
+
+define void @dead34() nounwind {
+entry:
+  call void @leaf34()
+  ret void
+}
+
+define void @live35() nounwind {
+entry:
+  call void @leaf35()
+  ret void
+}
+
+define void @leaf35() nounwind {
+entry:
+  ret void
+}
+
+define void @dead35() nounwind {
+entry:
+  call void @leaf35()
+  ret void
+}
+
+define void @live36() nounwind {
+entry:
+  call void @leaf36()
+  ret void
+}
+
+define void @leaf36() nounwind {
+entry:
+  ret void
+}
+
+define void @dead36() nounwind {
+entry:
+  call void @leaf36()
+  ret void
+}
+
+define void @live37() nounwind {
+entry:
+  call void @leaf37()
+  ret void
+}
+
+define void @leaf37() nounwind {
+entry:
+  ret void
+}
+
+define void @dead37() nounwind {
+entry:
+  call void @leaf37()
+  ret void
+}
+
+define void @live38() nounwind {
+entry:
+  call void @leaf38()
+  ret void
+}
+
+define void @leaf38() nounwind {
+entry:
+  ret void
+}
+
+define void @dead38() nounwind {
+entry:
+  call void @leaf38()
+  ret void
+}
+
+define void @live39() nounwind {
+entry:
+  call void @leaf39()
+  ret void
+}
+
+define void @leaf39() nounwind {
+entry:
+  ret void
+}
+
+define void @dead39() nounwind {
+entry:
+  call void @leaf39()
+  ret void
+}
+
+define void @live40() nounwind {
+entry:
+  call void @leaf40()
+  ret void
+}
+
+define void @leaf40() nounwind {
+entry:
+  ret void
+}
+
+define void @dead40() nounwind {
+entry:
+  call void @leaf40()
+  ret void
+}
+
+define void @live41() nounwind {
+entry:
+  call void @leaf41()
+  ret void
+}
+
+define void @leaf41() nounwind {
+entry:
+  ret void
+}
+
+define void @dead41() nounwind {
+entry:
+  call void @leaf41()
+  ret void
+}
+
+define void @live42() nounwind {
+entry:
+  call void @leaf42()
+  ret void
+}
+
+define void @leaf42() nounwind {
+entry:
+  ret void
+}
+
+define void @dead42() nounwind {
+entry:
+  call void @leaf42()
+  ret void
+}
+
+define void @live43() nounwind {
+entry:
+  call void @leaf43()
+  ret void
+}
+
+define void @leaf43() nounwind {
+entry:
+  ret void
+}
+
+define void @dead43() nounwind {
+entry:
+  call void @leaf43()
+  ret void
+}
+
+define void @live44() nounwind {
+entry:
+  call void @leaf44()
+  ret void
+}
+
+define void @leaf44() nounwind {
+entry:
+  ret void
+}
+
+define void @dead44() nounwind {
+entry:
+  call void @leaf44()
+  ret void
+}
+
+define void @live45() nounwind {
+entry:
+  call void @leaf45()
+  ret void
+}
+
+define void @leaf45() nounwind {
+entry:
+  ret void
+}
+
+define void @dead45() nounwind {
+entry:
+  call void @leaf45()
+  ret void
+}
+
+define void @live46() nounwind {
+entry:
+  call void @leaf46()
+  ret void
+}
+
+define void @leaf46() nounwind {
+entry:
+  ret void
+}
+
+define void @dead46() nounwind {
+entry:
+  call void @leaf46()
+  ret void
+}
+
+define void @live47() nounwind {
+entry:
+  call void @leaf47()
+  ret void
+}
+
+define void @leaf47() nounwind {
+entry:
+  ret void
+}
+
+define void @dead47() nounwind {
+entry:
+  call void @leaf47()
+  ret void
+}
+
+define void @live48() nounwind {
+entry:
+  call void @leaf48()
+  ret void
+}
+
+define void @leaf48() nounwind {
+entry:
+  ret void
+}
+
+define void @dead48() nounwind {
+entry:
+  call void @leaf48()
+  ret void
+}
+
+define void @live49() nounwind {
+entry:
+  call void @leaf49()
+  ret void
+}
+
+define void @leaf49() nounwind {
+entry:
+  ret void
+}
+
+define void @dead49() nounwind {
+entry:
+  call void @leaf49()
+  ret void
+}
+
+define void @live50() nounwind {
+entry:
+  call void @leaf50()
+  ret void
+}
+
+define void @leaf50() nounwind {
+entry:
+  ret void
+}
+
+define void @dead50() nounwind {
+entry:
+  call void @leaf50()
+  ret void
+}
+
+define void @live51() nounwind {
+entry:
+  call void @leaf51()
+  ret void
+}
+
+define void @leaf51() nounwind {
+entry:
+  ret void
+}
+
+define void @dead51() nounwind {
+entry:
+  call void @leaf51()
+  ret void
+}
+
+define void @live52() nounwind {
+entry:
+  call void @leaf52()
+  ret void
+}
+
+define void @leaf52() nounwind {
+entry:
+  ret void
+}
+
+define void @dead52() nounwind {
+entry:
+  call void @leaf52()
+  ret void
+}
+
+define void @live53() nounwind {
+entry:
+  call void @leaf53()
+  ret void
+}
+
+define void @leaf53() nounwind {
+entry:
+  ret void
+}
+
+define void @dead53() nounwind {
+entry:
+  call void @leaf53()
+  ret void
+}
+
+define void @live54() nounwind {
+entry:
+  call void @leaf54()
+  ret void
+}
+
+define void @leaf54() nounwind {
+entry:
+  ret void
+}
+
+define void @dead54() nounwind {
+entry:
+  call void @leaf54()
+  ret void
+}
+
+define void @live55() nounwind {
+entry:
+  call void @leaf55()
+  ret void
+}
+
+define void @leaf55() nounwind {
+entry:
+  ret void
+}
+
+define void @dead55() nounwind {
+entry:
+  call void @leaf55()
+  ret void
+}
+
+define void @live56() nounwind {
+entry:
+  call void @leaf56()
+  ret void
+}
+
+define void @leaf56() nounwind {
+entry:
+  ret void
+}
+
+define void @dead56() nounwind {
+entry:
+  call void @leaf56()
+  ret void
+}
+
+define void @live57() nounwind {
+entry:
+  call void @leaf57()
+  ret void
+}
+
+define void @leaf57() nounwind {
+entry:
+  ret void
+}
+
+define void @dead57() nounwind {
+entry:
+  call void @leaf57()
+  ret void
+}
+
+define void @live58() nounwind {
+entry:
+  call void @leaf58()
+  ret void
+}
+
+define void @leaf58() nounwind {
+entry:
+  ret void
+}
+
+define void @dead58() nounwind {
+entry:
+  call void @leaf58()
+  ret void
+}
+
+define void @live59() nounwind {
+entry:
+  call void @leaf59()
+  ret void
+}
+
+define void @leaf59() nounwind {
+entry:
+  ret void
+}
+
+define void @dead59() nounwind {
+entry:
+  call void @leaf59()
+  ret void
+}
+
+define void @live60() nounwind {
+entry:
+  call void @leaf60()
+  ret void
+}
+
+define void @leaf60() nounwind {
+entry:
+  ret void
+}
+
+define void @dead60() nounwind {
+entry:
+  call void @leaf60()
+  ret void
+}
+
+define void @live61() nounwind {
+entry:
+  call void @leaf61()
+  ret void
+}
+
+define void @leaf61() nounwind {
+entry:
+  ret void
+}
+
+define void @dead61() nounwind {
+entry:
+  call void @leaf61()
+  ret void
+}
+
+define void @live62() nounwind {
+entry:
+  call void @leaf62()
+  ret void
+}
+
+define void @leaf62() nounwind {
+entry:
+  ret void
+}
+
+define void @dead62() nounwind {
+entry:
+  call void @leaf62()
+  ret void
+}
+
+define void @live63() nounwind {
+entry:
+  call void @leaf63()
+  ret void
+}
+
+define void @leaf63() nounwind {
+entry:
+  ret void
+}
+
+define void @dead63() nounwind {
+entry:
+  call void @leaf63()
+  ret void
+}
+
+define void @live64() nounwind {
+entry:
+  call void @leaf64()
+  ret void
+}
+
+define void @leaf64() nounwind {
+entry:
+  ret void
+}
+
+define void @dead64() nounwind {
+entry:
+  call void @leaf64()
+  ret void
+}
+
+define void @live65() nounwind {
+entry:
+  call void @leaf65()
+  ret void
+}
+
+define void @leaf65() nounwind {
+entry:
+  ret void
+}
+
+define void @dead65() nounwind {
+entry:
+  call void @leaf65()
+  ret void
+}
+
+define void @live66() nounwind {
+entry:
+  call void @leaf66()
+  ret void
+}
+
+define void @leaf66() nounwind {
+entry:
+  ret void
+}
+
+define void @dead66() nounwind {
+entry:
+  call void @leaf66()
+  ret void
+}
+
+define void @live67() nounwind {
+entry:
+  call void @leaf67()
+  ret void
+}
+
+define void @leaf67() nounwind {
+entry:
+  ret void
+}
+
+define void @dead67() nounwind {
+entry:
+  call void @leaf67()
+  ret void
+}
+
+define void @live68() nounwind {
+entry:
+  call void @leaf68()
+  ret void
+}
+
+define void @leaf68() nounwind {
+entry:
+  ret void
+}
+
+define void @dead68() nounwind {
+entry:
+  call void @leaf68()
+  ret void
+}
+
+define void @live69() nounwind {
+entry:
+  call void @leaf69()
+  ret void
+}
+
+define void @leaf69() nounwind {
+entry:
+  ret void
+}
+
+define void @dead69() nounwind {
+entry:
+  call void @leaf69()
+  ret void
+}
+
+define void @live70() nounwind {
+entry:
+  call void @leaf70()
+  ret void
+}
+
+define void @leaf70() nounwind {
+entry:
+  ret void
+}
+
+define void @dead70() nounwind {
+entry:
+  call void @leaf70()
+  ret void
+}
+
+define void @live71() nounwind {
+entry:
+  call void @leaf71()
+  ret void
+}
+
+define void @leaf71() nounwind {
+entry:
+  ret void
+}
+
+define void @dead71() nounwind {
+entry:
+  call void @leaf71()
+  ret void
+}
+
+define void @live72() nounwind {
+entry:
+  call void @leaf72()
+  ret void
+}
+
+define void @leaf72() nounwind {
+entry:
+  ret void
+}
+
+define void @dead72() nounwind {
+entry:
+  call void @leaf72()
+  ret void
+}
+
+define void @live73() nounwind {
+entry:
+  call void @leaf73()
+  ret void
+}
+
+define void @leaf73() nounwind {
+entry:
+  ret void
+}
+
+define void @dead73() nounwind {
+entry:
+  call void @leaf73()
+  ret void
+}
+
+define void @live74() nounwind {
+entry:
+  call void @leaf74()
+  ret void
+}
+
+define void @leaf74() nounwind {
+entry:
+  ret void
+}
+
+define void @dead74() nounwind {
+entry:
+  call void @leaf74()
+  ret void
+}
+
+define void @live75() nounwind {
+entry:
+  call void @leaf75()
+  ret void
+}
+
+define void @leaf75() nounwind {
+entry:
+  ret void
+}
+
+define void @dead75() nounwind {
+entry:
+  call void @leaf75()
+  ret void
+}
+
+define void @live76() nounwind {
+entry:
+  call void @leaf76()
+  ret void
+}
+
+define void @leaf76() nounwind {
+entry:
+  ret void
+}
+
+define void @dead76() nounwind {
+entry:
+  call void @leaf76()
+  ret void
+}
+
+define void @live77() nounwind {
+entry:
+  call void @leaf77()
+  ret void
+}
+
+define void @leaf77() nounwind {
+entry:
+  ret void
+}
+
+define void @dead77() nounwind {
+entry:
+  call void @leaf77()
+  ret void
+}
+
+define void @live78() nounwind {
+entry:
+  call void @leaf78()
+  ret void
+}
+
+define void @leaf78() nounwind {
+entry:
+  ret void
+}
+
+define void @dead78() nounwind {
+entry:
+  call void @leaf78()
+  ret void
+}
+
+define void @live79() nounwind {
+entry:
+  call void @leaf79()
+  ret void
+}
+
+define void @leaf79() nounwind {
+entry:
+  ret void
+}
+
+define void @dead79() nounwind {
+entry:
+  call void @leaf79()
+  ret void
+}
+
+define void @live80() nounwind {
+entry:
+  call void @leaf80()
+  ret void
+}
+
+define void @leaf80() nounwind {
+entry:
+  ret void
+}
+
+define void @dead80() nounwind {
+entry:
+  call void @leaf80()
+  ret void
+}
+
+define void @live81() nounwind {
+entry:
+  call void @leaf81()
+  ret void
+}
+
+define void @leaf81() nounwind {
+entry:
+  ret void
+}
+
+define void @dead81() nounwind {
+entry:
+  call void @leaf81()
+  ret void
+}
+
+define void @live82() nounwind {
+entry:
+  call void @leaf82()
+  ret void
+}
+
+define void @leaf82() nounwind {
+entry:
+  ret void
+}
+
+define void @dead82() nounwind {
+entry:
+  call void @leaf82()
+  ret void
+}
+
+define void @live83() nounwind {
+entry:
+  call void @leaf83()
+  ret void
+}
+
+define void @leaf83() nounwind {
+entry:
+  ret void
+}
+
+define void @dead83() nounwind {
+entry:
+  call void @leaf83()
+  ret void
+}
+
+define void @live84() nounwind {
+entry:
+  call void @leaf84()
+  ret void
+}
+
+define void @leaf84() nounwind {
+entry:
+  ret void
+}
+
+define void @dead84() nounwind {
+entry:
+  call void @leaf84()
+  ret void
+}
+
+define void @live85() nounwind {
+entry:
+  call void @leaf85()
+  ret void
+}
+
+define void @leaf85() nounwind {
+entry:
+  ret void
+}
+
+define void @dead85() nounwind {
+entry:
+  call void @leaf85()
+  ret void
+}
+
+define void @live86() nounwind {
+entry:
+  call void @leaf86()
+  ret void
+}
+
+define void @leaf86() nounwind {
+entry:
+  ret void
+}
+
+define void @dead86() nounwind {
+entry:
+  call void @leaf86()
+  ret void
+}
+
+define void @live87() nounwind {
+entry:
+  call void @leaf87()
+  ret void
+}
+
+define void @leaf87() nounwind {
+entry:
+  ret void
+}
+
+define void @dead87() nounwind {
+entry:
+  call void @leaf87()
+  ret void
+}
+
+define void @live88() nounwind {
+entry:
+  call void @leaf88()
+  ret void
+}
+
+define void @leaf88() nounwind {
+entry:
+  ret void
+}
+
+define void @dead88() nounwind {
+entry:
+  call void @leaf88()
+  ret void
+}
+
+define void @live89() nounwind {
+entry:
+  call void @leaf89()
+  ret void
+}
+
+define void @leaf89() nounwind {
+entry:
+  ret void
+}
+
+define void @dead89() nounwind {
+entry:
+  call void @leaf89()
+  ret void
+}
+
+define void @live90() nounwind {
+entry:
+  call void @leaf90()
+  ret void
+}
+
+define void @leaf90() nounwind {
+entry:
+  ret void
+}
+
+define void @dead90() nounwind {
+entry:
+  call void @leaf90()
+  ret void
+}
+
+define void @live91() nounwind {
+entry:
+  call void @leaf91()
+  ret void
+}
+
+define void @leaf91() nounwind {
+entry:
+  ret void
+}
+
+define void @dead91() nounwind {
+entry:
+  call void @leaf91()
+  ret void
+}
+
+define void @live92() nounwind {
+entry:
+  call void @leaf92()
+  ret void
+}
+
+define void @leaf92() nounwind {
+entry:
+  ret void
+}
+
+define void @dead92() nounwind {
+entry:
+  call void @leaf92()
+  ret void
+}
+
+define void @live93() nounwind {
+entry:
+  call void @leaf93()
+  ret void
+}
+
+define void @leaf93() nounwind {
+entry:
+  ret void
+}
+
+define void @dead93() nounwind {
+entry:
+  call void @leaf93()
+  ret void
+}
+
+define void @live94() nounwind {
+entry:
+  call void @leaf94()
+  ret void
+}
+
+define void @leaf94() nounwind {
+entry:
+  ret void
+}
+
+define void @dead94() nounwind {
+entry:
+  call void @leaf94()
+  ret void
+}
+
+define void @live95() nounwind {
+entry:
+  call void @leaf95()
+  ret void
+}
+
+define void @leaf95() nounwind {
+entry:
+  ret void
+}
+
+define void @dead95() nounwind {
+entry:
+  call void @leaf95()
+  ret void
+}
+
+define void @live96() nounwind {
+entry:
+  call void @leaf96()
+  ret void
+}
+
+define void @leaf96() nounwind {
+entry:
+  ret void
+}
+
+define void @dead96() nounwind {
+entry:
+  call void @leaf96()
+  ret void
+}
+
+define void @live97() nounwind {
+entry:
+  call void @leaf97()
+  ret void
+}
+
+define void @leaf97() nounwind {
+entry:
+  ret void
+}
+
+define void @dead97() nounwind {
+entry:
+  call void @leaf97()
+  ret void
+}
+
+define void @live98() nounwind {
+entry:
+  call void @leaf98()
+  ret void
+}
+
+define void @leaf98() nounwind {
+entry:
+  ret void
+}
+
+define void @dead98() nounwind {
+entry:
+  call void @leaf98()
+  ret void
+}
+
+define void @live99() nounwind {
+entry:
+  call void @leaf99()
+  ret void
+}
+
+define void @leaf99() nounwind {
+entry:
+  ret void
+}
+
+define void @dead99() nounwind {
+entry:
+  call void @leaf99()
+  ret void
+}
@@ -0,0 +1,77 @@
+; RUN: %LLC -mtriple="x86_64-pc-linux-gnu" -filetype=obj -function-sections \
+; RUN: %s -o %t.o
+
+; Every iteration folds one more level of the calls: first c2 into c1, which
+; makes b1 and b2 identical, and then a1 and a2.
+; RUN: %MCLinker -mtriple="x86_64-pc-linux-gnu" -e main --icf=all \
+; RUN: --icf-iterations 1 %t.o -o %t.1.out
+; RUN: nm %t.1.out | FileCheck %s -check-prefix=ONE
+; ONE: [[A1:[0-9a-f]+]] T a1
+; ONE-NOT: [[A1]] T a2
+; ONE: [[B1:[0-9a-f]+]] T b1
+; ONE-NOT: [[B1]] T b2
+; ONE: [[C1:[0-9a-f]+]] T c1
+; ONE-NEXT: [[C1]] T c2
+
+; RUN: %MCLinker -mtriple="x86_64-pc-linux-gnu" -e main --icf=all \
+; RUN: --icf-iterations 2 %t.o -o %t.2.out
+; RUN: nm %t.2.out | FileCheck %s -check-prefix=TWO
+; TWO: [[A1:[0-9a-f]+]] T a1
+; TWO-NOT: [[A1]] T a2
+; TWO: [[B1:[0-9a-f]+]] T b1
+; TWO-NEXT: [[B1]] T b2
+; TWO: [[C1:[0-9a-f]+]] T c1
+; TWO-NEXT: [[C1]] T c2
+
+; RUN: %MCLinker -mtriple="x86_64-pc-linux-gnu" -e main --icf=all \
+; RUN: %t.o -o %t.out
+; RUN: nm %t.out | FileCheck %s -check-prefix=ALL
+; ALL: [[A1:[0-9a-f]+]] T a1
+; ALL-NEXT: [[A1]] T a2
+; ALL: [[B1:[0-9a-f]+]] T b1
+; ALL-NEXT: [[B1]] T b2
+; ALL: [[C1:[0-9a-f]+]] T c1
+; ALL-NEXT: [[C1]] T c2
+
+target triple = "x86_64-pc-linux-gnu"
+
+define i32 @main() nounwind {
+entry:
+  call void @a1()
+  call void @a2()
+  ret i32 0
+}
+
+define void @a1() nounwind {
+entry:
+  call void @b1()
+  ret void
+}
+
+define void @a2() nounwind {
+entry:
+  call void @b2()
+  ret void
+}
+
+define void @b1() nounwind {
+entry:
+  call i32 @c1()
+  ret void
+}
+
+define void @b2() nounwind {
+entry:
+  call i32 @c2()
+  ret void
+}
+
+define i32 @c1() nounwind {
+entry:
+  ret i32 42
+}
+
+define i32 @c2() nounwind {
+entry:
+  ret i32 42
+}
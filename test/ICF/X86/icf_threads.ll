@@ -0,0 +1,1561 @@
+; RUN: %LLC -mtriple="x86_64-pc-linux-gnu" -filetype=obj -function-sections \
+; RUN: %s -o %t.o
+; RUN: %MCLinker -mtriple="x86_64-pc-linux-gnu" -e main --icf=all \
+; RUN: --print-icf-sections --threads=1 %t.o -o %t.1.out 2> %t.1.log
+; RUN: %MCLinker -mtriple="x86_64-pc-linux-gnu" -e main --icf=all \
+; RUN: --print-icf-sections --threads=4 %t.o -o %t.4.out 2> %t.4.log
+
+; The candidates are hashed and grouped on many threads, but every thread
+; count folds the same sections into the same ones.
+; RUN: diff %t.1.log %t.4.log
+; RUN: cmp %t.1.out %t.4.out
+
+; The callers of the identical functions are folded in the next iteration.
+; RUN: nm %t.4.out | FileCheck %s
+; CHECK: [[CALL:[0-9a-f]+]] T call3_0
+; CHECK-NEXT: [[CALL]] T call3_1
+; CHECK: [[RET:[0-9a-f]+]] T ret3_0
+; CHECK-NEXT: [[RET]] T ret3_1
+
+target triple = "x86_64-pc-linux-gnu"
+
+define i32 @main() nounwind {
+entry:
+  call void @call0_0()
+  call void @call0_1()
+  call void @call0_2()
+  call void @call0_3()
+  call void @call0_4()
+  call void @call0_5()
+  call void @call0_6()
+  call void @call0_7()
+  call void @call1_0()
+  call void @call1_1()
+  call void @call1_2()
+  call void @call1_3()
+  call void @call1_4()
+  call void @call1_5()
+  call void @call1_6()
+  call void @call1_7()
+  call void @call2_0()
+  call void @call2_1()
+  call void @call2_2()
+  call void @call2_3()
+  call void @call2_4()
+  call void @call2_5()
+  call void @call2_6()
+  call void @call2_7()
+  call void @call3_0()
+  call void @call3_1()
+  call void @call3_2()
+  call void @call3_3()
+  call void @call3_4()
+  call void @call3_5()
+  call void @call3_6()
+  call void @call3_7()
+  call void @call4_0()
+  call void @call4_1()
+  call void @call4_2()
+  call void @call4_3()
+  call void @call4_4()
+  call void @call4_5()
+  call void @call4_6()
+  call void @call4_7()
+  call void @call5_0()
+  call void @call5_1()
+  call void @call5_2()
+  call void @call5_3()
+  call void @call5_4()
+  call void @call5_5()
+  call void @call5_6()
+  call void @call5_7()
+  call void @call6_0()
+  call void @call6_1()
+  call void @call6_2()
+  call void @call6_3()
+  call void @call6_4()
+  call void @call6_5()
+  call void @call6_6()
+  call void @call6_7()
+  call void @call7_0()
+  call void @call7_1()
+  call void @call7_2()
+  call void @call7_3()
+  call void @call7_4()
+  call void @call7_5()
+  call void @call7_6()
+  call void @call7_7()
+  call void @call8_0()
+  call void @call8_1()
+  call void @call8_2()
+  call void @call8_3()
+  call void @call8_4()
+  call void @call8_5()
+  call void @call8_6()
+  call void @call8_7()
+  call void @call9_0()
+  call void @call9_1()
+  call void @call9_2()
+  call void @call9_3()
+  call void @call9_4()
+  call void @call9_5()
+  call void @call9_6()
+  call void @call9_7()
+  call void @call10_0()
+  call void @call10_1()
+  call void @call10_2()
+  call void @call10_3()
+  call void @call10_4()
+  call void @call10_5()
+  call void @call10_6()
+  call void @call10_7()
+  call void @call11_0()
+  call void @call11_1()
+  call void @call11_2()
+  call void @call11_3()
+  call void @call11_4()
+  call void @call11_5()
+  call void @call11_6()
+  call void @call11_7()
+  call void @call12_0()
+  call void @call12_1()
+  call void @call12_2()
+  call void @call12_3()
+  call void @call12_4()
+  call void @call12_5()
+  call void @call12_6()
+  call void @call12_7()
+  call void @call13_0()
+  call void @call13_1()
+  call void @call13_2()
+  call void @call13_3()
+  call void @call13_4()
+  call void @call13_5()
+  call void @call13_6()
+  call void @call13_7()
+  call void @call14_0()
+  call void @call14_1()
+  call void @call14_2()
+  call void @call14_3()
+  call void @call14_4()
+  call void @call14_5()
+  call void @call14_6()
+  call void @call14_7()
+  call void @call15_0()
+  call void @call15_1()
+  call void @call15_2()
+  call void @call15_3()
+  call void @call15_4()
+  call void @call15_5()
+  call void @call15_6()
+  call void @call15_7()
+  ret i32 0
+}
+
+define void @call0_0() nounwind {
+entry:
+  call i32 @ret0_0()
+  ret void
+}
+
+define i32 @ret0_0() nounwind {
+entry:
+  ret i32 0
+}
+
+define void @call0_1() nounwind {
+entry:
+  call i32 @ret0_1()
+  ret void
+}
+
+define i32 @ret0_1() nounwind {
+entry:
+  ret i32 0
+}
+
+define void @call0_2() nounwind {
+entry:
+  call i32 @ret0_2()
+  ret void
+}
+
+define i32 @ret0_2() nounwind {
+entry:
+  ret i32 0
+}
+
+define void @call0_3() nounwind {
+entry:
+  call i32 @ret0_3()
+  ret void
+}
+
+define i32 @ret0_3() nounwind {
+entry:
+  ret i32 0
+}
+
+define void @call0_4() nounwind {
+entry:
+  call i32 @ret0_4()
+  ret void
+}
+
+define i32 @ret0_4() nounwind {
+entry:
+  ret i32 0
+}
+
+define void @call0_5() nounwind {
+entry:
+  call i32 @ret0_5()
+  ret void
+}
+
+define i32 @ret0_5() nounwind {
+entry:
+  ret i32 0
+}
+
+define void @call0_6() nounwind {
+entry:
+  call i32 @ret0_6()
+  ret void
+}
+
+define i32 @ret0_6() nounwind {
+entry:
+  ret i32 0
+}
+
+define void @call0_7() nounwind {
+entry:
+  call i32 @ret0_7()
+  ret void
+}
+
+define i32 @ret0_7() nounwind {
+entry:
+  ret i32 0
+}
+
+define void @call1_0() nounwind {
+entry:
+  call i32 @ret1_0()
+  ret void
+}
+
+define i32 @ret1_0() nounwind {
+entry:
+  ret i32 1
+}
+
+define void @call1_1() nounwind {
+entry:
+  call i32 @ret1_1()
+  ret void
+}
+
+define i32 @ret1_1() nounwind {
+entry:
+  ret i32 1
+}
+
+define void @call1_2() nounwind {
+entry:
+  call i32 @ret1_2()
+  ret void
+}
+
+define i32 @ret1_2() nounwind {
+entry:
+  ret i32 1
+}
+
+define void @call1_3() nounwind {
+entry:
+  call i32 @ret1_3()
+  ret void
+}
+
+define i32 @ret1_3() nounwind {
+entry:
+  ret i32 1
+}
+
+define void @call1_4() nounwind {
+entry:
+  call i32 @ret1_4()
+  ret void
+}
+
+define i32 @ret1_4() nounwind {
+entry:
+  ret i32 1
+}
+
+define void @call1_5() nounwind {
+entry:
+  call i32 @ret1_5()
+  ret void
+}
+
+define i32 @ret1_5() nounwind {
+entry:
+  ret i32 1
+}
+
+define void @call1_6() nounwind {
+entry:
+  call i32 @ret1_6()
+  ret void
+}
+
+define i32 @ret1_6() nounwind {
+entry:
+  ret i32 1
+}
+
+define void @call1_7() nounwind {
+entry:
+  call i32 @ret1_7()
+  ret void
+}
+
+define i32 @ret1_7() nounwind {
+entry:
+  ret i32 1
+}
+
+define void @call2_0() nounwind {
+entry:
+  call i32 @ret2_0()
+  ret void
+}
+
+define i32 @ret2_0() nounwind {
+entry:
+  ret i32 2
+}
+
+define void @call2_1() nounwind {
+entry:
+  call i32 @ret2_1()
+  ret void
+}
+
+define i32 @ret2_1() nounwind {
+entry:
+  ret i32 2
+}
+
+define void @call2_2() nounwind {
+entry:
+  call i32 @ret2_2()
+  ret void
+}
+
+define i32 @ret2_2() nounwind {
+entry:
+  ret i32 2
+}
+
+define void @call2_3() nounwind {
+entry:
+  call i32 @ret2_3()
+  ret void
+}
+
+define i32 @ret2_3() nounwind {
+entry:
+  ret i32 2
+}
+
+define void @call2_4() nounwind {
+entry:
+  call i32 @ret2_4()
+  ret void
+}
+
+define i32 @ret2_4() nounwind {
+entry:
+  ret i32 2
+}
+
+define void @call2_5() nounwind {
+entry:
+  call i32 @ret2_5()
+  ret void
+}
+
+define i32 @ret2_5() nounwind {
+entry:
+  ret i32 2
+}
+
+define void @call2_6() nounwind {
+entry:
+  call i32 @ret2_6()
+  ret void
+}
+
+define i32 @ret2_6() nounwind {
+entry:
+  ret i32 2
+}
+
+define void @call2_7() nounwind {
+entry:
+  call i32 @ret2_7()
+  ret void
+}
+
+define i32 @ret2_7() nounwind {
+entry:
+  ret i32 2
+}
+
+define void @call3_0() nounwind {
+entry:
+  call i32 @ret3_0()
+  ret void
+}
+
+define i32 @ret3_0() nounwind {
+entry:
+  ret i32 3
+}
+
+define void @call3_1() nounwind {
+entry:
+  call i32 @ret3_1()
+  ret void
+}
+
+define i32 @ret3_1() nounwind {
+entry:
+  ret i32 3
+}
+
+define void @call3_2() nounwind {
+entry:
+  call i32 @ret3_2()
+  ret void
+}
+
+define i32 @ret3_2() nounwind {
+entry:
+  ret i32 3
+}
+
+define void @call3_3() nounwind {
+entry:
+  call i32 @ret3_3()
+  ret void
+}
+
+define i32 @ret3_3() nounwind {
+entry:
+  ret i32 3
+}
+
+define void @call3_4() nounwind {
+entry:
+  call i32 @ret3_4()
+  ret void
+}
+
+define i32 @ret3_4() nounwind {
+entry:
+  ret i32 3
+}
+
+define void @call3_5() nounwind {
+entry:
+  call i32 @ret3_5()
+  ret void
+}
+
+define i32 @ret3_5() nounwind {
+entry:
+  ret i32 3
+}
+
+define void @call3_6() nounwind {
+entry:
+  call i32 @ret3_6()
+  ret void
+}
+
+define i32 @ret3_6() nounwind {
+entry:
+  ret i32 3
+}
+
+define void @call3_7() nounwind {
+entry:
+  call i32 @ret3_7()
+  ret void
+}
+
+define i32 @ret3_7() nounwind {
+entry:
+  ret i32 3
+}
+
+define void @call4_0() nounwind {
+entry:
+  call i32 @ret4_0()
+  ret void
+}
+
+define i32 @ret4_0() nounwind {
+entry:
+  ret i32 4
+}
+
+define void @call4_1() nounwind {
+entry:
+  call i32 @ret4_1()
+  ret void
+}
+
+define i32 @ret4_1() nounwind {
+entry:
+  ret i32 4
+}
+
+define void @call4_2() nounwind {
+entry:
+  call i32 @ret4_2()
+  ret void
+}
+
+define i32 @ret4_2() nounwind {
+entry:
+  ret i32 4
+}
+
+define void @call4_3() nounwind {
+entry:
+  call i32 @ret4_3()
+  ret void
+}
+
+define i32 @ret4_3() nounwind {
+entry:
+  ret i32 4
+}
+
+define void @call4_4() nounwind {
+entry:
+  call i32 @ret4_4()
+  ret void
+}
+
+define i32 @ret4_4() nounwind {
+entry:
+  ret i32 4
+}
+
+define void @call4_5() nounwind {
+entry:
+  call i32 @ret4_5()
+  ret void
+}
+
+define i32 @ret4_5() nounwind {
+entry:
+  ret i32 4
+}
+
+define void @call4_6() nounwind {
+entry:
+  call i32 @ret4_6()
+  ret void
+}
+
+define i32 @ret4_6() nounwind {
+entry:
+  ret i32 4
+}
+
+define void @call4_7() nounwind {
+entry:
+  call i32 @ret4_7()
+  ret void
+}
+
+define i32 @ret4_7() nounwind {
+entry:
+  ret i32 4
+}
+
+define void @call5_0() nounwind {
+entry:
+  call i32 @ret5_0()
+  ret void
+}
+
+define i32 @ret5_0() nounwind {
+entry:
+  ret i32 5
+}
+
+define void @call5_1() nounwind {
+entry:
+  call i32 @ret5_1()
+  ret void
+}
+
+define i32 @ret5_1() nounwind {
+entry:
+  ret i32 5
+}
+
+define void @call5_2() nounwind {
+entry:
+  call i32 @ret5_2()
+  ret void
+}
+
+define i32 @ret5_2() nounwind {
+entry:
+  ret i32 5
+}
+
+define void @call5_3() nounwind {
+entry:
+  call i32 @ret5_3()
+  ret void
+}
+
+define i32 @ret5_3() nounwind {
+entry:
+  ret i32 5
+}
+
+define void @call5_4() nounwind {
+entry:
+  call i32 @ret5_4()
+  ret void
+}
+
+define i32 @ret5_4() nounwind {
+entry:
+  ret i32 5
+}
+
+define void @call5_5() nounwind {
+entry:
+  call i32 @ret5_5()
+  ret void
+}
+
+define i32 @ret5_5() nounwind {
+entry:
+  ret i32 5
+}
+
+define void @call5_6() nounwind {
+entry:
+  call i32 @ret5_6()
+  ret void
+}
+
+define i32 @ret5_6() nounwind {
+entry:
+  ret i32 5
+}
+
+define void @call5_7() nounwind {
+entry:
+  call i32 @ret5_7()
+  ret void
+}
+
+define i32 @ret5_7() nounwind {
+entry:
+  ret i32 5
+}
+
+define void @call6_0() nounwind {
+entry:
+  call i32 @ret6_0()
+  ret void
+}
+
+define i32 @ret6_0() nounwind {
+entry:
+  ret i32 6
+}
+
+define void @call6_1() nounwind {
+entry:
+  call i32 @ret6_1()
+  ret void
+}
+
+define i32 @ret6_1() nounwind {
+entry:
+  ret i32 6
+}
+
+define void @call6_2() nounwind {
+entry:
+  call i32 @ret6_2()
+  ret void
+}
+
+define i32 @ret6_2() nounwind {
+entry:
+  ret i32 6
+}
+
+define void @call6_3() nounwind {
+entry:
+  call i32 @ret6_3()
+  ret void
+}
+
+define i32 @ret6_3() nounwind {
+entry:
+  ret i32 6
+}
+
+define void @call6_4() nounwind {
+entry:
+  call i32 @ret6_4()
+  ret void
+}
+
+define i32 @ret6_4() nounwind {
+entry:
+  ret i32 6
+}
+
+define void @call6_5() nounwind {
+entry:
+  call i32 @ret6_5()
+  ret void
+}
+
+define i32 @ret6_5() nounwind {
+entry:
+  ret i32 6
+}
+
+define void @call6_6() nounwind {
+entry:
+  call i32 @ret6_6()
+  ret void
+}
+
+define i32 @ret6_6() nounwind {
+entry:
+  ret i32 6
+}
+
+define void @call6_7() nounwind {
+entry:
+  call i32 @ret6_7()
+  ret void
+}
+
+define i32 @ret6_7() nounwind {
+entry:
+  ret i32 6
+}
+
+define void @call7_0() nounwind {
+entry:
+  call i32 @ret7_0()
+  ret void
+}
+
+define i32 @ret7_0() nounwind {
+entry:
+  ret i32 7
+}
+
+define void @call7_1() nounwind {
+entry:
+  call i32 @ret7_1()
+  ret void
+}
+
+define i32 @ret7_1() nounwind {
+entry:
+  ret i32 7
+}
+
+define void @call7_2() nounwind {
+entry:
+  call i32 @ret7_2()
+  ret void
+}
+
+define i32 @ret7_2() nounwind {
+entry:
+  ret i32 7
+}
+
+define void @call7_3() nounwind {
+entry:
+  call i32 @ret7_3()
+  ret void
+}
+
+define i32 @ret7_3() nounwind {
+entry:
+  ret i32 7
+}
+
+define void @call7_4() nounwind {
+entry:
+  call i32 @ret7_4()
+  ret void
+}
+
+define i32 @ret7_4() nounwind {
+entry:
+  ret i32 7
+}
+
+define void @call7_5() nounwind {
+entry:
+  call i32 @ret7_5()
+  ret void
+}
+
+define i32 @ret7_5() nounwind {
+entry:
+  ret i32 7
+}
+
+define void @call7_6() nounwind {
+entry:
+  call i32 @ret7_6()
+  ret void
+}
+
+define i32 @ret7_6() nounwind {
+entry:
+  ret i32 7
+}
+
+define void @call7_7() nounwind {
+entry:
+  call i32 @ret7_7()
+  ret void
+}
+
+define i32 @ret7_7() nounwind {
+entry:
+  ret i32 7
+}
+
+define void @call8_0() nounwind {
+entry:
+  call i32 @ret8_0()
+  ret void
+}
+
+define i32 @ret8_0() nounwind {
+entry:
+  ret i32 8
+}
+
+define void @call8_1() nounwind {
+entry:
+  call i32 @ret8_1()
+  ret void
+}
+
+define i32 @ret8_1() nounwind {
+entry:
+  ret i32 8
+}
+
+define void @call8_2() nounwind {
+entry:
+  call i32 @ret8_2()
+  ret void
+}
+
+define i32 @ret8_2() nounwind {
+entry:
+  ret i32 8
+}
+
+define void @call8_3() nounwind {
+entry:
+  call i32 @ret8_3()
+  ret void
+}
+
+define i32 @ret8_3() nounwind {
+entry:
+  ret i32 8
+}
+
+define void @call8_4() nounwind {
+entry:
+  call i32 @ret8_4()
+  ret void
+}
+
+define i32 @ret8_4() nounwind {
+entry:
+  ret i32 8
+}
+
+define void @call8_5() nounwind {
+entry:
+  call i32 @ret8_5()
+  ret void
+}
+
+define i32 @ret8_5() nounwind {
+entry:
+  ret i32 8
+}
+
+define void @call8_6() nounwind {
+entry:
+  call i32 @ret8_6()
+  ret void
+}
+
+define i32 @ret8_6() nounwind {
+entry:
+  ret i32 8
+}
+
+define void @call8_7() nounwind {
+entry:
+  call i32 @ret8_7()
+  ret void
+}
+
+define i32 @ret8_7() nounwind {
+entry:
+  ret i32 8
+}
+
+define void @call9_0() nounwind {
+entry:
+  call i32 @ret9_0()
+  ret void
+}
+
+define i32 @ret9_0() nounwind {
+entry:
+  ret i32 9
+}
+
+define void @call9_1() nounwind {
+entry:
+  call i32 @ret9_1()
+  ret void
+}
+
+define i32 @ret9_1() nounwind {
+entry:
+  ret i32 9
+}
+
+define void @call9_2() nounwind {
+entry:
+  call i32 @ret9_2()
+  ret void
+}
+
+define i32 @ret9_2() nounwind {
+entry:
+  ret i32 9
+}
+
+define void @call9_3() nounwind {
+entry:
+  call i32 @ret9_3()
+  ret void
+}
+
+define i32 @ret9_3() nounwind {
+entry:
+  ret i32 9
+}
+
+define void @call9_4() nounwind {
+entry:
+  call i32 @ret9_4()
+  ret void
+}
+
+define i32 @ret9_4() nounwind {
+entry:
+  ret i32 9
+}
+
+define void @call9_5() nounwind {
+entry:
+  call i32 @ret9_5()
+  ret void
+}
+
+define i32 @ret9_5() nounwind {
+entry:
+  ret i32 9
+}
+
+define void @call9_6() nounwind {
+entry:
+  call i32 @ret9_6()
+  ret void
+}
+
+define i32 @ret9_6() nounwind {
+entry:
+  ret i32 9
+}
+
+define void @call9_7() nounwind {
+entry:
+  call i32 @ret9_7()
+  ret void
+}
+
+define i32 @ret9_7() nounwind {
+entry:
+  ret i32 9
+}
+
+define void @call10_0() nounwind {
+entry:
+  call i32 @ret10_0()
+  ret void
+}
+
+define i32 @ret10_0() nounwind {
+entry:
+  ret i32 10
+}
+
+define void @call10_1() nounwind {
+entry:
+  call i32 @ret10_1()
+  ret void
+}
+
+define i32 @ret10_1() nounwind {
+entry:
+  ret i32 10
+}
+
+define void @call10_2() nounwind {
+entry:
+  call i32 @ret10_2()
+  ret void
+}
+
+define i32 @ret10_2() nounwind {
+entry:
+  ret i32 10
+}
+
+define void @call10_3() nounwind {
+entry:
+  call i32 @ret10_3()
+  ret void
+}
+
+define i32 @ret10_3() nounwind {
+entry:
+  ret i32 10
+}
+
+define void @call10_4() nounwind {
+entry:
+  call i32 @ret10_4()
+  ret void
+}
+
+define i32 @ret10_4() nounwind {
+entry:
+  ret i32 10
+}
+
+define void @call10_5() nounwind {
+entry:
+  call i32 @ret10_5()
+  ret void
+}
+
+define i32 @ret10_5() nounwind {
+entry:
+  ret i32 10
+}
+
+define void @call10_6() nounwind {
+entry:
+  call i32 @ret10_6()
+  ret void
+}
+
+define i32 @ret10_6() nounwind {
+entry:
+  ret i32 10
+}
+
+define void @call10_7() nounwind {
+entry:
+  call i32 @ret10_7()
+  ret void
+}
+
+define i32 @ret10_7() nounwind {
+entry:
+  ret i32 10
+}
+
+define void @call11_0() nounwind {
+entry:
+  call i32 @ret11_0()
+  ret void
+}
+
+define i32 @ret11_0() nounwind {
+entry:
+  ret i32 11
+}
+
+define void @call11_1() nounwind {
+entry:
+  call i32 @ret11_1()
+  ret void
+}
+
+define i32 @ret11_1() nounwind {
+entry:
+  ret i32 11
+}
+
+define void @call11_2() nounwind {
+entry:
+  call i32 @ret11_2()
+  ret void
+}
+
+define i32 @ret11_2() nounwind {
+entry:
+  ret i32 11
+}
+
+define void @call11_3() nounwind {
+entry:
+  call i32 @ret11_3()
+  ret void
+}
+
+define i32 @ret11_3() nounwind {
+entry:
+  ret i32 11
+}
+
+define void @call11_4() nounwind {
+entry:
+  call i32 @ret11_4()
+  ret void
+}
+
+define i32 @ret11_4() nounwind {
+entry:
+  ret i32 11
+}
+
+define void @call11_5() nounwind {
+entry:
+  call i32 @ret11_5()
+  ret void
+}
+
+define i32 @ret11_5() nounwind {
+entry:
+  ret i32 11
+}
+
+define void @call11_6() nounwind {
+entry:
+  call i32 @ret11_6()
+  ret void
+}
+
+define i32 @ret11_6() nounwind {
+entry:
+  ret i32 11
+}
+
+define void @call11_7() nounwind {
+entry:
+  call i32 @ret11_7()
+  ret void
+}
+
+define i32 @ret11_7() nounwind {
+entry:
+  ret i32 11
+}
+
+define void @call12_0() nounwind {
+entry:
+  call i32 @ret12_0()
+  ret void
+}
+
+define i32 @ret12_0() nounwind {
+entry:
+  ret i32 12
+}
+
+define void @call12_1() nounwind {
+entry:
+  call i32 @ret12_1()
+  ret void
+}
+
+define i32 @ret12_1() nounwind {
+entry:
+  ret i32 12
+}
+
+define void @call12_2() nounwind {
+entry:
+  call i32 @ret12_2()
+  ret void
+}
+
+define i32 @ret12_2() nounwind {
+entry:
+  ret i32 12
+}
+
+define void @call12_3() nounwind {
+entry:
+  call i32 @ret12_3()
+  ret void
+}
+
+define i32 @ret12_3() nounwind {
+entry:
+  ret i32 12
+}
+
+define void @call12_4() nounwind {
+entry:
+  call i32 @ret12_4()
+  ret void
+}
+
+define i32 @ret12_4() nounwind {
+entry:
+  ret i32 12
+}
+
+define void @call12_5() nounwind {
+entry:
+  call i32 @ret12_5()
+  ret void
+}
+
+define i32 @ret12_5() nounwind {
+entry:
+  ret i32 12
+}
+
+define void @call12_6() nounwind {
+entry:
+  call i32 @ret12_6()
+  ret void
+}
+
+define i32 @ret12_6() nounwind {
+entry:
+  ret i32 12
+}
+
+define void @call12_7() nounwind {
+entry:
+  call i32 @ret12_7()
+  ret void
+}
+
+define i32 @ret12_7() nounwind {
+entry:
+  ret i32 12
+}
+
+define void @call13_0() nounwind {
+entry:
+  call i32 @ret13_0()
+  ret void
+}
+
+define i32 @ret13_0() nounwind {
+entry:
+  ret i32 13
+}
+
+define void @call13_1() nounwind {
+entry:
+  call i32 @ret13_1()
+  ret void
+}
+
+define i32 @ret13_1() nounwind {
+entry:
+  ret i32 13
+}
+
+define void @call13_2() nounwind {
+entry:
+  call i32 @ret13_2()
+  ret void
+}
+
+define i32 @ret13_2() nounwind {
+entry:
+  ret i32 13
+}
+
+define void @call13_3() nounwind {
+entry:
+  call i32 @ret13_3()
+  ret void
+}
+
+define i32 @ret13_3() nounwind {
+entry:
+  ret i32 13
+}
+
+define void @call13_4() nounwind {
+entry:
+  call i32 @ret13_4()
+  ret void
+}
+
+define i32 @ret13_4() nounwind {
+entry:
+  ret i32 13
+}
+
+define void @call13_5() nounwind {
+entry:
+  call i32 @ret13_5()
+  ret void
+}
+
+define i32 @ret13_5() nounwind {
+entry:
+  ret i32 13
+}
+
+define void @call13_6() nounwind {
+entry:
+  call i32 @ret13_6()
+  ret void
+}
+
+define i32 @ret13_6() nounwind {
+entry:
+  ret i32 13
+}
+
+define void @call13_7() nounwind {
+entry:
+  call i32 @ret13_7()
+  ret void
+}
+
+define i32 @ret13_7() nounwind {
+entry:
+  ret i32 13
+}
+
+define void @call14_0() nounwind {
+entry:
+  call i32 @ret14_0()
+  ret void
+}
+
+define i32 @ret14_0() nounwind {
+entry:
+  ret i32 14
+}
+
+define void @call14_1() nounwind {
+entry:
+  call i32 @ret14_1()
+  ret void
+}
+
+define i32 @ret14_1() nounwind {
+entry:
+  ret i32 14
+}
+
+define void @call14_2() nounwind {
+entry:
+  call i32 @ret14_2()
+  ret void
+}
+
+define i32 @ret14_2() nounwind {
+entry:
+  ret i32 14
+}
+
+define void @call14_3() nounwind {
+entry:
+  call i32 @ret14_3()
+  ret void
+}
+
+define i32 @ret14_3() nounwind {
+entry:
+  ret i32 14
+}
+
+define void @call14_4() nounwind {
+entry:
+  call i32 @ret14_4()
+  ret void
+}
+
+define i32 @ret14_4() nounwind {
+entry:
+  ret i32 14
+}
+
+define void @call14_5() nounwind {
+entry:
+  call i32 @ret14_5()
+  ret void
+}
+
+define i32 @ret14_5() nounwind {
+entry:
+  ret i32 14
+}
+
+define void @call14_6() nounwind {
+entry:
+  call i32 @ret14_6()
+  ret void
+}
+
+define i32 @ret14_6() nounwind {
+entry:
+  ret i32 14
+}
+
+define void @call14_7() nounwind {
+entry:
+  call i32 @ret14_7()
+  ret void
+}
+
+define i32 @ret14_7() nounwind {
+entry:
+  ret i32 14
+}
+
+define void @call15_0() nounwind {
+entry:
+  call i32 @ret15_0()
+  ret void
+}
+
+define i32 @ret15_0() nounwind {
+entry:
+  ret i32 15
+}
+
+define void @call15_1() nounwind {
+entry:
+  call i32 @ret15_1()
+  ret void
+}
+
+define i32 @ret15_1() nounwind {
+entry:
+  ret i32 15
+}
+
+define void @call15_2() nounwind {
+entry:
+  call i32 @ret15_2()
+  ret void
+}
+
+define i32 @ret15_2() nounwind {
+entry:
+  ret i32 15
+}
+
+define void @call15_3() nounwind {
+entry:
+  call i32 @ret15_3()
+  ret void
+}
+
+define i32 @ret15_3() nounwind {
+entry:
+  ret i32 15
+}
+
+define void @call15_4() nounwind {
+entry:
+  call i32 @ret15_4()
+  ret void
+}
+
+define i32 @ret15_4() nounwind {
+entry:
+  ret i32 15
+}
+
+define void @call15_5() nounwind {
+entry:
+  call i32 @ret15_5()
+  ret void
+}
+
+define i32 @ret15_5() nounwind {
+entry:
+  ret i32 15
+}
+
+define void @call15_6() nounwind {
+entry:
+  call i32 @ret15_6()
+  ret void
+}
+
+define i32 @ret15_6() nounwind {
+entry:
+  ret i32 15
+}
+
+define void @call15_7() nounwind {
+entry:
+  call i32 @ret15_7()
+  ret void
+}
+
+define i32 @ret15_7() nounwind {
+entry:
+  ret i32 15
+}
@@ -0,0 +1,53 @@
+; RUN: sed -e 's/PREFIX/a/g' %s > %t.a.ll
+; RUN: sed -e 's/PREFIX/b/g' %s > %t.b.ll
+; RUN: sed -e 's/PREFIX/c/g' %s > %t.c.ll
+; RUN: %LLC -mtriple="x86_64-pc-linux-gnu" -filetype=obj \
+; RUN: -relocation-model=pic %t.a.ll -o %t.a.o
+; RUN: %LLC -mtriple="x86_64-pc-linux-gnu" -filetype=obj \
+; RUN: -relocation-model=pic %t.b.ll -o %t.b.o
+; RUN: %LLC -mtriple="x86_64-pc-linux-gnu" -filetype=obj \
+; RUN: -relocation-model=pic %t.c.ll -o %t.c.o
+
+; The relocations that reserve no GOT, PLT or dynamic relocation entry are
+; applied on the workers, one input at a time, and the others in the serial
+; pass. The output is the same on any number of threads.
+; RUN: %MCLinker -mtriple="x86_64-pc-linux-gnu" -shared --threads=1 \
+; RUN: %t.a.o %t.b.o %t.c.o -o %t.1.so
+; RUN: %MCLinker -mtriple="x86_64-pc-linux-gnu" -shared --threads=4 \
+; RUN: %t.a.o %t.b.o %t.c.o -o %t.4.so
+; RUN: cmp %t.1.so %t.4.so
+
+; RUN: readelf -rW %t.4.so | FileCheck %s
+; CHECK-DAG: R_X86_64_GLOB_DAT {{.*}} ext_var
+; CHECK-DAG: R_X86_64_JUMP_SLOT {{.*}} ext_func
+
+target triple = "x86_64-pc-linux-gnu"
+
+@PREFIX_local = internal global [16 x i32] zeroinitializer, align 4
+@PREFIX_global = global i32 0, align 4
+@PREFIX_ptr = global i32* @PREFIX_global, align 8
+@ext_var = external global i32
+
+declare i32 @ext_func(i32)
+
+define internal i32 @PREFIX_helper(i32 %x) nounwind noinline {
+entry:
+  %idx = and i32 %x, 15
+  %idx.ext = zext i32 %idx to i64
+  %p = getelementptr inbounds [16 x i32], [16 x i32]* @PREFIX_local, i64 0, i64 %idx.ext
+  %v = load i32, i32* %p, align 4
+  %sum = add i32 %v, %x
+  store i32 %sum, i32* %p, align 4
+  ret i32 %sum
+}
+
+define i32 @PREFIX_func(i32 %x) nounwind {
+entry:
+  %a = call i32 @PREFIX_helper(i32 %x)
+  %b = call i32 @ext_func(i32 %a)
+  %g = load i32, i32* @PREFIX_global, align 4
+  %e = load i32, i32* @ext_var, align 4
+  %s1 = add i32 %b, %g
+  %s2 = add i32 %s1, %e
+  ret i32 %s2
+}
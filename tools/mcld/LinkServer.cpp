@@ -0,0 +1,457 @@
+//===- LinkServer.cpp -----------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "LinkServer.h"
+
+#include <mcld/Config/Config.h>
+#include <mcld/LD/InputCache.h>
+#include <mcld/Support/raw_ostream.h>
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#if defined(MCLD_ON_UNIX)
+#include <errno.h>
+#include <signal.h>
+#include <stdint.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/prctl.h>
+#endif
+
+namespace mcld {
+
+#if defined(MCLD_ON_UNIX)
+
+namespace {
+
+/// The header of a request. It is sent with the standard streams of the
+/// client, and followed by `size' bytes of the working directory and the
+/// arguments, each terminated by '\0'. The reply is the int32_t exit status.
+struct RequestHeader {
+  uint32_t magic;
+  uint32_t umask;
+  uint32_t size;
+};
+
+const uint32_t kRequestMagic = 0x4d434c44;  // "MCLD"
+
+const int kNumStreams = 3;
+
+/// The largest working directory and arguments a request may carry.
+const uint32_t kMaxRequestSize = 16 * 1024 * 1024;
+
+/// The exit status of a worker that cannot serve anymore.
+const int kWorkerFailure = 125;
+
+#if defined(MSG_NOSIGNAL)
+const int kSendFlags = MSG_NOSIGNAL;
+#else
+const int kSendFlags = 0;
+#endif
+
+/// the signals that shut the server down
+const int kTerminateSignals[] = {SIGHUP, SIGINT, SIGTERM};
+
+/// g_Terminate - whether the server has been asked to shut down
+volatile sig_atomic_t g_Terminate = 0;
+
+/// g_Worker - the running worker, 0 if none
+volatile pid_t g_Worker = 0;
+
+/// handleTerminate - forward the request to shut down to the worker
+void handleTerminate(int pSignal) {
+  g_Terminate = 1;
+  if (g_Worker > 0)
+    ::kill(g_Worker, SIGTERM);
+}
+
+/// setTerminateHandler - handle the signals that shut the server down by
+/// pHandler. The handler does not restart waitpid().
+void setTerminateHandler(void (*pHandler)(int)) {
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = pHandler;
+  sigemptyset(&action.sa_mask);
+  for (int sig : kTerminateSignals)
+    ::sigaction(sig, &action, NULL);
+}
+
+bool readAll(int pFD, void* pBuf, size_t pSize) {
+  char* buf = static_cast<char*>(pBuf);
+  while (pSize > 0) {
+    ssize_t size = ::read(pFD, buf, pSize);
+    if (size < 0 && errno == EINTR)
+      continue;
+    if (size <= 0)
+      return false;
+    buf += size;
+    pSize -= size;
+  }
+  return true;
+}
+
+bool sendAll(int pFD, const void* pBuf, size_t pSize) {
+  const char* buf = static_cast<const char*>(pBuf);
+  while (pSize > 0) {
+    ssize_t size = ::send(pFD, buf, pSize, kSendFlags);
+    if (size < 0 && errno == EINTR)
+      continue;
+    if (size <= 0)
+      return false;
+    buf += size;
+    pSize -= size;
+  }
+  return true;
+}
+
+bool makeAddress(const std::string& pPath, sockaddr_un& pAddr) {
+  memset(&pAddr, 0, sizeof(pAddr));
+  pAddr.sun_family = AF_UNIX;
+  if (pPath.size() >= sizeof(pAddr.sun_path)) {
+    mcld::errs() << "Socket path is too long: " << pPath << "\n";
+    return false;
+  }
+  memcpy(pAddr.sun_path, pPath.c_str(), pPath.size() + 1);
+  return true;
+}
+
+/// isSameUser - whether the client on pConn runs as our effective user
+bool isSameUser(int pConn) {
+#if defined(SO_PEERCRED)
+  struct ucred cred;
+  socklen_t size = sizeof(cred);
+  if (::getsockopt(pConn, SOL_SOCKET, SO_PEERCRED, &cred, &size) != 0)
+    return false;
+  return cred.uid == ::geteuid();
+#else
+  uid_t uid;
+  gid_t gid;
+  if (::getpeereid(pConn, &uid, &gid) != 0)
+    return false;
+  return uid == ::geteuid();
+#endif
+}
+
+/// receiveHeader - receive the header of a request and the standard streams
+/// of the client
+bool receiveHeader(int pConn, RequestHeader& pHeader, int pStreams[]) {
+  char control[CMSG_SPACE(sizeof(int) * kNumStreams)];
+  iovec iov;
+  iov.iov_base = &pHeader;
+  iov.iov_len = sizeof(pHeader);
+
+  msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+
+  ssize_t size;
+  do {
+    size = ::recvmsg(pConn, &msg, 0);
+  } while (size < 0 && errno == EINTR);
+
+  // take the received descriptors, and close the ones beyond the standard
+  // streams
+  int num_streams = 0;
+  bool extra = false;
+  cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  if (size > 0 && cmsg != NULL && cmsg->cmsg_level == SOL_SOCKET &&
+      cmsg->cmsg_type == SCM_RIGHTS && cmsg->cmsg_len >= CMSG_LEN(0)) {
+    size_t received = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+    const unsigned char* data = CMSG_DATA(cmsg);
+    for (size_t i = 0; i < received; ++i) {
+      int fd;
+      memcpy(&fd, data + i * sizeof(int), sizeof(int));
+      if (num_streams < kNumStreams) {
+        pStreams[num_streams++] = fd;
+      } else {
+        ::close(fd);
+        extra = true;
+      }
+    }
+  }
+
+  // a truncated message may have lost its descriptors
+  if (static_cast<size_t>(size) == sizeof(pHeader) &&
+      (msg.msg_flags & MSG_CTRUNC) == 0 && !extra &&
+      num_streams == kNumStreams && pHeader.magic == kRequestMagic &&
+      pHeader.size <= kMaxRequestSize)
+    return true;
+
+  for (int i = 0; i < num_streams; ++i)
+    ::close(pStreams[i]);
+  return false;
+}
+
+/// serveRequest - run the link requested on the connection pConn
+void serveRequest(int pConn, LinkFunc pLink) {
+  RequestHeader header;
+  int streams[kNumStreams];
+  if (!receiveHeader(pConn, header, streams))
+    return;
+
+  // receiveHeader() has bounded the size
+  std::vector<char> payload(header.size);
+  if (!readAll(pConn, payload.data(), payload.size()) || payload.empty() ||
+      payload.back() != '\0') {
+    for (int i = 0; i < kNumStreams; ++i)
+      ::close(streams[i]);
+    return;
+  }
+
+  // the working directory and then the arguments
+  const char* cwd = payload.data();
+  std::vector<const char*> argv;
+  for (size_t pos = strlen(cwd) + 1; pos < payload.size();
+       pos += strlen(&payload[pos]) + 1)
+    argv.push_back(&payload[pos]);
+
+  // take over the standard streams of the client
+  int saved[kNumStreams];
+  for (int i = 0; i < kNumStreams; ++i) {
+    saved[i] = ::dup(i);
+    ::dup2(streams[i], i);
+    ::close(streams[i]);
+  }
+  mode_t mask = ::umask(header.umask);
+
+  int status = EXIT_FAILURE;
+  if (argv.empty())
+    mcld::errs() << "Empty link request\n";
+  else if (::chdir(cwd) != 0)
+    mcld::errs() << "Cannot enter the directory " << cwd << "\n";
+  else
+    status = pLink(argv);
+
+  mcld::outs().flush();
+  mcld::errs().flush();
+  fflush(stdout);
+  fflush(stderr);
+
+  ::umask(mask);
+  for (int i = 0; i < kNumStreams; ++i) {
+    ::dup2(saved[i], i);
+    ::close(saved[i]);
+  }
+
+  int32_t reply = status;
+  sendAll(pConn, &reply, sizeof(reply));
+}
+
+/// serve - the worker: serve the requests one after another
+int serve(int pListener, LinkFunc pLink) {
+  InputCache::Enable();
+  while (true) {
+    int conn = ::accept(pListener, NULL, NULL);
+    if (conn < 0) {
+      if (errno == EINTR || errno == ECONNABORTED)
+        continue;
+      return kWorkerFailure;
+    }
+    // a link runs with our permissions, so it is only served to our user
+    if (isSameUser(conn))
+      serveRequest(conn, pLink);
+    ::close(conn);
+  }
+}
+
+}  // anonymous namespace
+
+int RunLinkServer(const std::string& pPath, LinkFunc pLink) {
+  sockaddr_un addr;
+  if (!makeAddress(pPath, addr))
+    return EXIT_FAILURE;
+
+  int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listener < 0) {
+    mcld::errs() << "Cannot create socket: " << strerror(errno) << "\n";
+    return EXIT_FAILURE;
+  }
+
+  // remove the socket left by a previous server, but nothing else
+  struct stat st;
+  if (::lstat(pPath.c_str(), &st) == 0) {
+    if (!S_ISSOCK(st.st_mode)) {
+      mcld::errs() << "Cannot listen on " << pPath << ": not a socket\n";
+      ::close(listener);
+      return EXIT_FAILURE;
+    }
+    ::unlink(pPath.c_str());
+  }
+
+  // only our user may connect to the socket (mode 0600)
+  mode_t mask = ::umask(S_IXUSR | S_IRWXG | S_IRWXO);
+  int result =
+      ::bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+  ::umask(mask);
+  if (result != 0 || ::listen(listener, SOMAXCONN) != 0) {
+    mcld::errs() << "Cannot listen on " << pPath << ": " << strerror(errno)
+                 << "\n";
+    ::close(listener);
+    return EXIT_FAILURE;
+  }
+
+  // a client may go away before it gets the reply
+  ::signal(SIGPIPE, SIG_IGN);
+  setTerminateHandler(handleTerminate);
+
+  pid_t server = ::getpid();
+  while (g_Terminate == 0) {
+    pid_t worker = ::fork();
+    if (worker < 0) {
+      mcld::errs() << "Cannot start worker: " << strerror(errno) << "\n";
+      break;
+    }
+    if (worker == 0) {
+      setTerminateHandler(SIG_DFL);
+#if defined(__linux__)
+      // the worker goes away with the server, even if it is killed
+      ::prctl(PR_SET_PDEATHSIG, SIGTERM);
+      if (::getppid() != server)
+        ::_exit(kWorkerFailure);
+#endif
+      ::_exit(serve(listener, pLink));
+    }
+
+    // a request to shut down may come before the worker is known
+    g_Worker = worker;
+    if (g_Terminate != 0)
+      ::kill(worker, SIGTERM);
+
+    int status = 0;
+    while (::waitpid(worker, &status, 0) < 0 && errno == EINTR) {
+    }
+    g_Worker = 0;
+    if (g_Terminate != 0)
+      break;
+
+    // The worker exits only if a link terminates it. Start a new one unless
+    // it cannot accept the requests anymore.
+    if (WIFEXITED(status) && WEXITSTATUS(status) == kWorkerFailure) {
+      mcld::errs() << "Cannot accept requests on " << pPath << "\n";
+      break;
+    }
+  }
+
+  ::close(listener);
+  ::unlink(pPath.c_str());
+  return (g_Terminate != 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+bool ConnectLinkServer(const std::string& pPath,
+                       llvm::ArrayRef<const char*> pArgv,
+                       int& pStatus) {
+  sockaddr_un addr;
+  if (!makeAddress(pPath, addr))
+    return false;
+
+  llvm::SmallString<256> cwd;
+  if (llvm::sys::fs::current_path(cwd))
+    return false;
+
+  std::string payload(cwd.begin(), cwd.end());
+  payload.push_back('\0');
+  for (const char* arg : pArgv) {
+    payload.append(arg);
+    payload.push_back('\0');
+  }
+  // the server refuses it, link here
+  if (payload.size() > kMaxRequestSize)
+    return false;
+
+  int sock = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (sock < 0)
+    return false;
+  if (::connect(sock, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+    ::close(sock);
+    return false;
+  }
+
+  RequestHeader header;
+  header.magic = kRequestMagic;
+  header.umask = ::umask(0);
+  ::umask(header.umask);
+  header.size = payload.size();
+
+  // send the header with the standard streams
+  int streams[kNumStreams] = {STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO};
+  char control[CMSG_SPACE(sizeof(streams))];
+  memset(control, 0, sizeof(control));
+  iovec iov;
+  iov.iov_base = &header;
+  iov.iov_len = sizeof(header);
+
+  msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+
+  cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(streams));
+  memcpy(CMSG_DATA(cmsg), streams, sizeof(streams));
+
+  ssize_t size;
+  do {
+    size = ::sendmsg(sock, &msg, kSendFlags);
+  } while (size < 0 && errno == EINTR);
+
+  // Nothing has been linked if the request cannot be sent, so the caller
+  // can still link by itself.
+  if (size != static_cast<ssize_t>(sizeof(header)) ||
+      !sendAll(sock, payload.data(), payload.size())) {
+    ::close(sock);
+    return false;
+  }
+
+  // The connection is closed without a reply if the link terminated the
+  // worker, e.g., by a fatal error, which has been reported to our stderr.
+  int32_t reply = 0;
+  if (readAll(sock, &reply, sizeof(reply)))
+    pStatus = reply;
+  else
+    pStatus = EXIT_FAILURE;
+
+  ::close(sock);
+  return true;
+}
+
+#else  // !MCLD_ON_UNIX
+
+int RunLinkServer(const std::string& pPath, LinkFunc pLink) {
+  mcld::errs() << "--server is not supported on this host\n";
+  return EXIT_FAILURE;
+}
+
+bool ConnectLinkServer(const std::string& pPath,
+                       llvm::ArrayRef<const char*> pArgv,
+                       int& pStatus) {
+  return false;
+}
+
+#endif  // MCLD_ON_UNIX
+
+}  // namespace mcld
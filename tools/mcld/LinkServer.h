@@ -0,0 +1,48 @@
+//===- LinkServer.h -------------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MCLD_TOOLS_MCLD_LINKSERVER_H_
+#define MCLD_TOOLS_MCLD_LINKSERVER_H_
+
+#include <llvm/ADT/ArrayRef.h>
+
+#include <string>
+
+namespace mcld {
+
+/// LinkFunc - link with the command line pArgv and return the exit status.
+typedef int (*LinkFunc)(llvm::ArrayRef<const char*> pArgv);
+
+/// RunLinkServer - serve the link requests on the Unix socket pPath until the
+/// process gets SIGHUP, SIGINT or SIGTERM, which is forwarded to the worker.
+///
+/// The links run one after another in a worker process, which keeps the
+/// input files and their parsed symbol tables in the InputCache. A link runs
+/// in the working directory, with the umask and the standard streams of its
+/// client. If a link terminates the worker, e.g., by a fatal error, the
+/// server starts a new one with an empty cache.
+///
+/// The socket is only accessible to our user (mode 0600), and the requests
+/// of other users are dropped. An existing pPath is replaced only if it is a
+/// socket.
+///
+/// @return the exit status of the server.
+int RunLinkServer(const std::string& pPath, LinkFunc pLink);
+
+/// ConnectLinkServer - forward the link with the command line pArgv to the
+/// server on the Unix socket pPath.
+///
+/// @return false if the server is not reachable. Otherwise, pStatus is the
+/// exit status of the link.
+bool ConnectLinkServer(const std::string& pPath,
+                       llvm::ArrayRef<const char*> pArgv,
+                       int& pStatus);
+
+}  // namespace mcld
+
+#endif  // MCLD_TOOLS_MCLD_LINKSERVER_H_
@@ -6,6 +6,8 @@
 // License. See LICENSE.TXT for details.
 //
 //===----------------------------------------------------------------------===//
+#include "LinkServer.h"
+
 #include <mcld/Environment.h>
 #include <mcld/IRBuilder.h>
 #include <mcld/Linker.h>
@@ -24,21 +26,28 @@
 #include <mcld/Support/TargetRegistry.h>
 
 #include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallString.h>
 #include <llvm/ADT/SmallVector.h>
 #include <llvm/ADT/STLExtras.h>
+#include <llvm/ADT/StringExtras.h>
 #include <llvm/ADT/StringRef.h>
 #include <llvm/ADT/StringSwitch.h>
 #include <llvm/Option/Arg.h>
 #include <llvm/Option/ArgList.h>
 #include <llvm/Option/OptTable.h>
 #include <llvm/Option/Option.h>
+#include <llvm/Support/FileSystem.h>
 #include <llvm/Support/ManagedStatic.h>
 #include <llvm/Support/Process.h>
 #include <llvm/Support/Signals.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
 #include <string>
+#include <thread>
+#include <vector>
 
 #if defined(HAVE_UNISTD_H)
 #include <unistd.h>
@@ -98,6 +107,9 @@ class Driver {
 
   bool Run();
 
+  /// IsFastExit - whether the process may end without destroying the link
+  bool IsFastExit() const { return config_.options().isFastExit(); }
+
  private:
   bool TranslateArguments();
 
@@ -546,6 +558,46 @@ bool Driver::TranslateArguments() {
     }
   }
 
+  // --build-id[=style]
+  if (llvm::opt::Arg* arg = args_->getLastArg(kOpt_BuildID, kOpt_BuildIDEq)) {
+    if (arg->getOption().matches(kOpt_BuildID)) {
+      config_.options().setBuildIDStyle(
+          mcld::GeneralOptions::BuildIDStyle::Fast);
+    } else {
+      llvm::StringRef value = arg->getValue();
+      mcld::GeneralOptions::BuildIDStyle style =
+          llvm::StringSwitch<mcld::GeneralOptions::BuildIDStyle>(value)
+              .Case("fast", mcld::GeneralOptions::BuildIDStyle::Fast)
+              .Case("md5", mcld::GeneralOptions::BuildIDStyle::MD5)
+              .Case("sha1", mcld::GeneralOptions::BuildIDStyle::SHA1)
+              .Case("uuid", mcld::GeneralOptions::BuildIDStyle::UUID)
+              .Case("none", mcld::GeneralOptions::BuildIDStyle::None)
+              .Default(mcld::GeneralOptions::BuildIDStyle::Unknown);
+      if (value.startswith("0x") && value.size() > 2 &&
+          (value.size() % 2) == 0) {
+        std::string bytes;
+        for (size_t i = 2; i < value.size(); i += 2) {
+          unsigned hi = llvm::hexDigitValue(value[i]);
+          unsigned lo = llvm::hexDigitValue(value[i + 1]);
+          if (hi == -1U || lo == -1U)
+            break;
+          bytes.push_back(static_cast<char>((hi << 4) | lo));
+        }
+        if (bytes.size() == (value.size() - 2) / 2) {
+          style = mcld::GeneralOptions::BuildIDStyle::Hex;
+          config_.options().setBuildIDValue(bytes);
+        }
+      }
+      if (style == mcld::GeneralOptions::BuildIDStyle::Unknown) {
+        mcld::errs() << "Invalid value for"
+                     << arg->getOption().getPrefixedName() << ": "
+                     << arg->getValue() << "\n";
+        return false;
+      }
+      config_.options().setBuildIDStyle(style);
+    }
+  }
+
   // --[no]-export-dynamic
   if (llvm::opt::Arg* arg = args_->getLastArg(kOpt_ExportDynamic,
                                               kOpt_NoExportDynamic)) {
@@ -799,6 +851,82 @@ bool Driver::TranslateArguments() {
     }
   }
 
+  // --[no-]stream-relocations
+  if (llvm::opt::Arg* arg = args_->getLastArg(kOpt_StreamRelocations,
+                                              kOpt_NoStreamRelocations)) {
+    if (arg->getOption().matches(kOpt_StreamRelocations)) {
+      config_.options().setStreamRelocations(true);
+    } else {
+      config_.options().setStreamRelocations(false);
+    }
+  }
+
+  // --[no-]tail-merge-strings
+  if (llvm::opt::Arg* arg = args_->getLastArg(kOpt_TailMergeStrings,
+                                              kOpt_NoTailMergeStrings)) {
+    if (arg->getOption().matches(kOpt_TailMergeStrings)) {
+      config_.options().setTailMergeStrings(true);
+    } else {
+      config_.options().setTailMergeStrings(false);
+    }
+  }
+
+  // --threads=N
+  if (llvm::opt::Arg* arg = args_->getLastArg(kOpt_Threads)) {
+    llvm::StringRef value = arg->getValue();
+    int num;
+    if (value.getAsInteger(0, num) || (num < 0)) {
+      mcld::errs() << "Invalid value for" << arg->getOption().getPrefixedName()
+                   << ": " << arg->getValue() << "\n";
+      return false;
+    }
+    if (num == 0)
+      num = std::max(1u, std::thread::hardware_concurrency());
+    config_.options().setNumThreads(num);
+  }
+
+  // --stream-output-threshold=N
+  if (llvm::opt::Arg* arg = args_->getLastArg(kOpt_StreamOutputThreshold)) {
+    llvm::StringRef value = arg->getValue();
+    uint64_t size;
+    if (value.getAsInteger(0, size)) {
+      mcld::errs() << "Invalid value for" << arg->getOption().getPrefixedName()
+                   << ": " << arg->getValue() << "\n";
+      return false;
+    }
+    config_.options().setStreamOutputThreshold(size);
+  }
+
+  // --[no-]patch-identical-layout
+  if (llvm::opt::Arg* arg =
+          args_->getLastArg(kOpt_PatchIdenticalLayout,
+                            kOpt_NoPatchIdenticalLayout)) {
+    if (arg->getOption().matches(kOpt_PatchIdenticalLayout)) {
+      // The state of the previous link is reused only by the same command
+      // line in the same directory.
+      llvm::SmallString<256> key;
+      llvm::sys::fs::current_path(key);
+      for (unsigned i = 0; i < args_->getNumInputArgStrings(); ++i) {
+        key.push_back('\0');
+        key.append(args_->getArgString(i));
+      }
+      config_.options().setPatchIdenticalLayout(true);
+      config_.options().setPatchKey(std::string(key.begin(), key.end()));
+    } else {
+      config_.options().setPatchIdenticalLayout(false);
+    }
+  }
+
+  // --[no-]fast-exit
+  if (llvm::opt::Arg* arg = args_->getLastArg(kOpt_FastExit,
+                                              kOpt_NoFastExit)) {
+    if (arg->getOption().matches(kOpt_FastExit)) {
+      config_.options().setFastExit(true);
+    } else {
+      config_.options().setFastExit(false);
+    }
+  }
+
   //===--------------------------------------------------------------------===//
   // Positional
   //===--------------------------------------------------------------------===//
@@ -1050,11 +1178,9 @@ bool Driver::Run() {
   return true;
 }
 
-}  // anonymous namespace
-
-int main(int argc, char** argv) {
-  std::unique_ptr<Driver> driver =
-      Driver::Create(llvm::makeArrayRef(argv, argc));
+/// Link - link with the command line argv and return the exit status.
+int Link(llvm::ArrayRef<const char*> argv) {
+  std::unique_ptr<Driver> driver = Driver::Create(argv);
 
   if ((driver == nullptr) || !driver->Run()) {
     return EXIT_FAILURE;
@@ -1062,3 +1188,51 @@ int main(int argc, char** argv) {
     return EXIT_SUCCESS;
   }
 }
+
+/// LinkAndExit - link as the only link of the process and return the exit
+/// status. With --fast-exit, a successful link ends the process at once
+/// without destroying the driver, since the kernel takes back the memory of
+/// the link faster than the destructors free it.
+int LinkAndExit(llvm::ArrayRef<const char*> argv) {
+  std::unique_ptr<Driver> driver = Driver::Create(argv);
+
+  if ((driver == nullptr) || !driver->Run())
+    return EXIT_FAILURE;
+
+  if (driver->IsFastExit()) {
+    mcld::outs().flush();
+    mcld::errs().flush();
+    ::_exit(EXIT_SUCCESS);
+  }
+  return EXIT_SUCCESS;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char** argv) {
+  // --server and --connect decide where the link runs, so they are taken out
+  // before the command line is parsed.
+  static const char kServer[] = "--server=";
+  static const char kConnect[] = "--connect=";
+  std::string server, connect;
+  std::vector<const char*> args;
+  for (int i = 0; i < argc; ++i) {
+    llvm::StringRef arg(argv[i]);
+    if (i > 0 && arg.startswith(kServer))
+      server = arg.substr(strlen(kServer)).str();
+    else if (i > 0 && arg.startswith(kConnect))
+      connect = arg.substr(strlen(kConnect)).str();
+    else
+      args.push_back(argv[i]);
+  }
+
+  if (!server.empty())
+    return mcld::RunLinkServer(server, Link);
+
+  // Link by ourselves if the server is not reachable.
+  int status = EXIT_FAILURE;
+  if (!connect.empty() && mcld::ConnectLinkServer(connect, args, status))
+    return status;
+
+  return LinkAndExit(args);
+}
@@ -0,0 +1,127 @@
+//===- BranchIslandFactoryTest.cpp ----------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "mcld/LD/BranchIslandFactory.h"
+#include "mcld/Fragment/FillFragment.h"
+#include "mcld/LD/LDSection.h"
+#include "mcld/LD/SectionData.h"
+#include "BranchIslandFactoryTest.h"
+
+#include <vector>
+
+using namespace mcld;
+using namespace mcldtest;
+
+// Constructor can do set-up work for all test here.
+BranchIslandFactoryTest::BranchIslandFactoryTest() {
+}
+
+// Destructor can do clean-up work that doesn't throw exceptions here.
+BranchIslandFactoryTest::~BranchIslandFactoryTest() {
+}
+
+// SetUp() will be called immediately before each test.
+void BranchIslandFactoryTest::SetUp() {
+}
+
+// TearDown() will be called immediately after each test.
+void BranchIslandFactoryTest::TearDown() {
+}
+
+//==========================================================================//
+// Testcases
+//
+TEST_F(BranchIslandFactoryTest, find_nearest_islands) {
+  LDSection* text = LDSection::Create(".text", LDFileFormat::TEXT, 0, 0);
+  SectionData* data = SectionData::Create(*text);
+  std::vector<Fragment*> frags;
+  for (unsigned i = 0; i < 256; ++i) {
+    Fragment* frag = new FillFragment(0x0, 1, 0x100, data);
+    frag->setOffset(i * 0x100);
+    frags.push_back(frag);
+  }
+
+  // an island after every 16 fragments, i.e., at every 0x1000 bytes. A
+  // branch reaches 0x1f00 bytes forward and backward.
+  BranchIslandFactory factory(0x2000, -0x2000, 0x100);
+  for (unsigned i = 15; i < frags.size(); i += 16)
+    factory.produce(*frags[i]);
+  ASSERT_EQ(16U, factory.size());
+
+  std::vector<BranchIsland*> islands;
+  for (BranchIslandFactory::iterator it = factory.begin(), ie = factory.end();
+       it != ie;
+       ++it)
+    islands.push_back(&*it);
+
+  for (unsigned i = 0; i < frags.size(); ++i) {
+    std::pair<BranchIsland*, BranchIsland*> found =
+        factory.getIslands(*frags[i]);
+    // the fwd island is the next one, and the bwd island is the previous
+    // one, unless the fragment starts right at it
+    size_t next = i / 16;
+    ASSERT_EQ(islands[next], found.first);
+    if (next >= 1 && (i % 16) != 0)
+      ASSERT_EQ(islands[next - 1], found.second);
+    else
+      ASSERT_TRUE(found.second == NULL);
+  }
+
+  // a fragment after the last island has no island
+  Fragment* last = new FillFragment(0x0, 1, 0x100, data);
+  last->setOffset(0x10000);
+  ASSERT_TRUE(factory.getIslands(*last).first == NULL);
+
+  LDSection::Destroy(text);
+}
+
+TEST_F(BranchIslandFactoryTest, group_each_section) {
+  LDSection* hot = LDSection::Create(".text.hot", LDFileFormat::TEXT, 0, 0);
+  LDSection* cold =
+      LDSection::Create(".text.unlikely", LDFileFormat::TEXT, 0, 0);
+  SectionData* hot_data = SectionData::Create(*hot);
+  SectionData* cold_data = SectionData::Create(*cold);
+  std::vector<Fragment*> hot_frags, cold_frags;
+  for (unsigned i = 0; i < 64; ++i) {
+    hot_frags.push_back(new FillFragment(0x0, 1, 0x100, hot_data));
+    hot_frags.back()->setOffset(i * 0x100);
+  }
+  for (unsigned i = 0; i < 4; ++i) {
+    cold_frags.push_back(new FillFragment(0x0, 1, 0x100, cold_data));
+    cold_frags.back()->setOffset(i * 0x100);
+  }
+
+  // A branch reaches 0x1f00 bytes forward, so .text.hot of 0x4000 bytes
+  // needs islands at 0x1f00, 0x3e00 and its end, and .text.unlikely only
+  // needs one at its end.
+  BranchIslandFactory factory(0x2000, -0x2000, 0x100);
+  factory.group(*hot_data);
+  factory.group(*cold_data);
+  ASSERT_EQ(4U, factory.size());
+
+  std::pair<BranchIsland*, BranchIsland*> found =
+      factory.getIslands(*hot_frags[0]);
+  ASSERT_TRUE(found.first != NULL);
+  ASSERT_EQ(hot_data, found.first->getParent());
+  ASSERT_EQ(0x1f00U, found.first->offset());
+
+  found = factory.getIslands(*hot_frags[63]);
+  ASSERT_TRUE(found.first != NULL);
+  ASSERT_EQ(0x4000U, found.first->offset());
+  ASSERT_EQ(0x3e00U, found.second->offset());
+
+  // the islands of .text.hot are not used by .text.unlikely
+  found = factory.getIslands(*cold_frags[0]);
+  ASSERT_TRUE(found.first != NULL);
+  ASSERT_EQ(cold_data, found.first->getParent());
+  ASSERT_EQ(0x400U, found.first->offset());
+  ASSERT_TRUE(found.second == NULL);
+
+  LDSection::Destroy(hot);
+  LDSection::Destroy(cold);
+}
@@ -0,0 +1,38 @@
+//===- BranchIslandFactoryTest.h ------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MCLD_BRANCHISLANDFACTORY_TEST_H
+#define MCLD_BRANCHISLANDFACTORY_TEST_H
+
+#include <gtest.h>
+
+namespace mcldtest {
+
+/** \class BranchIslandFactoryTest
+ *  \brief The testcases of finding the branch islands of a fragment.
+ *
+ *  \see BranchIslandFactory
+ */
+class BranchIslandFactoryTest : public ::testing::Test {
+ public:
+  // Constructor can do set-up work for all test here.
+  BranchIslandFactoryTest();
+
+  // Destructor can do clean-up work that doesn't throw exceptions here.
+  virtual ~BranchIslandFactoryTest();
+
+  // SetUp() will be called immediately before each test.
+  virtual void SetUp();
+
+  // TearDown() will be called immediately after each test.
+  virtual void TearDown();
+};
+
+}  // namespace of mcldtest
+
+#endif
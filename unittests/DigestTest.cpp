@@ -0,0 +1,94 @@
+//===- DigestTest.cpp -----------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "mcld/Support/SHA1.h"
+#include "mcld/Support/XXHash.h"
+#include "DigestTest.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace mcld;
+using namespace mcldtest;
+
+namespace {
+
+std::string toHex(const uint8_t* pData, size_t pSize) {
+  static const char digits[] = "0123456789abcdef";
+  std::string result;
+  for (size_t i = 0; i < pSize; ++i) {
+    result += digits[pData[i] >> 4];
+    result += digits[pData[i] & 0xf];
+  }
+  return result;
+}
+
+std::string sha1(const char* pStr) {
+  uint8_t digest[SHA1::DigestSize];
+  SHA1 sha1;
+  sha1.update(reinterpret_cast<const uint8_t*>(pStr), ::strlen(pStr));
+  sha1.final(digest);
+  return toHex(digest, SHA1::DigestSize);
+}
+
+uint64_t xxHash64(const char* pStr) {
+  return mcld::xxHash64(reinterpret_cast<const uint8_t*>(pStr), ::strlen(pStr));
+}
+
+}  // anonymous namespace
+
+// Constructor can do set-up work for all test here.
+DigestTest::DigestTest() {
+}
+
+// Destructor can do clean-up work that doesn't throw exceptions here.
+DigestTest::~DigestTest() {
+}
+
+// SetUp() will be called immediately before each test.
+void DigestTest::SetUp() {
+}
+
+// TearDown() will be called immediately after each test.
+void DigestTest::TearDown() {
+}
+
+//==========================================================================//
+// Testcases
+//
+TEST_F(DigestTest, SHA1_known_vectors) {
+  ASSERT_EQ("da39a3ee5e6b4b0d3255bfef95601890afd80709", sha1(""));
+  ASSERT_EQ("a9993e364706816aba3e25717850c26c9cd0d89d", sha1("abc"));
+  ASSERT_EQ("2fd4e1c67a2d28fced849ee1bb76e7391b93eb12",
+            sha1("The quick brown fox jumps over the lazy dog"));
+}
+
+TEST_F(DigestTest, SHA1_split_update) {
+  std::vector<uint8_t> data(1000, 'a');
+  uint8_t whole[SHA1::DigestSize], split[SHA1::DigestSize];
+
+  SHA1 sha1_whole;
+  sha1_whole.update(data.data(), data.size());
+  sha1_whole.final(whole);
+
+  SHA1 sha1_split;
+  sha1_split.update(data.data(), 63);
+  sha1_split.update(data.data() + 63, 1);
+  sha1_split.update(data.data() + 64, data.size() - 64);
+  sha1_split.final(split);
+
+  ASSERT_EQ(toHex(whole, SHA1::DigestSize), toHex(split, SHA1::DigestSize));
+}
+
+TEST_F(DigestTest, xxHash64_known_vectors) {
+  ASSERT_EQ(0xef46db3751d8e999ULL, xxHash64(""));
+  ASSERT_EQ(0x44bc2cf5ad770999ULL, xxHash64("abc"));
+  ASSERT_EQ(0x0b242d361fda71bcULL,
+            xxHash64("The quick brown fox jumps over the lazy dog"));
+}
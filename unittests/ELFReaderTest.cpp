@@ -132,6 +132,29 @@ TEST_F(ELFReaderTest, read_symbol_and_rela) {
   ASSERT_EQ(llvm::ELF::SHT_RELA, (*rs)->type());
   ASSERT_TRUE(m_pELFReader->readRela(*m_pInput, **rs, region));
 
+  // the relocations are packed until they are materialized
+  RelocData* reloc_data = (*rs)->getRelocData();
+  ASSERT_TRUE(reloc_data->hasPacked());
+  ASSERT_EQ(2u, reloc_data->numOfPacked());
+  ASSERT_EQ(2u, reloc_data->size());
+  ASSERT_EQ("puts", std::string(reloc_data->getSymInfo(1)->name()));
+  ASSERT_EQ(llvm::ELF::R_X86_64_PC32, reloc_data->getType(1));
+  ASSERT_EQ(static_cast<mcld::Relocation::Address>(-0x4),
+            reloc_data->getAddend(1));
+
+  // a bound relocation stays packed, and is used through a scratch
+  reloc_data->bind();
+  ASSERT_TRUE(reloc_data->isBound());
+  Relocation* scratch = Relocation::Create();
+  reloc_data->load(1, *scratch);
+  ASSERT_EQ("puts", std::string(scratch->symInfo()->name()));
+  ASSERT_EQ(llvm::ELF::R_X86_64_PC32, scratch->type());
+  ASSERT_EQ(static_cast<mcld::Relocation::Address>(-0x4), scratch->addend());
+  scratch->target() = 0x1234;
+  reloc_data->store(1, *scratch);
+  ASSERT_TRUE(reloc_data->hasPacked());
+
+  reloc_data->materialize();
   const RelocData::RelocationListType& rRelocs =
       (*rs)->getRelocData()->getRelocationList();
   RelocData::const_iterator rReloc = rRelocs.begin();
@@ -142,6 +165,9 @@ TEST_F(ELFReaderTest, read_symbol_and_rela) {
   ASSERT_EQ(llvm::ELF::R_X86_64_PC32, rReloc->type());
   ASSERT_EQ(0x0u, rReloc->symValue());
   ASSERT_EQ(static_cast<mcld::Relocation::Address>(-0x4), rReloc->addend());
+  ASSERT_EQ(0x1234u, rReloc->target());
+  ASSERT_FALSE(reloc_data->hasPacked());
+  ASSERT_EQ(2u, reloc_data->size());
 }
 
 TEST_F(ELFReaderTest, read_regular_sections) {
@@ -152,3 +178,23 @@ TEST_F(ELFReaderTest, is_my_format) {
   bool doContinue;
   ASSERT_TRUE(m_pELFObjReader->isMyFormat(*m_pInput, doContinue));
 }
+
+TEST_F(ELFReaderTest, decode_symbols) {
+  LDSection* symtab_shdr = m_pInput->context()->getSection(".symtab");
+  ASSERT_TRUE(NULL != symtab_shdr);
+  LDSection* strtab_shdr = symtab_shdr->getLink();
+  ASSERT_TRUE(NULL != strtab_shdr);
+
+  llvm::StringRef symtab_region = m_pInput->memArea()->request(
+      m_pInput->fileOffset() + symtab_shdr->offset(), symtab_shdr->size());
+  llvm::StringRef strtab_region = m_pInput->memArea()->request(
+      m_pInput->fileOffset() + strtab_shdr->offset(), strtab_shdr->size());
+
+  // decoding does not create any symbol in the input context
+  ELFReaderIF::SymbolList symbols;
+  m_pELFReader->decodeSymbols(symtab_region, strtab_region.begin(), symbols);
+  ASSERT_EQ(11u, symbols.size());
+  ASSERT_EQ("hello.c", symbols[1].name.str());
+  ASSERT_EQ("puts", symbols[10].name.str());
+  ASSERT_TRUE(NULL == m_pInput->context()->getSymbol(1));
+}
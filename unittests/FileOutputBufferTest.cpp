@@ -0,0 +1,136 @@
+//===- FileOutputBufferTest.cpp -------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "FileOutputBufferTest.h"
+#include "mcld/Support/FileHandle.h"
+#include "mcld/Support/FileOutputBuffer.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace mcld;
+using namespace mcldtest;
+
+namespace {
+
+/// readFile - read the whole file pFD
+std::vector<uint8_t> readFile(int pFD) {
+  struct stat st;
+  std::vector<uint8_t> content;
+  if (::fstat(pFD, &st) != 0)
+    return content;
+  content.resize(st.st_size);
+  size_t done = 0;
+  while (done < content.size()) {
+    ssize_t result =
+        ::pread(pFD, content.data() + done, content.size() - done, done);
+    if (result <= 0)
+      break;
+    done += result;
+  }
+  content.resize(done);
+  return content;
+}
+
+}  // anonymous namespace
+
+// Constructor can do set-up work for all test here.
+FileOutputBufferTest::FileOutputBufferTest() : m_FD(-1) {
+}
+
+// Destructor can do clean-up work that doesn't throw exceptions here.
+FileOutputBufferTest::~FileOutputBufferTest() {
+}
+
+// SetUp() will be called immediately before each test.
+void FileOutputBufferTest::SetUp() {
+  char path[] = "/tmp/mcld-output-XXXXXX";
+  m_FD = ::mkstemp(path);
+  ASSERT_TRUE(m_FD >= 0);
+  m_Path = path;
+}
+
+// TearDown() will be called immediately after each test.
+void FileOutputBufferTest::TearDown() {
+  if (m_FD >= 0)
+    ::close(m_FD);
+  ::unlink(m_Path.c_str());
+}
+
+//==========================================================================//
+// Testcases
+//
+TEST_F(FileOutputBufferTest, map_small_output) {
+  FileHandle file;
+  ASSERT_TRUE(file.delegate(m_FD, FileHandle::ReadWrite));
+
+  std::unique_ptr<FileOutputBuffer> output;
+  ASSERT_FALSE(FileOutputBuffer::create(file, 4096, output, 1 << 20));
+  ASSERT_FALSE(output->isStreamed());
+  ASSERT_EQ(4096u, output->getBufferSize());
+
+  std::memcpy(output->getBufferStart() + 100, "mclinker", 8);
+  ASSERT_FALSE(output->commit());
+  output.reset();
+
+  std::vector<uint8_t> content = readFile(m_FD);
+  ASSERT_EQ(4096u, content.size());
+  ASSERT_EQ(0, std::memcmp(content.data() + 100, "mclinker", 8));
+  ASSERT_EQ(0, content[99]);
+}
+
+TEST_F(FileOutputBufferTest, stream_large_output) {
+  FileHandle file;
+  ASSERT_TRUE(file.delegate(m_FD, FileHandle::ReadWrite));
+
+  // three chunks and a tail, the second chunk is left zero
+  const size_t chunk = 8 * 1024 * 1024;
+  const size_t size = 3 * chunk + 123;
+  std::unique_ptr<FileOutputBuffer> output;
+  ASSERT_FALSE(FileOutputBuffer::create(file, size, output, 1 << 20));
+  ASSERT_TRUE(output->isStreamed());
+  ASSERT_EQ(size, output->getBufferSize());
+  ASSERT_TRUE(output->request(size - 8, 16).empty());
+
+  uint8_t* data = output->getBufferStart();
+  for (size_t i = 0; i < 4096; ++i)
+    data[i] = static_cast<uint8_t>(i * 7 + 1);
+  MemoryRegion region = output->request(2 * chunk + 5, 8);
+  ASSERT_EQ(8u, region.size());
+  std::memcpy(region.begin(), "mclinker", 8);
+  data[size - 1] = 0xff;
+
+  std::vector<uint8_t> expected(data, data + size);
+  ASSERT_FALSE(output->commit());
+  output.reset();
+
+  std::vector<uint8_t> content = readFile(m_FD);
+  ASSERT_EQ(size, content.size());
+  ASSERT_TRUE(expected == content);
+}
+
+TEST_F(FileOutputBufferTest, drop_uncommitted_stream) {
+  FileHandle file;
+  ASSERT_TRUE(file.delegate(m_FD, FileHandle::ReadWrite));
+
+  std::unique_ptr<FileOutputBuffer> output;
+  ASSERT_FALSE(FileOutputBuffer::create(file, 8192, output, 4096));
+  ASSERT_TRUE(output->isStreamed());
+  std::memset(output->getBufferStart(), 0xab, 8192);
+  output.reset();
+
+  // nothing is written without commit()
+  std::vector<uint8_t> content = readFile(m_FD);
+  ASSERT_EQ(8192u, content.size());
+  ASSERT_TRUE(std::vector<uint8_t>(8192, 0) == content);
+}
@@ -0,0 +1,45 @@
+//===- FileOutputBufferTest.h ---------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MCLD_FILEOUTPUTBUFFER_TEST_H
+#define MCLD_FILEOUTPUTBUFFER_TEST_H
+
+#include <gtest.h>
+
+#include <string>
+
+namespace mcldtest {
+
+/** \class FileOutputBufferTest
+ *  \brief The testcases of the mapped and the streamed output buffers.
+ *
+ *  \see FileOutputBuffer
+ */
+class FileOutputBufferTest : public ::testing::Test {
+ public:
+  // Constructor can do set-up work for all test here.
+  FileOutputBufferTest();
+
+  // Destructor can do clean-up work that doesn't throw exceptions here.
+  virtual ~FileOutputBufferTest();
+
+  // SetUp() will be called immediately before each test.
+  virtual void SetUp();
+
+  // TearDown() will be called immediately after each test.
+  virtual void TearDown();
+
+ protected:
+  /// the temporary output file
+  std::string m_Path;
+  int m_FD;
+};
+
+}  // namespace of mcldtest
+
+#endif
@@ -8,8 +8,11 @@
 //===----------------------------------------------------------------------===//
 #include "FragmentRefTest.h"
 
+#include "mcld/Fragment/FillFragment.h"
 #include "mcld/Fragment/FragmentRef.h"
 #include "mcld/Fragment/RegionFragment.h"
+#include "mcld/LD/LDSection.h"
+#include "mcld/LD/SectionData.h"
 #include "mcld/Support/MemoryAreaFactory.h"
 #include "mcld/Support/FileHandle.h"
 #include "mcld/Support/MemoryRegion.h"
@@ -20,6 +23,30 @@ using namespace mcld;
 using namespace mcld::sys::fs;
 using namespace mcldtest;
 
+namespace {
+
+/// walk - find the fragment at pOffset from pFrag fragment by fragment
+std::pair<Fragment*, uint64_t> walk(Fragment* pFrag, uint64_t pOffset) {
+  int64_t offset = pOffset;
+  while (pFrag != NULL) {
+    offset -= pFrag->size();
+    if (offset <= 0)
+      break;
+    pFrag = pFrag->getNextNode();
+  }
+  if (pFrag != NULL && pFrag->size() != 0) {
+    if (offset == 0)
+      pFrag = pFrag->getNextNode();
+    else
+      offset += pFrag->size();
+  }
+  if (pFrag == NULL)
+    return std::make_pair(pFrag, 0);
+  return std::make_pair(pFrag, offset);
+}
+
+}  // anonymous namespace
+
 // Constructor can do set-up work for all test here.
 FragmentRefTest::FragmentRefTest() {
 }
@@ -67,3 +94,35 @@ TEST_F(FragmentRefTest, ) {
   delete frag;
   delete areaFactory;
 }
+
+TEST_F(FragmentRefTest, offset_index_agrees_with_walk) {
+  LDSection* sect = LDSection::Create(".gcc_except_table",
+                                      LDFileFormat::GCCExceptTable, 0, 0);
+  SectionData* data = SectionData::Create(*sect);
+  sect->setSectionData(data);
+  uint64_t size = 0;
+  for (unsigned i = 0; i < 200; ++i) {
+    // some fragments are empty
+    new FillFragment(0x0, 1, (i % 3) * 8, data);
+    size += (i % 3) * 8;
+  }
+
+  for (uint64_t offset = 0; offset <= size + 8; ++offset) {
+    std::pair<Fragment*, uint64_t> expect = walk(&data->front(), offset);
+    FragmentRef* ref = FragmentRef::Create(data->front(), offset);
+    if (expect.first == NULL) {
+      ASSERT_TRUE(ref->isNull());
+    } else {
+      ASSERT_EQ(expect.first, ref->frag());
+      ASSERT_EQ(expect.second, ref->offset());
+    }
+  }
+
+  // a new fragment drops the index
+  Fragment* last = new FillFragment(0x0, 1, 16, data);
+  FragmentRef* ref = FragmentRef::Create(*sect, size + 4);
+  ASSERT_EQ(last, ref->frag());
+  ASSERT_EQ(4U, ref->offset());
+
+  LDSection::Destroy(sect);
+}
@@ -0,0 +1,90 @@
+//===- HashBucketCountTest.cpp --------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "mcld/Target/GNULDBackend.h"
+#include "HashBucketCountTest.h"
+
+#include <vector>
+
+using namespace mcld;
+using namespace mcldtest;
+
+// Constructor can do set-up work for all test here.
+HashBucketCountTest::HashBucketCountTest() {
+}
+
+// Destructor can do clean-up work that doesn't throw exceptions here.
+HashBucketCountTest::~HashBucketCountTest() {
+}
+
+// SetUp() will be called immediately before each test.
+void HashBucketCountTest::SetUp() {
+}
+
+// TearDown() will be called immediately after each test.
+void HashBucketCountTest::TearDown() {
+}
+
+//==========================================================================//
+// Testcases
+//
+TEST_F(HashBucketCountTest, empty_table) {
+  std::vector<uint32_t> hashes;
+  // .gnu.hash needs at least two buckets
+  EXPECT_EQ(1U, GNULDBackend::getHashBucketCount(hashes, false, 1));
+  EXPECT_EQ(2U, GNULDBackend::getHashBucketCount(hashes, true, 1));
+}
+
+TEST_F(HashBucketCountTest, distinct_buckets) {
+  // 17 hashes fall into 17 different buckets of 17, and into chains of 5 or
+  // 6 of 3 buckets.
+  std::vector<uint32_t> hashes;
+  for (uint32_t i = 0; i < 17; ++i)
+    hashes.push_back(i);
+  EXPECT_EQ(17U, GNULDBackend::getHashBucketCount(hashes, false, 1));
+  EXPECT_EQ(17U, GNULDBackend::getHashBucketCount(hashes, true, 1));
+}
+
+TEST_F(HashBucketCountTest, same_hash) {
+  // every count has one chain of all symbols, so the fewest buckets win. The
+  // candidates start at 1/8 of the symbols.
+  std::vector<uint32_t> hashes(100, 0x1234);
+  EXPECT_EQ(17U, GNULDBackend::getHashBucketCount(hashes, false, 1));
+  EXPECT_EQ(17U, GNULDBackend::getHashBucketCount(hashes, true, 1));
+}
+
+TEST_F(HashBucketCountTest, candidate_range) {
+  std::vector<uint32_t> hashes;
+  uint32_t hash = 5381;
+  for (unsigned i = 0; i < 3000; ++i) {
+    hash = hash * 33 + i;
+    hashes.push_back(hash);
+  }
+  unsigned sysv = GNULDBackend::getHashBucketCount(hashes, false, 1);
+  unsigned gnu = GNULDBackend::getHashBucketCount(hashes, true, 1);
+  EXPECT_TRUE(sysv * 8 >= hashes.size() && sysv <= hashes.size() * 2);
+  EXPECT_TRUE(gnu * 8 >= hashes.size() && gnu <= hashes.size() * 2);
+  // .hash walks whole chains for the other symbols, so it never chooses
+  // fewer buckets than .gnu.hash
+  EXPECT_TRUE(sysv >= gnu);
+}
+
+TEST_F(HashBucketCountTest, same_count_on_threads) {
+  std::vector<uint32_t> hashes;
+  uint32_t hash = 0;
+  for (unsigned i = 0; i < 20000; ++i) {
+    hash = hash * 1664525 + 1013904223;
+    hashes.push_back(hash);
+  }
+  for (unsigned threads = 2; threads <= 8; threads *= 2) {
+    EXPECT_EQ(GNULDBackend::getHashBucketCount(hashes, false, 1),
+              GNULDBackend::getHashBucketCount(hashes, false, threads));
+    EXPECT_EQ(GNULDBackend::getHashBucketCount(hashes, true, 1),
+              GNULDBackend::getHashBucketCount(hashes, true, threads));
+  }
+}
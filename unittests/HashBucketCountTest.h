@@ -0,0 +1,38 @@
+//===- HashBucketCountTest.h ----------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MCLD_HASHBUCKETCOUNT_TEST_H
+#define MCLD_HASHBUCKETCOUNT_TEST_H
+
+#include <gtest.h>
+
+namespace mcldtest {
+
+/** \class HashBucketCountTest
+ *  \brief The testcases of choosing the bucket count of .hash and .gnu.hash.
+ *
+ *  \see GNULDBackend::getHashBucketCount
+ */
+class HashBucketCountTest : public ::testing::Test {
+ public:
+  // Constructor can do set-up work for all test here.
+  HashBucketCountTest();
+
+  // Destructor can do clean-up work that doesn't throw exceptions here.
+  virtual ~HashBucketCountTest();
+
+  // SetUp() will be called immediately before each test.
+  virtual void SetUp();
+
+  // TearDown() will be called immediately after each test.
+  virtual void TearDown();
+};
+
+}  // namespace of mcldtest
+
+#endif
@@ -0,0 +1,152 @@
+//===- LinkerContextTest.cpp ----------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "mcld/Support/LinkerContext.h"
+#include "mcld/Support/MsgHandling.h"
+#include "mcld/Support/Parallel.h"
+#include "LinkerContextTest.h"
+
+#include <atomic>
+#include <vector>
+
+using namespace mcld;
+using namespace mcldtest;
+
+namespace {
+
+/// Counter - count the live objects, and remember the order of destruction
+struct Counter {
+  Counter() : value(0) { ++g_Live; }
+
+  ~Counter() {
+    --g_Live;
+    g_Destroyed.push_back(this);
+  }
+
+  int value;
+
+  static int g_Live;
+  static std::vector<Counter*> g_Destroyed;
+};
+
+int Counter::g_Live = 0;
+std::vector<Counter*> Counter::g_Destroyed;
+
+ContextStatic<Counter> g_First;
+ContextStatic<Counter> g_Second;
+
+}  // anonymous namespace
+
+// Constructor can do set-up work for all test here.
+LinkerContextTest::LinkerContextTest() {
+}
+
+// Destructor can do clean-up work that doesn't throw exceptions here.
+LinkerContextTest::~LinkerContextTest() {
+}
+
+// SetUp() will be called immediately before each test.
+void LinkerContextTest::SetUp() {
+  Counter::g_Destroyed.clear();
+}
+
+// TearDown() will be called immediately after each test.
+void LinkerContextTest::TearDown() {
+}
+
+//===----------------------------------------------------------------------===//
+// Testcases
+//===----------------------------------------------------------------------===//
+TEST_F(LinkerContextTest, separate_contexts) {
+  LinkerContext a, b;
+  int live = Counter::g_Live;
+  {
+    LinkerContext::Scope scope(a);
+    g_First->value = 1;
+    {
+      LinkerContext::Scope inner(b);
+      ASSERT_EQ(0, g_First->value);
+      g_First->value = 2;
+    }
+    ASSERT_EQ(1, g_First->value);
+  }
+  ASSERT_TRUE(&LinkerContext::current() == &LinkerContext::global());
+  ASSERT_EQ(live + 2, Counter::g_Live);
+
+  b.release();
+  ASSERT_TRUE(b.empty());
+  ASSERT_EQ(live + 1, Counter::g_Live);
+
+  LinkerContext::Scope scope(a);
+  ASSERT_EQ(1, g_First->value);
+}
+
+TEST_F(LinkerContextTest, release_in_reverse_order) {
+  LinkerContext context;
+  Counter* first = NULL;
+  Counter* second = NULL;
+  {
+    LinkerContext::Scope scope(context);
+    second = &*g_Second;
+    first = &*g_First;
+  }
+  context.release();
+  ASSERT_EQ(2U, Counter::g_Destroyed.size());
+  ASSERT_TRUE(first == Counter::g_Destroyed[0]);
+  ASSERT_TRUE(second == Counter::g_Destroyed[1]);
+
+  // the context can be reused after release
+  LinkerContext::Scope scope(context);
+  ASSERT_EQ(0, g_First->value);
+}
+
+TEST_F(LinkerContextTest, parallel_workers_share_context) {
+  LinkerContext context;
+  LinkerContext::Scope scope(context);
+  Counter* counter = &*g_First;
+
+  std::atomic<size_t> same(0);
+  parallelFor(4, 0, 64, [&](size_t pIdx) {
+    if (&*g_First == counter)
+      ++same;
+  });
+  ASSERT_EQ(64U, same.load());
+}
+
+TEST_F(LinkerContextTest, parallel_workers_create_once) {
+  LinkerContext context;
+  LinkerContext::Scope scope(context);
+  int live = Counter::g_Live;
+
+  // the slot is first reached on the workers
+  std::vector<Counter*> counters(64, NULL);
+  parallelFor(8, 0, counters.size(), [&](size_t pIdx) {
+    counters[pIdx] = &*g_Second;
+  });
+  ASSERT_EQ(live + 1, Counter::g_Live);
+  for (size_t i = 1; i < counters.size(); ++i)
+    ASSERT_TRUE(counters[0] == counters[i]);
+}
+
+TEST_F(LinkerContextTest, separate_diagnostic_engines) {
+  LinkerContext a, b;
+  ASSERT_TRUE(&a.getDiagEngine() != &b.getDiagEngine());
+
+  LinkerContext::Scope scope(a);
+  ASSERT_TRUE(&getDiagnosticEngine() == &a.getDiagEngine());
+  {
+    LinkerContext::Scope inner(b);
+    ASSERT_TRUE(&getDiagnosticEngine() == &b.getDiagEngine());
+  }
+  ASSERT_TRUE(&getDiagnosticEngine() == &a.getDiagEngine());
+
+  // the engine outlives the objects of the link
+  DiagnosticEngine* engine = &a.getDiagEngine();
+  a.release();
+  ASSERT_TRUE(&getDiagnosticEngine() == engine);
+}
@@ -0,0 +1,112 @@
+//===- MergedStringTableTest.cpp ------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "mcld/LD/MergedStringTable.h"
+#include "MergedStringTableTest.h"
+
+#include <string>
+#include <vector>
+
+using namespace mcld;
+using namespace mcldtest;
+
+namespace {
+
+std::string emit(const MergedStringTable& pTable,
+                 uint64_t pSize,
+                 unsigned pThreads) {
+  std::vector<uint8_t> buffer(pSize, 0xff);
+  MemoryRegion region(buffer);
+  pTable.emit(region, pThreads);
+  return std::string(buffer.begin(), buffer.end());
+}
+
+}  // anonymous namespace
+
+// Constructor can do set-up work for all test here.
+MergedStringTableTest::MergedStringTableTest() {
+}
+
+// Destructor can do clean-up work that doesn't throw exceptions here.
+MergedStringTableTest::~MergedStringTableTest() {
+}
+
+// SetUp() will be called immediately before each test.
+void MergedStringTableTest::SetUp() {
+}
+
+// TearDown() will be called immediately after each test.
+void MergedStringTableTest::TearDown() {
+}
+
+//==========================================================================//
+// Testcases
+//
+TEST_F(MergedStringTableTest, unique_strings) {
+  static const char input1[] = "int\0char\0main";
+  static const char input2[] = "char\0long\0int";
+
+  MergedStringTable table;
+  size_t id1 = table.addStrings(llvm::StringRef(input1, sizeof(input1)));
+  size_t id2 = table.addStrings(llvm::StringRef(input2, sizeof(input2)));
+  ASSERT_EQ(2U, table.numOfInputs());
+
+  // int, char, main and long
+  uint64_t size = table.finalizeOffset();
+  ASSERT_EQ(4U + 5U + 5U + 5U, size);
+
+  std::string output = emit(table, size, 1);
+  ASSERT_EQ(table.getOutputOffset(id1, 0), table.getOutputOffset(id2, 10));
+  ASSERT_EQ(table.getOutputOffset(id1, 4), table.getOutputOffset(id2, 0));
+  ASSERT_STREQ("main", output.c_str() + table.getOutputOffset(id1, 9));
+  ASSERT_STREQ("long", output.c_str() + table.getOutputOffset(id2, 5));
+}
+
+TEST_F(MergedStringTableTest, offset_in_string) {
+  static const char input[] = "debug_info\0str";
+
+  MergedStringTable table;
+  size_t id = table.addStrings(llvm::StringRef(input, sizeof(input)));
+  uint64_t size = table.finalizeOffset();
+  std::string output = emit(table, size, 1);
+
+  // refer to the suffix "info" of "debug_info"
+  ASSERT_STREQ("info", output.c_str() + table.getOutputOffset(id, 6));
+  ASSERT_STREQ("str", output.c_str() + table.getOutputOffset(id, 11));
+}
+
+TEST_F(MergedStringTableTest, independent_of_threads) {
+  std::vector<std::string> inputs;
+  for (unsigned i = 0; i < 16; ++i) {
+    std::string strings;
+    for (unsigned j = 0; j < 500; ++j) {
+      strings += "str" + std::to_string((i * 131 + j * 7) % 1000);
+      strings += '\0';
+    }
+    inputs.push_back(strings);
+  }
+
+  MergedStringTable serial, parallel;
+  for (const std::string& strings : inputs) {
+    serial.addStrings(strings);
+    parallel.addStrings(strings);
+  }
+  uint64_t size = serial.finalizeOffset(1);
+  ASSERT_EQ(size, parallel.finalizeOffset(8));
+  ASSERT_EQ(emit(serial, size, 1), emit(parallel, size, 8));
+
+  std::string output = emit(parallel, size, 8);
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    for (size_t offset = 0; offset < inputs[i].size(); offset += 13) {
+      ASSERT_EQ(serial.getOutputOffset(i, offset),
+                parallel.getOutputOffset(i, offset));
+      ASSERT_STREQ(inputs[i].c_str() + offset,
+                   output.c_str() + parallel.getOutputOffset(i, offset));
+    }
+  }
+}
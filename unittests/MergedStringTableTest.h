@@ -0,0 +1,38 @@
+//===- MergedStringTableTest.h --------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MCLD_MERGEDSTRINGTABLE_TEST_H
+#define MCLD_MERGEDSTRINGTABLE_TEST_H
+
+#include <gtest.h>
+
+namespace mcldtest {
+
+/** \class MergedStringTableTest
+ *  \brief The testcases of the string pool of .debug_str.
+ *
+ *  \see MergedStringTable
+ */
+class MergedStringTableTest : public ::testing::Test {
+ public:
+  // Constructor can do set-up work for all test here.
+  MergedStringTableTest();
+
+  // Destructor can do clean-up work that doesn't throw exceptions here.
+  virtual ~MergedStringTableTest();
+
+  // SetUp() will be called immediately before each test.
+  virtual void SetUp();
+
+  // TearDown() will be called immediately after each test.
+  virtual void TearDown();
+};
+
+}  // namespace of mcldtest
+
+#endif
@@ -205,3 +205,53 @@ TEST_F(NamePoolTest, insert_16384_weak_reference_symbols) {
     }
   }
 }
+
+TEST_F(NamePoolTest, insertSymbol_with_hash_copies_name_once) {
+  char name[16];
+  strcpy(name, "Hello MCLinker");
+  llvm::StringRef ref(name);
+  uint32_t hash = NamePool::Hash(ref);
+
+  Resolver::Result result1;
+  m_pTestee->insertSymbol(ref,
+                          hash,
+                          false,
+                          ResolveInfo::Function,
+                          ResolveInfo::Undefined,
+                          ResolveInfo::Global,
+                          0x0,
+                          0x0,
+                          ResolveInfo::Default,
+                          NULL,
+                          result1);
+  ASSERT_TRUE(result1.info != NULL);
+  EXPECT_FALSE(result1.existent);
+  EXPECT_NE(name, result1.info->name());
+  EXPECT_STREQ(name, result1.info->name());
+
+  // the same name meets the existing symbol and defines it
+  Resolver::Result result2;
+  m_pTestee->insertSymbol(ref,
+                          hash,
+                          false,
+                          ResolveInfo::Function,
+                          ResolveInfo::Define,
+                          ResolveInfo::Global,
+                          0x10,
+                          0x0,
+                          ResolveInfo::Hidden,
+                          NULL,
+                          result2);
+  EXPECT_TRUE(result2.existent);
+  EXPECT_TRUE(result2.overriden);
+  EXPECT_EQ(result1.info, result2.info);
+  EXPECT_TRUE(result2.info->isDefine());
+  EXPECT_EQ(0x10U, result2.info->size());
+  EXPECT_EQ(ResolveInfo::Hidden, result2.info->visibility());
+  EXPECT_EQ(1U, m_pTestee->size());
+
+  // the pool keeps its own copy of the name
+  name[0] = 'h';
+  EXPECT_STREQ("Hello MCLinker", result2.info->name());
+  EXPECT_EQ(result1.info, m_pTestee->findInfo("Hello MCLinker"));
+}
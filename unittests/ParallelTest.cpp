@@ -0,0 +1,129 @@
+//===- ParallelTest.cpp ---------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "mcld/Support/LinkerContext.h"
+#include "mcld/Support/Parallel.h"
+#include "ParallelTest.h"
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace mcld;
+using namespace mcldtest;
+
+// Constructor can do set-up work for all test here.
+ParallelTest::ParallelTest() {
+}
+
+// Destructor can do clean-up work that doesn't throw exceptions here.
+ParallelTest::~ParallelTest() {
+}
+
+// SetUp() will be called immediately before each test.
+void ParallelTest::SetUp() {
+}
+
+// TearDown() will be called immediately after each test.
+void ParallelTest::TearDown() {
+}
+
+//==========================================================================//
+// Testcases
+//
+TEST_F(ParallelTest, every_index_once) {
+  for (unsigned threads = 1; threads <= 8; threads *= 2) {
+    std::vector<std::atomic<unsigned> > counts(1000);
+    for (size_t i = 0; i < counts.size(); ++i)
+      counts[i] = 0;
+    parallelFor(threads, 0, counts.size(),
+                [&](size_t pIdx) { ++counts[pIdx]; });
+    for (size_t i = 0; i < counts.size(); ++i)
+      ASSERT_EQ(1U, counts[i].load());
+  }
+}
+
+TEST_F(ParallelTest, chunks) {
+  // [10, 1000) in chunks of 64 indices, the last one shorter
+  std::mutex mutex;
+  std::set<std::pair<size_t, size_t> > chunks;
+  parallelForRange(4, 10, 1000, 64, [&](size_t pBegin, size_t pEnd) {
+    std::lock_guard<std::mutex> lock(mutex);
+    chunks.insert(std::make_pair(pBegin, pEnd));
+  });
+  ASSERT_EQ(16U, chunks.size());
+  size_t next = 10;
+  std::set<std::pair<size_t, size_t> >::iterator it, ie = chunks.end();
+  for (it = chunks.begin(); it != ie; ++it) {
+    EXPECT_EQ(next, it->first);
+    EXPECT_TRUE(it->second - it->first <= 64);
+    next = it->second;
+  }
+  EXPECT_EQ(1000U, next);
+}
+
+TEST_F(ParallelTest, empty_range) {
+  bool called = false;
+  parallelForRange(4, 5, 5, 1, [&](size_t, size_t) { called = true; });
+  parallelFor(4, 7, 3, [&](size_t) { called = true; });
+  EXPECT_FALSE(called);
+}
+
+TEST_F(ParallelTest, inline_on_one_thread) {
+  // one thread, or a range of one chunk, runs on the calling thread
+  std::thread::id caller = std::this_thread::get_id();
+  std::vector<std::thread::id> ids(100);
+  parallelFor(1, 0, ids.size(), [&](size_t pIdx) {
+    ids[pIdx] = std::this_thread::get_id();
+  });
+  for (size_t i = 0; i < ids.size(); ++i)
+    EXPECT_TRUE(caller == ids[i]);
+
+  std::thread::id chunk_id;
+  parallelForRange(8, 0, 100, 100, [&](size_t, size_t) {
+    chunk_id = std::this_thread::get_id();
+  });
+  EXPECT_TRUE(caller == chunk_id);
+}
+
+TEST_F(ParallelTest, worker_scope) {
+  EXPECT_FALSE(ParallelWorkerScope::isActive());
+  for (unsigned threads = 1; threads <= 4; threads *= 4) {
+    std::atomic<unsigned> active(0);
+    parallelFor(threads, 0, 64, [&](size_t) {
+      if (ParallelWorkerScope::isActive())
+        ++active;
+    });
+    EXPECT_EQ(64U, active.load());
+    EXPECT_FALSE(ParallelWorkerScope::isActive());
+  }
+}
+
+TEST_F(ParallelTest, share_context) {
+  // the workers run in the current context of the caller
+  LinkerContext context;
+  LinkerContext::Scope scope(context);
+  std::atomic<unsigned> same(0);
+  parallelFor(4, 0, 64, [&](size_t) {
+    if (&LinkerContext::current() == &context)
+      ++same;
+  });
+  EXPECT_EQ(64U, same.load());
+}
+
+TEST_F(ParallelTest, for_each) {
+  std::vector<unsigned> values(500);
+  for (size_t i = 0; i < values.size(); ++i)
+    values[i] = i;
+  parallelForEach(4, values.begin(), values.end(),
+                  [](unsigned& pValue) { pValue *= 2; });
+  for (size_t i = 0; i < values.size(); ++i)
+    EXPECT_EQ(2 * i, values[i]);
+}
@@ -0,0 +1,149 @@
+//===- SectionIndexTest.cpp -----------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "SectionIndexTest.h"
+
+#include "mcld/LinkerScript.h"
+#include "mcld/Module.h"
+#include "mcld/LD/LDContext.h"
+#include "mcld/LD/LDFileFormat.h"
+#include "mcld/LD/LDSection.h"
+
+#include <llvm/Support/ELF.h>
+
+using namespace mcld;
+using namespace mcldtest;
+
+// Constructor can do set-up work for all test here.
+SectionIndexTest::SectionIndexTest() : m_pScript(NULL), m_pModule(NULL) {
+}
+
+// Destructor can do clean-up work that doesn't throw exceptions here.
+SectionIndexTest::~SectionIndexTest() {
+}
+
+// SetUp() will be called immediately before each test.
+void SectionIndexTest::SetUp() {
+  m_pScript = new LinkerScript();
+  m_pModule = new Module("test", *m_pScript);
+}
+
+// TearDown() will be called immediately after each test.
+void SectionIndexTest::TearDown() {
+  delete m_pModule;
+  delete m_pScript;
+  for (size_t i = 0; i < m_Sections.size(); ++i)
+    LDSection::Destroy(m_Sections[i]);
+  m_Sections.clear();
+}
+
+LDSection* SectionIndexTest::createSection(const std::string& pName) {
+  LDSection* sect = LDSection::Create(
+      pName, LDFileFormat::TEXT, llvm::ELF::SHT_PROGBITS, 0);
+  m_Sections.push_back(sect);
+  return sect;
+}
+
+//==========================================================================//
+// Testcases
+//
+TEST_F(SectionIndexTest, module_finds_added_sections) {
+  ASSERT_TRUE(m_pModule->getSection(".text") == NULL);
+
+  LDSection* text = createSection(".text");
+  m_pModule->addSection(*text);
+  ASSERT_EQ(text, m_pModule->getSection(".text"));
+
+  // a lookup between two additions sees both
+  LDSection* data = createSection(".data");
+  m_pModule->addSection(*data);
+  ASSERT_EQ(text, m_pModule->getSection(".text"));
+  ASSERT_EQ(data, m_pModule->getSection(".data"));
+  ASSERT_TRUE(m_pModule->getSection(".bss") == NULL);
+
+  const Module& module = *m_pModule;
+  ASSERT_EQ(data, module.getSection(".data"));
+  ASSERT_EQ(2U, module.size());
+  ASSERT_EQ(text, module.front());
+  ASSERT_EQ(data, module.back());
+}
+
+TEST_F(SectionIndexTest, module_finds_the_first_of_duplicate_names) {
+  LDSection* first = createSection(".rela.text");
+  LDSection* second = createSection(".rela.text");
+  m_pModule->addSection(*first);
+  m_pModule->addSection(*createSection(".text"));
+  m_pModule->addSection(*second);
+
+  ASSERT_EQ(3U, m_pModule->size());
+  ASSERT_EQ(first, m_pModule->getSection(".rela.text"));
+}
+
+TEST_F(SectionIndexTest, module_forgets_cleared_sections) {
+  LDSection* text = createSection(".text");
+  m_pModule->addSection(*text);
+  m_pModule->addSection(*createSection(".data"));
+  ASSERT_EQ(text, m_pModule->getSection(".text"));
+
+  m_pModule->clearSections();
+  ASSERT_TRUE(m_pModule->empty());
+  ASSERT_TRUE(m_pModule->getSection(".text") == NULL);
+  ASSERT_TRUE(m_pModule->getSection(".data") == NULL);
+
+  // the sections added again are found in their new order
+  LDSection* data = createSection(".data");
+  m_pModule->addSection(*data);
+  m_pModule->addSection(*text);
+  ASSERT_EQ(data, m_pModule->getSection(".data"));
+  ASSERT_EQ(text, m_pModule->getSection(".text"));
+  ASSERT_EQ(data, m_pModule->front());
+}
+
+TEST_F(SectionIndexTest, context_finds_appended_sections) {
+  LDContext context;
+  LDSection* null = createSection("");
+  LDSection* text = createSection(".text");
+  LDSection* data = createSection(".data");
+  context.appendSection(*null).appendSection(*text).appendSection(*data);
+
+  ASSERT_EQ(3U, context.numOfSections());
+  ASSERT_EQ(text, context.getSection(".text"));
+  ASSERT_EQ(data, context.getSection(".data"));
+  ASSERT_EQ(1U, context.getSectionIdx(".text"));
+  ASSERT_EQ(2U, context.getSectionIdx(".data"));
+  ASSERT_EQ(1U, text->index());
+  ASSERT_EQ(text, context.getSection(1U));
+  ASSERT_TRUE(context.getSection(3U) == NULL);
+
+  const LDContext& const_context = context;
+  ASSERT_EQ(data, const_context.getSection(".data"));
+}
+
+TEST_F(SectionIndexTest, context_misses_unknown_names) {
+  LDContext context;
+  context.appendSection(*createSection(""));
+  context.appendSection(*createSection(".text"));
+
+  ASSERT_TRUE(context.getSection(".bss") == NULL);
+  // index 0 is the null section, which stands for a miss
+  ASSERT_EQ(0U, context.getSectionIdx(".bss"));
+}
+
+TEST_F(SectionIndexTest, context_finds_the_first_of_duplicate_names) {
+  LDContext context;
+  LDSection* first = createSection(".group");
+  LDSection* second = createSection(".group");
+  context.appendSection(*createSection(""));
+  context.appendSection(*first);
+  context.appendSection(*createSection(".text"));
+  context.appendSection(*second);
+
+  ASSERT_EQ(first, context.getSection(".group"));
+  ASSERT_EQ(1U, context.getSectionIdx(".group"));
+  ASSERT_EQ(second, context.getSection(3U));
+}
@@ -0,0 +1,57 @@
+//===- SectionIndexTest.h -------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MCLD_SECTIONINDEX_TEST_H
+#define MCLD_SECTIONINDEX_TEST_H
+
+#include <gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace mcld {
+class LDSection;
+class LinkerScript;
+class Module;
+}  // namespace of mcld
+
+namespace mcldtest {
+
+/** \class SectionIndexTest
+ *  \brief The testcases of the section name indexes of the output module
+ *  and of the input contexts.
+ *
+ *  \see Module
+ *  \see LDContext
+ */
+class SectionIndexTest : public ::testing::Test {
+ public:
+  // Constructor can do set-up work for all test here.
+  SectionIndexTest();
+
+  // Destructor can do clean-up work that doesn't throw exceptions here.
+  virtual ~SectionIndexTest();
+
+  // SetUp() will be called immediately before each test.
+  virtual void SetUp();
+
+  // TearDown() will be called immediately after each test.
+  virtual void TearDown();
+
+ protected:
+  mcld::LDSection* createSection(const std::string& pName);
+
+ protected:
+  mcld::LinkerScript* m_pScript;
+  mcld::Module* m_pModule;
+  std::vector<mcld::LDSection*> m_Sections;
+};
+
+}  // namespace of mcldtest
+
+#endif
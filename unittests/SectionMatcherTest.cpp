@@ -0,0 +1,183 @@
+//===- SectionMatcherTest.cpp ---------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "SectionMatcherTest.h"
+#include "mcld/Object/SectionMatcher.h"
+
+#include <fnmatch.h>
+
+#include <string>
+
+using namespace mcld;
+using namespace mcldtest;
+
+namespace {
+
+typedef SectionMatcher::Glob Glob;
+typedef SectionMatcher::GlobDFA GlobDFA;
+typedef SectionMatcher::PrefixTrie PrefixTrie;
+typedef SectionMatcher::RuleList RuleList;
+
+const char* const kPatterns[] = {
+    ".text.[a-c]*",  // a range
+    ".data.[!x]",    // negated by '!'
+    ".data.[^x]",    // negated by '^'
+    "[]]x",          // ']' as the first member
+    "[!]a]*",        // ']' as the first member of a negated set
+    "[a-]z",         // '-' as the last member
+    "\\*lit",        // an escaped star
+    "\\[x\\]",       // escaped brackets
+    ".t?xt",
+    "*.*.*",         // several stars
+    "a**b",          // consecutive stars
+    "*a*b*c",
+    ".bss.[0-9][0-9]",
+};
+
+const char* const kNames[] = {
+    "",         ".text",    ".text.a",   ".text.c1",  ".text.d1",
+    ".data.x",  ".data.y",  ".data.",    "]x",        "ax",
+    "]a",       "bz",       "-z",        "az",        "*lit",
+    "xlit",     "[x]",      "x",         ".txt",      ".tXxt",
+    "a.b",      "a.b.c",    "..",        "ab",        "aXYb",
+    "abc",      "xaybzc",   "acb",       ".bss.42",   ".bss.4x",
+};
+
+const size_t kNumOfPatterns = sizeof(kPatterns) / sizeof(kPatterns[0]);
+const size_t kNumOfNames = sizeof(kNames) / sizeof(kNames[0]);
+
+bool fnmatched(const char* pPattern, const std::string& pName) {
+  return ::fnmatch(pPattern, pName.c_str(), 0) == 0;
+}
+
+}  // anonymous namespace
+
+// Constructor can do set-up work for all test here.
+SectionMatcherTest::SectionMatcherTest() {
+}
+
+// Destructor can do clean-up work that doesn't throw exceptions here.
+SectionMatcherTest::~SectionMatcherTest() {
+}
+
+// SetUp() will be called immediately before each test.
+void SectionMatcherTest::SetUp() {
+}
+
+// TearDown() will be called immediately after each test.
+void SectionMatcherTest::TearDown() {
+}
+
+//==========================================================================//
+// Testcases
+//
+TEST_F(SectionMatcherTest, glob_agrees_with_fnmatch) {
+  for (size_t p = 0; p < kNumOfPatterns; ++p) {
+    Glob glob;
+    ASSERT_TRUE(glob.compile(kPatterns[p])) << kPatterns[p];
+    GlobDFA dfa;
+    dfa.add(glob, 0);
+    for (size_t n = 0; n < kNumOfNames; ++n) {
+      RuleList rules;
+      dfa.match(kNames[n], rules);
+      EXPECT_EQ(fnmatched(kPatterns[p], kNames[n]), !rules.empty())
+          << kPatterns[p] << " on " << kNames[n];
+    }
+  }
+}
+
+TEST_F(SectionMatcherTest, leave_other_syntax_to_fnmatch) {
+  Glob glob;
+  ASSERT_FALSE(glob.compile("[[:alpha:]]*"));
+  ASSERT_FALSE(glob.compile("[a\\]]"));
+  ASSERT_FALSE(glob.compile(".text.[ab"));
+  ASSERT_FALSE(glob.compile("trailing\\"));
+}
+
+TEST_F(SectionMatcherTest, dfa_runs_globs_together) {
+  GlobDFA dfa;
+  for (size_t p = 0; p < kNumOfPatterns; ++p) {
+    Glob glob;
+    ASSERT_TRUE(glob.compile(kPatterns[p]));
+    dfa.add(glob, p);
+  }
+
+  for (size_t n = 0; n < kNumOfNames; ++n) {
+    RuleList rules;
+    dfa.match(kNames[n], rules);
+    std::vector<bool> matched(kNumOfPatterns, false);
+    for (size_t i = 0; i < rules.size(); ++i)
+      matched[rules[i]] = true;
+    for (size_t p = 0; p < kNumOfPatterns; ++p) {
+      EXPECT_EQ(fnmatched(kPatterns[p], kNames[n]), matched[p])
+          << kPatterns[p] << " on " << kNames[n];
+    }
+  }
+}
+
+TEST_F(SectionMatcherTest, dfa_reset_keeps_results) {
+  // a star followed by fixed characters needs a state for every subset of
+  // the last positions, more than GlobDFA keeps
+  const char* pattern = "*a?????????????";
+  Glob glob;
+  ASSERT_TRUE(glob.compile(pattern));
+  GlobDFA dfa;
+  dfa.add(glob, 0);
+
+  uint32_t seed = 1;
+  bool reset = false;
+  size_t last = 0;
+  for (unsigned i = 0; i < 2000; ++i) {
+    std::string name;
+    for (unsigned c = 0; c < 40; ++c) {
+      seed = seed * 1103515245 + 12345;
+      name.push_back(((seed >> 16) & 1) ? 'a' : 'b');
+    }
+    RuleList rules;
+    dfa.match(name, rules);
+    ASSERT_EQ(fnmatched(pattern, name), !rules.empty()) << name;
+
+    // a match adds at most one state per character after a reset
+    ASSERT_TRUE(dfa.numOfStates() <= GlobDFA::MaxStates + name.size() + 2);
+    if (dfa.numOfStates() < last)
+      reset = true;
+    last = dfa.numOfStates();
+  }
+  ASSERT_TRUE(reset);
+}
+
+TEST_F(SectionMatcherTest, prefix_trie) {
+  PrefixTrie trie;
+  trie.add(".text", 0);
+  trie.add(".text.hot", 1);
+  trie.add(".data", 2);
+  trie.add(".text", 3);
+
+  RuleList rules;
+  trie.match(".text.hot.foo", rules);
+  ASSERT_EQ(3U, rules.size());
+  EXPECT_EQ(0U, rules[0]);
+  EXPECT_EQ(3U, rules[1]);
+  EXPECT_EQ(1U, rules[2]);
+
+  rules.clear();
+  trie.match(".tex", rules);
+  EXPECT_TRUE(rules.empty());
+
+  rules.clear();
+  trie.match(".data", rules);
+  ASSERT_EQ(1U, rules.size());
+  EXPECT_EQ(2U, rules[0]);
+
+  // the empty prefix matches every name
+  trie.add("", 4);
+  rules.clear();
+  trie.match("", rules);
+  ASSERT_EQ(1U, rules.size());
+  EXPECT_EQ(4U, rules[0]);
+}
@@ -0,0 +1,317 @@
+//===- SectionMergerTest.cpp ----------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "SectionMergerTest.h"
+
+#include "mcld/IRBuilder.h"
+#include "mcld/LinkerConfig.h"
+#include "mcld/LinkerScript.h"
+#include "mcld/Module.h"
+#include "mcld/Fragment/FragmentRef.h"
+#include "mcld/Fragment/RegionFragment.h"
+#include "mcld/Fragment/Relocation.h"
+#include "mcld/LD/LDSection.h"
+#include "mcld/LD/LDSymbol.h"
+#include "mcld/LD/RelocData.h"
+#include "mcld/LD/SectionData.h"
+#include "mcld/LD/SectionMerger.h"
+#include "mcld/MC/Input.h"
+#include "mcld/Object/ObjectBuilder.h"
+#include "mcld/Support/Path.h"
+
+#include <llvm/Support/Casting.h>
+#include <llvm/Support/ELF.h>
+
+#include <string>
+
+using namespace mcld;
+using namespace mcldtest;
+
+namespace {
+
+/// addInput - add an object named pName
+Input* addInput(IRBuilder& pBuilder, const std::string& pName) {
+  Input* input = pBuilder.CreateInput(pName, sys::fs::Path(pName),
+                                      Input::Object);
+  pBuilder.getModule().getObjectList().push_back(input);
+  return input;
+}
+
+/// addSection - add a section of pSize bytes at pContent to pInput, the way
+/// ELFReader reads a regular section
+LDSection* addSection(Input& pInput,
+                      const std::string& pName,
+                      uint32_t pFlag,
+                      uint32_t pEntSize,
+                      const char* pContent,
+                      size_t pSize) {
+  LDSection* sect = IRBuilder::CreateELFHeader(pInput,
+                                               pName,
+                                               llvm::ELF::SHT_PROGBITS,
+                                               pFlag,
+                                               pEntSize);
+  sect->setEntSize(pEntSize);
+  sect->setSize(pSize);
+  SectionData* data = IRBuilder::CreateSectionData(*sect);
+  Fragment* frag =
+      IRBuilder::CreateRegion(const_cast<char*>(pContent), pSize);
+  ObjectBuilder::AppendFragment(*frag, *data);
+  return sect;
+}
+
+/// addStrings - add a mergeable string section of pSize bytes
+LDSection* addStrings(Input& pInput, const char* pContent, size_t pSize) {
+  return addSection(pInput,
+                    ".rodata.str1.1",
+                    llvm::ELF::SHF_ALLOC | llvm::ELF::SHF_MERGE |
+                        llvm::ELF::SHF_STRINGS,
+                    1,
+                    pContent,
+                    pSize);
+}
+
+/// contents - the contents of the fragments of pData
+std::string contents(const SectionData& pData) {
+  std::string result;
+  SectionData::const_iterator frag, fragEnd = pData.end();
+  for (frag = pData.begin(); frag != fragEnd; ++frag) {
+    if (const RegionFragment* region = llvm::dyn_cast<RegionFragment>(frag))
+      result += region->getRegion().str();
+  }
+  return result;
+}
+
+/// mergeInto - move the sections pInputs into the output section pOutput,
+/// the way the linker merges the input sections
+void mergeInto(LDSection& pOutput, LDSection* const* pInputs, size_t pSize) {
+  for (size_t i = 0; i < pSize; ++i) {
+    ObjectBuilder::MoveSectionData(*pInputs[i]->getSectionData(),
+                                   *pOutput.getSectionData());
+  }
+}
+
+}  // anonymous namespace
+
+// Constructor can do set-up work for all test here.
+SectionMergerTest::SectionMergerTest() {
+  m_pConfig = new LinkerConfig("x86_64-linux-gnu");
+  m_pConfig->targets().setBitClass(64);
+  Relocation::SetUp(*m_pConfig);
+  m_pScript = new LinkerScript();
+  m_pModule = new Module(*m_pScript);
+  m_pBuilder = new IRBuilder(*m_pModule, *m_pConfig);
+}
+
+// Destructor can do clean-up work that doesn't throw exceptions here.
+SectionMergerTest::~SectionMergerTest() {
+  delete m_pBuilder;
+  delete m_pModule;
+  delete m_pScript;
+  delete m_pConfig;
+}
+
+// SetUp() will be called immediately before each test.
+void SectionMergerTest::SetUp() {
+}
+
+// TearDown() will be called immediately after each test.
+void SectionMergerTest::TearDown() {
+}
+
+//==========================================================================//
+// Testcases
+//
+TEST_F(SectionMergerTest, remove_duplicate_strings) {
+  static const char a[] = "abc\0hello";
+  static const char b[] = "hello\0lo\0xyz";
+  LDSection* inputs[2];
+  inputs[0] = addStrings(*addInput(*m_pBuilder, "a.o"), a, sizeof(a));
+  inputs[1] = addStrings(*addInput(*m_pBuilder, "b.o"), b, sizeof(b));
+
+  SectionMerger merger(*m_pConfig, *m_pModule);
+  merger.split();
+
+  LDSection* output = LDSection::Create(
+      ".rodata", LDFileFormat::TEXT, llvm::ELF::SHT_PROGBITS, 0);
+  IRBuilder::CreateSectionData(*output);
+  mergeInto(*output, inputs, 2);
+  merger.merge();
+
+  // "lo" is not folded without --tail-merge-strings
+  std::string expected("abc\0hello\0lo\0xyz\0", 17);
+  ASSERT_EQ(expected, contents(*output->getSectionData()));
+  ASSERT_EQ(expected.size(), output->size());
+}
+
+TEST_F(SectionMergerTest, tail_merge_strings) {
+  m_pConfig->options().setTailMergeStrings(true);
+  static const char a[] = "lo\0abc";
+  static const char b[] = "hello\0bc\0abc";
+  LDSection* inputs[2];
+  inputs[0] = addStrings(*addInput(*m_pBuilder, "a.o"), a, sizeof(a));
+  inputs[1] = addStrings(*addInput(*m_pBuilder, "b.o"), b, sizeof(b));
+
+  SectionMerger merger(*m_pConfig, *m_pModule);
+  merger.split();
+
+  LDSection* output = LDSection::Create(
+      ".rodata", LDFileFormat::TEXT, llvm::ELF::SHT_PROGBITS, 0);
+  IRBuilder::CreateSectionData(*output);
+  mergeInto(*output, inputs, 2);
+  merger.merge();
+
+  // "lo" is the tail of "hello", "bc" the tail of "abc"
+  std::string expected("abc\0hello\0", 10);
+  ASSERT_EQ(expected, contents(*output->getSectionData()));
+  ASSERT_EQ(expected.size(), output->size());
+}
+
+TEST_F(SectionMergerTest, merge_constants) {
+  // two 8-byte constants in each input, the second ones are the same
+  static const char a[] = "\1\0\0\0\0\0\0\0\2\0\0\0\0\0\0";
+  static const char b[] = "\3\0\0\0\0\0\0\0\2\0\0\0\0\0\0";
+  static const char c[] = "\2\0\0\0";
+  uint32_t flag = llvm::ELF::SHF_ALLOC | llvm::ELF::SHF_MERGE;
+  LDSection* inputs[2];
+  inputs[0] = addSection(*addInput(*m_pBuilder, "a.o"),
+                         ".rodata.cst8", flag, 8, a, sizeof(a));
+  inputs[1] = addSection(*addInput(*m_pBuilder, "b.o"),
+                         ".rodata.cst8", flag, 8, b, sizeof(b));
+
+  // a constant of another size is never folded into the 8-byte ones
+  LDSection* cst4 = addSection(*addInput(*m_pBuilder, "c.o"),
+                               ".rodata.cst4", flag, 4, c, sizeof(c) - 1);
+
+  SectionMerger merger(*m_pConfig, *m_pModule);
+  merger.split();
+
+  LDSection* output = LDSection::Create(
+      ".rodata", LDFileFormat::TEXT, llvm::ELF::SHT_PROGBITS, 0);
+  IRBuilder::CreateSectionData(*output);
+  mergeInto(*output, inputs, 2);
+  mergeInto(*output, &cst4, 1);
+  merger.merge();
+
+  std::string expected(a, 16);
+  expected.append(b, 8);
+  expected.append(c, 4);
+  ASSERT_EQ(expected, contents(*output->getSectionData()));
+  ASSERT_EQ(expected.size(), output->size());
+}
+
+TEST_F(SectionMergerTest, rewrite_relocation_into_string) {
+  static const char a[] = "abc\0hello";
+  static const char b[] = "xyz\0hello";
+  static const char text[] = "\0\0\0\0\0\0\0";
+  LDSection* inputs[2];
+  inputs[0] = addStrings(*addInput(*m_pBuilder, "a.o"), a, sizeof(a));
+  Input* b_obj = addInput(*m_pBuilder, "b.o");
+  inputs[1] = addStrings(*b_obj, b, sizeof(b));
+
+  // b.o refers to "llo" in its "hello" through the section symbol
+  LDSection* b_text = addSection(*b_obj,
+                                 ".text",
+                                 llvm::ELF::SHF_ALLOC |
+                                     llvm::ELF::SHF_EXECINSTR,
+                                 1,
+                                 text,
+                                 sizeof(text));
+  LDSection* b_rela = IRBuilder::CreateELFHeader(
+      *b_obj, ".rela.text", llvm::ELF::SHT_RELA, 0, 8);
+  b_rela->setLink(b_text);
+  IRBuilder::CreateRelocData(*b_rela);
+  LDSymbol* sym = m_pBuilder->AddSymbol(*b_obj,
+                                        ".rodata.str1.1",
+                                        ResolveInfo::Section,
+                                        ResolveInfo::Define,
+                                        ResolveInfo::Local,
+                                        0,
+                                        0,
+                                        inputs[1]);
+  ASSERT_TRUE(sym != NULL);
+  Relocation* reloc = IRBuilder::AddRelocation(
+      *b_rela, llvm::ELF::R_X86_64_64, *sym, 0, 6);
+  ASSERT_TRUE(reloc != NULL);
+
+  SectionMerger merger(*m_pConfig, *m_pModule);
+  merger.split();
+
+  LDSection* output = LDSection::Create(
+      ".rodata", LDFileFormat::TEXT, llvm::ELF::SHT_PROGBITS, 0);
+  IRBuilder::CreateSectionData(*output);
+  mergeInto(*output, inputs, 2);
+  merger.merge();
+  merger.rewriteRelocations();
+
+  std::string merged = contents(*output->getSectionData());
+  ASSERT_EQ(std::string("abc\0hello\0xyz\0", 14), merged);
+
+  // the section symbol stays at "xyz", the addend now reaches the "llo" of
+  // the "hello" of a.o
+  int64_t target = sym->fragRef()->getOutputOffset() + reloc->addend();
+  ASSERT_EQ(10U, sym->fragRef()->getOutputOffset());
+  ASSERT_EQ(6, target);
+  ASSERT_EQ(std::string("llo"), merged.substr(target, 3));
+}
+
+TEST_F(SectionMergerTest, rewrite_bound_relocation_into_string) {
+  static const char a[] = "abc\0hello";
+  static const char b[] = "xyz\0hello";
+  static const char text[] = "\0\0\0\0\0\0\0";
+  LDSection* inputs[2];
+  inputs[0] = addStrings(*addInput(*m_pBuilder, "a.o"), a, sizeof(a));
+  Input* b_obj = addInput(*m_pBuilder, "b.o");
+  inputs[1] = addStrings(*b_obj, b, sizeof(b));
+
+  // the same reference as above, kept packed and bound to its place
+  LDSection* b_text = addSection(*b_obj,
+                                 ".text",
+                                 llvm::ELF::SHF_ALLOC |
+                                     llvm::ELF::SHF_EXECINSTR,
+                                 1,
+                                 text,
+                                 sizeof(text));
+  LDSection* b_rela = IRBuilder::CreateELFHeader(
+      *b_obj, ".rela.text", llvm::ELF::SHT_RELA, 0, 8);
+  b_rela->setLink(b_text);
+  RelocData* reloc_data = IRBuilder::CreateRelocData(*b_rela);
+  LDSymbol* sym = m_pBuilder->AddSymbol(*b_obj,
+                                        ".rodata.str1.1",
+                                        ResolveInfo::Section,
+                                        ResolveInfo::Define,
+                                        ResolveInfo::Local,
+                                        0,
+                                        0,
+                                        inputs[1]);
+  ASSERT_TRUE(sym != NULL);
+  reloc_data->addPacked(llvm::ELF::R_X86_64_64, sym->resolveInfo(), 0, 6);
+  reloc_data->bind();
+  ASSERT_TRUE(reloc_data->isBound());
+
+  SectionMerger merger(*m_pConfig, *m_pModule);
+  merger.split();
+
+  LDSection* output = LDSection::Create(
+      ".rodata", LDFileFormat::TEXT, llvm::ELF::SHT_PROGBITS, 0);
+  IRBuilder::CreateSectionData(*output);
+  mergeInto(*output, inputs, 2);
+  merger.merge();
+  merger.rewriteRelocations();
+
+  ASSERT_TRUE(reloc_data->hasPacked());
+  ASSERT_EQ(-4, static_cast<int64_t>(reloc_data->getAddend(0)));
+  ASSERT_EQ(0U, reloc_data->getOffset(0));
+  ASSERT_TRUE(reloc_data->getFrag(0) != NULL);
+
+  reloc_data->materialize();
+  ASSERT_FALSE(reloc_data->hasPacked());
+  ASSERT_EQ(1U, reloc_data->size());
+  Relocation* reloc = llvm::cast<Relocation>(reloc_data->begin());
+  ASSERT_EQ(-4, static_cast<int64_t>(reloc->addend()));
+  ASSERT_EQ(b_text, &reloc->targetRef().frag()->getParent()->getSection());
+}
@@ -0,0 +1,52 @@
+//===- SectionMergerTest.h ------------------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MCLD_SECTIONMERGER_TEST_H
+#define MCLD_SECTIONMERGER_TEST_H
+
+#include <gtest.h>
+
+namespace mcld {
+class IRBuilder;
+class LinkerConfig;
+class LinkerScript;
+class Module;
+}  // namespace mcld
+
+namespace mcldtest {
+
+/** \class SectionMergerTest
+ *  \brief The testcases of merging the strings and the constants of the
+ *  mergeable sections.
+ *
+ *  \see SectionMerger
+ */
+class SectionMergerTest : public ::testing::Test {
+ public:
+  // Constructor can do set-up work for all test here.
+  SectionMergerTest();
+
+  // Destructor can do clean-up work that doesn't throw exceptions here.
+  virtual ~SectionMergerTest();
+
+  // SetUp() will be called immediately before each test.
+  virtual void SetUp();
+
+  // TearDown() will be called immediately after each test.
+  virtual void TearDown();
+
+ protected:
+  mcld::LinkerConfig* m_pConfig;
+  mcld::LinkerScript* m_pScript;
+  mcld::Module* m_pModule;
+  mcld::IRBuilder* m_pBuilder;
+};
+
+}  // namespace of mcldtest
+
+#endif
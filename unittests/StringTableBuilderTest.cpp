@@ -0,0 +1,117 @@
+//===- StringTableBuilderTest.cpp -----------------------------------------===//
+//
+//                     The MCLinker Project
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "mcld/LD/StringTableBuilder.h"
+#include "StringTableBuilderTest.h"
+
+#include <string>
+#include <vector>
+
+using namespace mcld;
+using namespace mcldtest;
+
+namespace {
+
+std::string emit(const StringTableBuilder& pTable, unsigned pThreads) {
+  std::vector<uint8_t> buffer(pTable.size(), 0xff);
+  MemoryRegion region(buffer);
+  pTable.emit(region, pThreads);
+  return std::string(buffer.begin(), buffer.end());
+}
+
+}  // anonymous namespace
+
+// Constructor can do set-up work for all test here.
+StringTableBuilderTest::StringTableBuilderTest() {
+}
+
+// Destructor can do clean-up work that doesn't throw exceptions here.
+StringTableBuilderTest::~StringTableBuilderTest() {
+}
+
+// SetUp() will be called immediately before each test.
+void StringTableBuilderTest::SetUp() {
+}
+
+// TearDown() will be called immediately after each test.
+void StringTableBuilderTest::TearDown() {
+}
+
+//==========================================================================//
+// Testcases
+//
+TEST_F(StringTableBuilderTest, merge_duplicates_and_suffixes) {
+  StringTableBuilder table;
+  table.add("printf");
+  table.add(".init");
+  table.add("");
+  table.add("init");
+  table.add("printf");
+  table.add("f");
+  table.add(".fini");
+
+  // the null character, printf, .init and .fini
+  size_t size = table.finalizeOffset();
+  ASSERT_EQ(1U + 7U + 6U + 6U, size);
+  ASSERT_EQ(size, table.size());
+
+  std::string output = emit(table, 1);
+  ASSERT_EQ('\0', output[0]);
+  ASSERT_EQ(0U, table.getOffset(""));
+  ASSERT_STREQ("printf", output.c_str() + table.getOffset("printf"));
+  ASSERT_STREQ(".init", output.c_str() + table.getOffset(".init"));
+  ASSERT_STREQ(".fini", output.c_str() + table.getOffset(".fini"));
+  ASSERT_EQ(table.getOffset(".init") + 1, table.getOffset("init"));
+  ASSERT_EQ(table.getOffset("printf") + 5, table.getOffset("f"));
+  ASSERT_FALSE(table.hasString("puts"));
+}
+
+TEST_F(StringTableBuilderTest, append_after_finalize) {
+  StringTableBuilder table;
+  table.add("__libc_start_main");
+  size_t size = table.finalizeOffset();
+
+  // a name in the table is not appended again
+  ASSERT_EQ(table.getOffset("__libc_start_main"),
+            table.append("__libc_start_main"));
+  ASSERT_EQ(size, table.size());
+
+  std::string stub("__stub_puts");
+  ASSERT_EQ(size, table.append(stub));
+  stub.clear();
+  ASSERT_EQ(size + 12U, table.size());
+  ASSERT_EQ(size, table.getOffset("__stub_puts"));
+
+  std::string output = emit(table, 1);
+  ASSERT_STREQ("__stub_puts", output.c_str() + size);
+}
+
+TEST_F(StringTableBuilderTest, independent_of_threads) {
+  std::vector<std::string> names;
+  for (unsigned i = 0; i < 20000; ++i) {
+    std::string name = "_ZN4mcld" + std::to_string((i * 7919) % 5000);
+    if (i % 3 == 0)
+      name = name.substr(i % name.size());
+    names.push_back(name + "Ev");
+  }
+
+  StringTableBuilder serial, parallel;
+  for (const std::string& name : names) {
+    serial.add(name);
+    parallel.add(name);
+  }
+  size_t size = serial.finalizeOffset(1);
+  ASSERT_EQ(size, parallel.finalizeOffset(8));
+  ASSERT_EQ(emit(serial, 1), emit(parallel, 8));
+
+  std::string output = emit(parallel, 8);
+  for (const std::string& name : names) {
+    ASSERT_EQ(serial.getOffset(name), parallel.getOffset(name));
+    ASSERT_STREQ(name.c_str(), output.c_str() + parallel.getOffset(name));
+  }
+}